@@ -87,6 +87,7 @@ class AnaMorph_cellgen : private CLApplication {
         uint32_t            ana_nthreads;
         double              ana_univar_solver_eps;
         double              ana_bivar_solver_eps;
+        bool                ana_stop_at_first_isec;
 
         bool                meshing;
         bool                force_meshing;
@@ -124,10 +125,35 @@ class AnaMorph_cellgen : private CLApplication {
         double              pp_hc_beta;
         uint32_t            pp_hc_maxiter;
 
+        std::string         pp_input_filename;
+        bool                pp_output_binary;
+        bool                pp_in_memory;
+        bool                meshing_no_obj;
+        /* memory budget in MB for out-of-core meshing / post-processing, 0 if disabled */
+        uint32_t            ooc_memory_budget;
+
+        /* output file of the stage profile, "" if disabled */
+        std::string         profile_filename;
+
+        /* list file or directory of input files for batch mode, "" if disabled */
+        std::string         batch_list;
+        uint32_t            batch_nworkers;
+
                             AnaMorph_cellgen(AnaMorph_cellgen const &) = delete;
                             AnaMorph_cellgen(AnaMorph_cellgen const &&) = delete;
         AnaMorph_cellgen   &operator=(AnaMorph_cellgen const &) = delete;
 
+        /* set network_name from an input file name, returns false if the name is invalid */
+        bool                setNetworkName(std::string const &filename);
+
+        /* process the single network network_name, returns EXIT_SUCCESS / EXIT_FAILURE. runNetwork() wraps
+         * processNetwork() into a stage profile if requested. */
+        int                 runNetwork();
+        int                 processNetwork();
+
+        /* process all networks of batch_list in a pool of worker processes */
+        int                 runBatch();
+
     public:
                             AnaMorph_cellgen(int argc, char *argv[]);
         virtual				~AnaMorph_cellgen() {};
@@ -0,0 +1,109 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BVH_H
+#define BVH_H
+
+#include "common.hh"
+#include "BoundingBox.hh"
+
+/* bounding volume hierarchy over a fixed set of axis-aligned bounding boxes. the tree is built by recursive median
+ * splits along the longest axis of the box centres and stored in pre-order: the left child of node k is k + 1, the
+ * right child follows the 2m - 1 nodes of the left subtree over m boxes. the subtrees of the top levels are built
+ * concurrently on up to nthreads threads, the result does not depend on nthreads.
+ *
+ * overlappingPairs() reports all pairs of boxes that intersect in the sense of BoundingBox::operator&&() by a
+ * simultaneous descent of the tree against itself in O(n log n + k) for k reported pairs. */
+template <typename R>
+class BVH {
+    private:
+        struct Node {
+            BoundingBox<R>                  bb;
+            /* range of order[] covered by the node. leaves cover exactly one box. */
+            uint32_t                        begin;
+            uint32_t                        end;
+        };
+
+        std::vector<BoundingBox<R>>         boxes;
+        std::vector<uint32_t>               order;
+        std::vector<Node>                   nodes;
+
+        void                                build(
+                                                uint32_t                                k,
+                                                uint32_t                                begin,
+                                                uint32_t                                end,
+                                                uint32_t                                nthreads);
+
+        bool                                isLeaf(uint32_t k) const;
+        uint32_t                            leftChild(uint32_t k) const;
+        uint32_t                            rightChild(uint32_t k) const;
+
+        template <typename F>
+        void                                selfPairs(
+                                                uint32_t                                k,
+                                                F const                                &f) const;
+
+        template <typename F>
+        void                                crossPairs(
+                                                uint32_t                                a,
+                                                uint32_t                                b,
+                                                F const                                &f) const;
+
+    public:
+                                            BVH(
+                                                std::vector<BoundingBox<R>> const      &boxes,
+                                                uint32_t                                nthreads = 1);
+
+        size_t                              size() const;
+
+        /* call f(i, j) with i < j for every pair of overlapping boxes i and j, in unspecified order */
+        template <typename F>
+        void                                overlappingPairs(F const &f) const;
+};
+
+#include "../tsrc/BVH_impl.hh"
+
+#endif
@@ -1079,6 +1079,18 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 ValuePred      *pred;
                 CellNetwork    *network;
 
+                /* all vertices / edges of a CellNetwork are NeuronVertex / NeuronEdge objects. the checked
+                 * dynamic_cast is only done in debug builds, since it is paid on every increment. */
+                static DelegatorType *
+                toDelegator(BaseType *p)
+                {
+#ifdef __DEBUG__
+                    return dynamic_cast<DelegatorType *>(p);
+#else
+                    return static_cast<DelegatorType *>(p);
+#endif
+                }
+
             private:
                 /* private ctors, can only be called by CellNetwork. */
                 CellNetworkIterator()
@@ -1137,7 +1149,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         /* while iterator hasn't reached end() */
                         while (this->int_it != this->int_ds->end()) {
                             /* down-cast to delegator type, throw if downcast fails. */
-                            dp = dynamic_cast<DelegatorType *>(BaseType::getPtr(this->int_it));
+                            dp = CellNetworkIterator::toDelegator(BaseType::getPtr(this->int_it));
                             if (dp) {
                                 /* if type matches, return, otherwise increment the internal iterator
                                  * and restart the loop if end() hasn't been reached yet */
@@ -1193,7 +1205,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         --this->int_it;
 
                         /* down-cast to delegator type, throw() if downcast fails. */
-                        dp = dynamic_cast<DelegatorType *>(BaseType::getPtr(this->int_it));
+                        dp = CellNetworkIterator::toDelegator(BaseType::getPtr(this->int_it));
                         if (dp) {
                             /* if type matches, return, otherwise decrement the internal iterator
                              * and restart the loop if end() hasn't been reached yet */
@@ -1244,7 +1256,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 operator->() const
                 {
                     /* directly down-cast base type to value type */
-                    ValueType   *vp = dynamic_cast<ValueType *>(BaseType::getPtr(this->int_it)); 
+#ifdef __DEBUG__
+                    ValueType   *vp = dynamic_cast<ValueType *>(BaseType::getPtr(this->int_it));
+#else
+                    /* the predicate has already checked the type tag of the element the iterator points to, the
+                     * (single, non-virtual) inheritance chain makes static_cast valid. */
+                    ValueType   *vp = static_cast<ValueType *>(BaseType::getPtr(this->int_it));
+#endif
 
                     /* if cast has been successful, return ValueType pointer, otherwise throw(). */
                     if (vp) {
@@ -1272,8 +1290,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuronVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                 NeuronVertexPred
             > 
         {
@@ -1283,8 +1301,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                           NeuronVertex,
                           typename Graph<Tn, Tv, Te>::Vertex,
                           NeuronVertex,
-                          std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                          typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                          IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                          typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                           NeuronVertexPred
                       >()
                 {
@@ -1292,13 +1310,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neuron_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
                         : CellNetworkIterator<
                               NeuronVertex,
                               typename Graph<Tn, Tv, Te>::Vertex,
                               NeuronVertex,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                              IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                              typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                               NeuronVertexPred
                           >(C, &(C->V), it, &(C->isNeuronVertex) )
                 {
@@ -1309,8 +1327,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                               NeuronVertex,
                               typename Graph<Tn, Tv, Te>::Vertex,
                               NeuronVertex,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                              IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                              typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                               NeuronVertexPred
                           >(x)
                 {
@@ -1360,8 +1378,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuronVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                 NeuronVertexPred
             > 
         {
@@ -1372,13 +1390,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neuron_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
                         : CellNetworkIterator<
                               const NeuronVertex,
                               typename Graph<Tn, Tv, Te>::Vertex,
                               NeuronVertex,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                              IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                              typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                               NeuronVertexPred
                           >(C, &(C->V), it, &(C->isNeuronVertex) )
                 {
@@ -1389,8 +1407,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                               const NeuronVertex,
                               typename Graph<Tn, Tv, Te>::Vertex,
                               NeuronVertex,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                              IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                              typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                               NeuronVertexPred
                           >(x)
                 {
@@ -1451,8 +1469,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 SomaVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                 SomaVertexPred
             > 
         {
@@ -1462,8 +1480,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             SomaVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             SomaVertexPred
                     >()
                 {
@@ -1471,13 +1489,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 soma_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
                         : CellNetworkIterator<
                             SomaVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             SomaVertexPred
                         >(C, &(C->V), it, &(C->isSomaVertex) )
                 {
@@ -1488,8 +1506,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             SomaVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             SomaVertexPred
                         >(x)
                 {
@@ -1505,8 +1523,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const SomaVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                 SomaVertexPred
             > 
         {
@@ -1517,13 +1535,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 soma_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
                         : CellNetworkIterator<
                                 const SomaVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                                 SomaVertexPred
                         >(C, &(C->V), it, &(C->isSomaVertex) )
                 {
@@ -1534,8 +1552,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 const SomaVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                                 SomaVertexPred
                         >(x)
                 {
@@ -1562,8 +1580,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                 NeuriteVertexPred
             > 
         {
@@ -1573,8 +1591,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             NeuriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             NeuriteVertexPred
                       >()
                 {
@@ -1582,13 +1600,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
                         : CellNetworkIterator<
                             NeuriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             NeuriteVertexPred
                         >(C, &(C->V), it, &(C->isNeuriteVertex) )
                 {
@@ -1599,8 +1617,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             NeuriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             NeuriteVertexPred
                         >(x)
                 {
@@ -1634,8 +1652,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                 NeuriteVertexPred
             > 
         {
@@ -1646,13 +1664,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
                         : CellNetworkIterator<
                                 const NeuriteVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                                 NeuriteVertexPred
                           >(C, &(C->V), it, &(C->isNeuriteVertex) )
                 {
@@ -1663,8 +1681,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 const NeuriteVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                                 NeuriteVertexPred
                           >(x)
                 {
@@ -1709,8 +1727,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                 AxonVertexPred
             > 
         {
@@ -1720,8 +1738,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             AxonVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             AxonVertexPred
                       >()
                 {
@@ -1729,13 +1747,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
                         : CellNetworkIterator<
                             AxonVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             AxonVertexPred
                         >(C, &(C->V), it, &(C->isAxonVertex) )
                 {
@@ -1746,8 +1764,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             AxonVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             AxonVertexPred
                         >(x)
                 {
@@ -1763,8 +1781,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const AxonVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                 AxonVertexPred
             > 
         {
@@ -1775,13 +1793,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
                         : CellNetworkIterator<
                                 const AxonVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                                 AxonVertexPred
                           >(C, &(C->V), it, &(C->isAxonVertex) )
                 {
@@ -1792,8 +1810,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 const AxonVertex,
                                 typename Graph<Tn, Tv, Te>::Vertex,
                                 NeuronVertex,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                                 AxonVertexPred
                           >(x)
                 {
@@ -1820,8 +1838,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                 DendriteVertexPred
             > 
         {
@@ -1831,8 +1849,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             DendriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             DendriteVertexPred
                       >()
                 {
@@ -1840,13 +1858,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_iterator(
                     CellNetwork                                                                            *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator    it)
                         : CellNetworkIterator<
                             DendriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             DendriteVertexPred
                         >(C, &(C->V), it, &(C->isDendriteVertex) )
                 {
@@ -1857,8 +1875,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             DendriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::iterator,
                             DendriteVertexPred
                         >(x)
                 {
@@ -1874,8 +1892,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const DendriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                 DendriteVertexPred
             > 
         {
@@ -1886,13 +1904,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator  it)
                         : CellNetworkIterator<
                             const DendriteVertex,
                             typename Graph<Tn, Tv, Te>::Vertex,
                             NeuronVertex,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                             DendriteVertexPred
                         >(C, &(C->V), it, &(C->isDendriteVertex) )
                 {
@@ -1903,8 +1921,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         const DendriteVertex,
                         typename Graph<Tn, Tv, Te>::Vertex,
                         NeuronVertex,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
+                        IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                        typename IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>::const_iterator,
                         DendriteVertexPred
                     >(x)
                 {
@@ -1935,8 +1953,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuronEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                 NeuronEdgePred
             > 
         {
@@ -1946,8 +1964,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         NeuronEdge,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                        typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                         NeuronEdgePred
                       >()
                 {
@@ -1955,13 +1973,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neuron_edge_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
                         :   CellNetworkIterator<
                                 NeuronEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 NeuronEdgePred
                             >(C, &(C->E), it, &(C->isNeuronEdge) )
                 {
@@ -1972,8 +1990,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 NeuronEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 NeuronEdgePred
                             >(x)
                 {
@@ -2040,8 +2058,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuronEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                 NeuronEdgePred
             > 
         {
@@ -2052,13 +2070,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neuron_edge_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
                         : CellNetworkIterator<
                             const NeuronEdge,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             NeuronEdgePred
                         >(C, &(C->E), it, &(C->isNeuronEdge) )
                 {
@@ -2069,8 +2087,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const NeuronEdge,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             NeuronEdgePred
                         >(x)
                 {
@@ -2140,8 +2158,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                 NeuriteRootEdgePred
             > 
         {
@@ -2151,8 +2169,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         NeuriteRootEdge,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                        typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                         NeuriteRootEdgePred
                       >()
                 {
@@ -2160,13 +2178,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_rootedge_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
                         :   CellNetworkIterator<
                                 NeuriteRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 NeuriteRootEdgePred
                             >(C, &(C->E), it, &(C->isNeuriteRootEdge) )
                 {
@@ -2177,8 +2195,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 NeuriteRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 NeuriteRootEdgePred
                             >(x)
                 {
@@ -2212,8 +2230,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                 NeuriteRootEdgePred
             > 
         {
@@ -2224,13 +2242,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_rootedge_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
                         : CellNetworkIterator<
                             const NeuriteRootEdge,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             NeuriteRootEdgePred
                         >(C, &(C->E), it, &(C->isNeuriteRootEdge) )
                 {
@@ -2241,8 +2259,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const NeuriteRootEdge,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             NeuriteRootEdgePred
                         >(x)
                 {
@@ -2287,8 +2305,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                 AxonRootEdgePred
             > 
         {
@@ -2298,8 +2316,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         AxonRootEdge,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                        typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                         AxonRootEdgePred
                       >()
                 {
@@ -2307,13 +2325,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_rootedge_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
                         :   CellNetworkIterator<
                                 AxonRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 AxonRootEdgePred
                             >(C, &(C->E), it, &(C->isAxonRootEdge) )
                 {
@@ -2324,8 +2342,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 AxonRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 AxonRootEdgePred
                             >(x)
                 {
@@ -2341,8 +2359,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const AxonRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                 AxonRootEdgePred
             > 
         {
@@ -2353,13 +2371,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_rootedge_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
                         : CellNetworkIterator<
                               const AxonRootEdge,
                               typename Graph<Tn, Tv, Te>::Edge,
                               NeuronEdge,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                              IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                              typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                               AxonRootEdgePred
                           >(C, &(C->E), it, &(C->isAxonRootEdge) )
                 {
@@ -2370,8 +2388,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                               const AxonRootEdge,
                               typename Graph<Tn, Tv, Te>::Edge,
                               NeuronEdge,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                              IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                              typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                               AxonRootEdgePred
                           >(x)
                 {
@@ -2398,8 +2416,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                 DendriteRootEdgePred
             > 
         {
@@ -2409,8 +2427,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         DendriteRootEdge,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                        typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                         DendriteRootEdgePred
                       >()
                 {
@@ -2418,13 +2436,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_rootedge_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
                         :   CellNetworkIterator<
                                 DendriteRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 DendriteRootEdgePred
                             >(C, &(C->E), it, &(C->isDendriteRootEdge) )
                 {
@@ -2435,8 +2453,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 DendriteRootEdge,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 DendriteRootEdgePred
                             >(x)
                 {
@@ -2452,8 +2470,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const DendriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                 DendriteRootEdgePred
             > 
         {
@@ -2464,13 +2482,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_rootedge_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
                         : CellNetworkIterator<
                               const DendriteRootEdge,
                               typename Graph<Tn, Tv, Te>::Edge,
                               NeuronEdge,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                              IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                              typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                               DendriteRootEdgePred
                           >(C, &(C->E), it, &(C->isDendriteRootEdge) )
                 {
@@ -2481,8 +2499,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                               const DendriteRootEdge,
                               typename Graph<Tn, Tv, Te>::Edge,
                               NeuronEdge,
-                              std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                              typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                              IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                              typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                               DendriteRootEdgePred
                           >(x)
                 {
@@ -2509,8 +2527,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                 NeuriteSegmentPred
             > 
         {
@@ -2520,8 +2538,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         NeuriteSegment,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                        typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                         NeuriteSegmentPred
                       >()
                 {
@@ -2529,13 +2547,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_segment_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
                         :   CellNetworkIterator<
                                 NeuriteSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 NeuriteSegmentPred
                             >(C, &(C->E), it, &(C->isNeuriteSegment) )
                 {
@@ -2546,8 +2564,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 NeuriteSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 NeuriteSegmentPred
                             >(x)
                 {
@@ -2598,8 +2616,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const NeuriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                 NeuriteSegmentPred
             > 
         {
@@ -2610,13 +2628,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 neurite_segment_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
                         : CellNetworkIterator<
                             const NeuriteSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             NeuriteSegmentPred
                         >(C, &(C->E), it, &(C->isNeuriteSegment) )
                 {
@@ -2627,8 +2645,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const NeuriteSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             NeuriteSegmentPred
                         >(x)
                 {
@@ -2682,8 +2700,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                 AxonSegmentPred
             > 
         {
@@ -2693,8 +2711,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         AxonSegment,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                        typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                         AxonSegmentPred
                       >()
                 {
@@ -2702,13 +2720,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_segment_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
                         :   CellNetworkIterator<
                                 AxonSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 AxonSegmentPred
                             >(C, &(C->E), it, &(C->isAxonSegment) )
                 {
@@ -2719,8 +2737,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 AxonSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 AxonSegmentPred
                             >(x)
                 {
@@ -2736,8 +2754,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const AxonSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                 AxonSegmentPred
             > 
         {
@@ -2748,13 +2766,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 axon_segment_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
                         : CellNetworkIterator<
                             const AxonSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             AxonSegmentPred
                         >(C, &(C->E), it, &(C->isAxonSegment) )
                 {
@@ -2765,8 +2783,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const AxonSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             AxonSegmentPred
                         >(x)
                 {
@@ -2793,8 +2811,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                 DendriteSegmentPred
             > 
         {
@@ -2804,8 +2822,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                         DendriteSegment,
                         typename Graph<Tn, Tv, Te>::Edge,
                         NeuronEdge,
-                        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                        typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                        typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                         DendriteSegmentPred
                       >()
                 {
@@ -2813,13 +2831,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_segment_iterator(
                     CellNetwork                                                                        *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator  it)
                         :   CellNetworkIterator<
                                 DendriteSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 DendriteSegmentPred
                             >(C, &(C->E), it, &(C->isDendriteSegment) )
                 {
@@ -2830,8 +2848,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                                 DendriteSegment,
                                 typename Graph<Tn, Tv, Te>::Edge,
                                 NeuronEdge,
-                                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
+                                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::iterator,
                                 DendriteSegmentPred
                             >(x)
                 {
@@ -2847,8 +2865,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 const DendriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                 DendriteSegmentPred
             > 
         {
@@ -2859,13 +2877,13 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
                 dendrite_segment_const_iterator(
                     CellNetwork                                                                                *C,
-                    typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
+                    typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator    it)
                         : CellNetworkIterator<
                             const DendriteSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             DendriteSegmentPred
                         >(C, &(C->E), it, &(C->isDendriteSegment) )
                 {
@@ -2876,8 +2894,8 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                             const DendriteSegment,
                             typename Graph<Tn, Tv, Te>::Edge,
                             NeuronEdge,
-                            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
-                            typename std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
+                            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                            typename IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>::const_iterator,
                             DendriteSegmentPred
                         >(x)
                 {
@@ -2902,7 +2920,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             NeuronEdge,
             typename Graph<Tn, Tv, Te>::Edge,
             NeuronEdge,
-            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
             NeuronEdgePred
         > neuron_edge_iteartor;
 
@@ -2910,7 +2928,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
             NeuriteSegment,
             typename Graph<Tn, Tv, Te>::Edge,
             NeuronEdge,
-            std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+            IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
             NeuriteSegmentPred
         > neurite_segment_iterator;
 
@@ -2922,7 +2940,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
          *
          * it relies and depends on the internally used data structure for vertices / edges
          *
-         *      std::map<uint32_t, {Vertex, Edge, Soma, NeuriteSegment, ...}PointerType>
+         *      IdSlotMap<{Vertex, Edge, Soma, NeuriteSegment, ...}PointerType>
          *
          * it contains the code shared between all accessors for specific vertex / edge types. since
          * explicit down-casting should be avoided as far as possible, an individual accessor will
@@ -3006,7 +3024,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuronVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
                 NeuronVertexPred,
                 neuron_iterator,
                 neuron_const_iterator,
@@ -3035,7 +3053,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
                 NeuriteVertexPred,
                 neurite_iterator,
                 neurite_const_iterator,
@@ -3065,7 +3083,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 SomaVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
                 SomaVertexPred,
                 soma_iterator,
                 soma_const_iterator,
@@ -3100,7 +3118,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
                 AxonVertexPred,
                 axon_iterator,
                 axon_const_iterator,
@@ -3136,7 +3154,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteVertex,
                 typename Graph<Tn, Tv, Te>::Vertex,
                 NeuronVertex,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
                 DendriteVertexPred,
                 dendrite_iterator,
                 dendrite_const_iterator,
@@ -3177,7 +3195,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuronEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
                 NeuronEdgePred,
                 neuron_edge_iterator,
                 neuron_edge_const_iterator,
@@ -3207,7 +3225,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
                 NeuriteRootEdgePred,
                 neurite_rootedge_iterator,
                 neurite_rootedge_const_iterator,
@@ -3247,7 +3265,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
                 AxonRootEdgePred,
                 axon_rootedge_iterator,
                 axon_rootedge_const_iterator,
@@ -3281,7 +3299,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteRootEdge,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
                 DendriteRootEdgePred,
                 dendrite_rootedge_iterator,
                 dendrite_rootedge_const_iterator,
@@ -3316,7 +3334,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 NeuriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
                 NeuriteSegmentPred,
                 neurite_segment_iterator,
                 neurite_segment_const_iterator,
@@ -3363,7 +3381,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 AxonSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
                 AxonSegmentPred,
                 axon_segment_iterator,
                 axon_segment_const_iterator,
@@ -3395,7 +3413,7 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
                 DendriteSegment,
                 typename Graph<Tn, Tv, Te>::Edge,
                 NeuronEdge,
-                std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+                IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
                 DendriteSegmentPred,
                 dendrite_segment_iterator,
                 dendrite_segment_const_iterator,
@@ -3421,24 +3439,6 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
         };
 
     protected:
-        /* struct used for SWC parsing */
-        struct SWCNode {
-            uint32_t                compartment_id;
-            uint32_t                compartment_type;
-            int32_t                 parent_id;
-            std::list<CellSection>  sections;
-            std::list<uint32_t>     child_ids;
-
-            SWCNode(
-                    uint32_t                        _compartment_id,
-                    uint32_t                        _compartment_type,
-                    int32_t                         _parent_id,
-                    std::list<CellSection> const&   _sections)
-            : compartment_id(_compartment_id), compartment_type(_compartment_type),
-              parent_id(_parent_id), sections(_sections)
-            {}
-        };
-
         /* enum for compartment types */
         enum SWCCompartmentTypes {
             SOMA_COMPARTMENT            = 1,
@@ -3735,6 +3735,30 @@ class CellNetwork : public Graph<Tn, Tv, Te> {
 
         Vec3<R>                                     getGlobalCoordinateDisplacement() const;
         /* -----------------------------------  I / O  ------------------------------------------------------------- */
+        /* flat node arrays of an SWC file, indexed by 0-based compartment id. the children of node i are
+         * child_ids[child_offsets[i] .. child_offsets[i + 1]) in ascending order, roots (parent id -1) are listed in
+         * root_ids in ascending order. */
+        struct SWCData {
+            std::vector<uint32_t>   compartment_type;
+            std::vector<int32_t>    parent_id;
+            std::vector<Vec3<R>>    pos;
+            std::vector<R>          radius;
+            std::vector<uint32_t>   child_offsets;
+            std::vector<uint32_t>   child_ids;
+            std::vector<uint32_t>   root_ids;
+
+            uint32_t                size() const
+                                    {
+                                        return this->parent_id.size();
+                                    }
+        };
+
+        /* read SWC file in one block and parse it into swc in a single pass over the data. the child lists are
+         * built with a counting sort over the parent ids. */
+        static void                                 readSWCData(
+                                                        std::string const  &filename,
+                                                        SWCData            &swc);
+
         /* initialize network from standardized SWC file as used by NeuroMorpho.org */
         void                                        readFromNeuroMorphoSWCFile(
                                                         std::string     filename,
@@ -49,6 +49,8 @@
 
 #include "common.hh"
 #include "IdQueue.hh"
+#include "IdSlotMap.hh"
+#include "SmallVector.hh"
 #include "Octree.hh"
 
 enum graph_error_types {
@@ -266,6 +268,9 @@ class Graph {
         typedef Graph<Tg, Tv, Te>::Vertex *      VertexPointerType;    
         typedef Graph<Tg, Tv, Te>::Edge *        EdgePointerType;    
 
+        /* incidence lists of vertices */
+        typedef SmallVector<Edge *, 3>          IncidenceList;
+
     public:
         /* NOTE: typdefs are not treated as full types by either the standard or compilers. for
          * more type safety, declare vertex_iterator as template specialization of GraphIterator
@@ -274,14 +279,14 @@ class Graph {
         typedef
             GraphIterator<
                 Vertex,
-                std::map<uint32_t, VertexPointerType >
+                IdSlotMap<VertexPointerType>
             >   vertex_iterator;
         */
 
         class   vertex_iterator :
             public GraphIterator<
                 Graph<Tg, Tv, Te>::Vertex,
-                typename std::map<uint32_t, VertexPointerType>::iterator
+                typename IdSlotMap<VertexPointerType>::iterator
             >
         {
             public:
@@ -291,7 +296,7 @@ class Graph {
 
                 vertex_iterator(
                     Graph<Tg, Tv, Te>                                          *g,
-                    typename std::map<uint32_t, VertexPointerType >::iterator   it)
+                    typename IdSlotMap<VertexPointerType>::iterator   it)
                 {
                     this->graph     = g;
                     this->int_it    = it;
@@ -301,7 +306,7 @@ class Graph {
                 vertex_iterator(const vertex_iterator &x)
                     : GraphIterator<
                         Graph<Tg, Tv, Te>::Vertex,
-                        typename std::map<uint32_t, VertexPointerType>::iterator
+                        typename IdSlotMap<VertexPointerType>::iterator
                       >()
                 {
                     this->graph     = x.graph;
@@ -316,7 +321,7 @@ class Graph {
         class   vertex_const_iterator :
             public GraphIterator<
                 const Graph<Tg, Tv, Te>::Vertex,
-                typename std::map<uint32_t, VertexPointerType >::const_iterator
+                typename IdSlotMap<VertexPointerType>::const_iterator
             >
         {
             public:
@@ -326,7 +331,7 @@ class Graph {
 
                 vertex_const_iterator(
                     Graph<Tg, Tv, Te>                                                  *g,
-                    typename std::map<uint32_t, VertexPointerType >::const_iterator     it)
+                    typename IdSlotMap<VertexPointerType>::const_iterator     it)
                 {
                     this->graph     = g;
                     this->int_it    = it;
@@ -336,7 +341,7 @@ class Graph {
                 vertex_const_iterator(const vertex_const_iterator &x)
                     :  GraphIterator<
                         const Graph<Tg, Tv, Te>::Vertex,
-                        typename std::map<uint32_t, VertexPointerType>::const_iterator
+                        typename IdSlotMap<VertexPointerType>::const_iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -349,7 +354,7 @@ class Graph {
                 vertex_const_iterator(const vertex_iterator &x)
                     :  GraphIterator<
                         const Graph<Tg, Tv, Te>::Vertex,
-                        typename std::map<uint32_t, VertexPointerType>::const_iterator
+                        typename IdSlotMap<VertexPointerType>::const_iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -368,14 +373,14 @@ class Graph {
         /*
         typedef GraphIterator<
                 Edge,
-                std::map<uint32_t, EdgePointerType >
+                IdSlotMap<EdgePointerType>
             > edge_iterator;
         */
 
         class   edge_iterator :
             public GraphIterator<
                 Graph<Tg, Tv, Te>::Edge,
-                typename std::map<uint32_t, EdgePointerType>::iterator
+                typename IdSlotMap<EdgePointerType>::iterator
             >
         {
             public:
@@ -385,7 +390,7 @@ class Graph {
 
                 edge_iterator(
                     Graph<Tg, Tv, Te>                                          *g,
-                    typename std::map<uint32_t, EdgePointerType >::iterator     it)
+                    typename IdSlotMap<EdgePointerType>::iterator     it)
                 {
                     this->graph     = g;
                     this->int_it    = it;
@@ -395,7 +400,7 @@ class Graph {
                 edge_iterator(const edge_iterator &x)
                     :  GraphIterator<
                         Graph<Tg, Tv, Te>::Edge,
-                        typename std::map<uint32_t, EdgePointerType>::iterator
+                        typename IdSlotMap<EdgePointerType>::iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -410,7 +415,7 @@ class Graph {
         class edge_const_iterator :
             public GraphIterator<
                 const Graph<Tg, Tv, Te>::Edge,
-                typename std::map<uint32_t, EdgePointerType>::const_iterator
+                typename IdSlotMap<EdgePointerType>::const_iterator
             >
         {
             public:
@@ -420,7 +425,7 @@ class Graph {
 
                 edge_const_iterator(
                     Graph<Tg, Tv, Te>                                              *g,
-                    typename std::map<uint32_t, EdgePointerType >::const_iterator   it)
+                    typename IdSlotMap<EdgePointerType>::const_iterator   it)
                 {
                     this->graph     = g;
                     this->int_it    = it;
@@ -430,7 +435,7 @@ class Graph {
                 edge_const_iterator(const edge_const_iterator &x)
                     : GraphIterator<
                         const Graph<Tg, Tv, Te>::Edge,
-                        typename std::map<uint32_t, EdgePointerType>::const_iterator
+                        typename IdSlotMap<EdgePointerType>::const_iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -443,7 +448,7 @@ class Graph {
                 edge_const_iterator(const edge_iterator &x)
                     : GraphIterator<
                         const Graph<Tg, Tv, Te>::Edge,
-                        typename std::map<uint32_t, EdgePointerType>::const_iterator
+                        typename IdSlotMap<EdgePointerType>::const_iterator
                     > ()
                 {
                     this->graph     = x.graph;
@@ -486,13 +491,14 @@ class Graph {
 
             protected:
                 Graph<Tg, Tv, Te>                  *graph;
-                typename std::map<
-                    uint32_t,
+                typename IdSlotMap<
                     VertexPointerType >::iterator   g_vit;
 
                 uint32_t                            blocked : 1,  current_traversal_id : 23, traversal_state : 8;
 
-                std::list<Edge *>                   in_edges, out_edges;
+                /* incident edges sorted by id. nearly all vertices of neuron morphologies have at most
+                 * three incident edges, which are then stored inside the vertex. */
+                IncidenceList                       in_edges, out_edges;
 
                 /* protected ctors */
                                                     Vertex();
@@ -518,7 +524,7 @@ class Graph {
                 Tv                                  vertex_data;
 
                 /* static getPtr() method required by iterator */
-                static Vertex *                     getPtr(typename std::map<uint32_t, VertexPointerType >::const_iterator const &it);
+                static Vertex *                     getPtr(typename IdSlotMap<VertexPointerType>::const_iterator const &it);
 
                 uint32_t
                 id() const
@@ -689,8 +695,7 @@ class Graph {
 
             protected:
                 Graph<Tg, Tv, Te>                  *graph;
-                typename std::map<
-                    uint32_t,
+                typename IdSlotMap<
                     EdgePointerType
                 >::iterator                         g_eit;
 
@@ -718,7 +723,7 @@ class Graph {
                 Te                                  edge_data;
 
                 /* static getPtr() method required by iterator */
-                static Edge *                       getPtr(typename std::map<uint32_t, EdgePointerType >::const_iterator const &it);
+                static Edge *                       getPtr(typename IdSlotMap<EdgePointerType>::const_iterator const &it);
 
                 uint32_t                            id() const;
                 edge_iterator                       iterator() const;
@@ -862,14 +867,8 @@ class Graph {
         Tg                                  graph_data;
 
         /* vertex and face maps */
-        std::map<
-                uint32_t,
-                VertexPointerType
-            >                               V;
-        std::map<
-                uint32_t,
-                EdgePointerType
-            >                               E;
+        IdSlotMap<VertexPointerType>        V;
+        IdSlotMap<EdgePointerType>          E;
 
         /* globally reset the traversal states of all vertices and faces to TRAV_UNSEEN and reset
          * the traversal id queue. */
@@ -883,36 +882,36 @@ class Graph {
          * all topological information inside the given vertex are erased (incident edges), the edge insertion method
          * takes two ids along with the pointer to verify that the allocated edge is indeed topologically intact. */
         std::pair<
-                typename std::map<uint32_t, VertexPointerType>::iterator,
+                typename IdSlotMap<VertexPointerType>::iterator,
                 bool
             >                               protectedVertexInsert(Vertex *v);
 
         std::pair<
-                typename std::map<uint32_t, EdgePointerType>::iterator,
+                typename IdSlotMap<EdgePointerType>::iterator,
                 bool
             >                               protectedEdgeInsert(
                                                 Edge       *e,
                                                 uint32_t    v_src_id,
                                                 uint32_t    v_dst_id);
 
-        /* protected static methods to extract internal std::map<..,..> iterators from Graph::{vertex,edge}_iterators */
-        static typename std::map<
-                uint32_t,
+        /* sorted insertion into / removal from incidence lists of vertices */
+        static bool                         incidenceInsert(IncidenceList &l, Edge *e);
+        static bool                         incidenceRemove(IncidenceList &l, Edge *e);
+
+        /* protected static methods to extract internal IdSlotMap<..> iterators from Graph::{vertex,edge}_iterators */
+        static typename IdSlotMap<
                 VertexPointerType
             >::const_iterator               getInternalIterator(vertex_const_iterator const &it);
 
-        static typename std::map<
-                uint32_t,
+        static typename IdSlotMap<
                 VertexPointerType
             >::iterator                     getInternalIterator(vertex_iterator const &it);
 
-        static typename std::map<
-                uint32_t,
+        static typename IdSlotMap<
                 EdgePointerType
             >::const_iterator               getInternalIterator(edge_const_iterator const &it);
 
-        static typename std::map<
-                uint32_t,
+        static typename IdSlotMap<
                 EdgePointerType
             >::iterator                     getInternalIterator(edge_iterator const &it);
 
@@ -62,6 +62,11 @@ class IdQueue {
         void        clear(uint32_t smallest_id = 0);
         uint32_t    getId();
         void        freeId(uint32_t id);
+
+        /* hand out the n consecutive ids smallest_id, .., smallest_id + n - 1 at once and return
+         * smallest_id. only allowed on a queue that hasn't handed out any id since construction or
+         * the last clear(). */
+        uint32_t    getIdBlock(uint32_t n);
         
 };
 
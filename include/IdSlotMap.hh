@@ -0,0 +1,384 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ID_SLOT_MAP
+#define ID_SLOT_MAP
+
+#include "common.hh"
+
+/* dense id-indexed slot array with the (small) subset of the std::map<uint32_t, T> interface used by
+ * Mesh. T must be a pointer type, a NULL entry marks a free slot. ids are handed out by an IdQueue,
+ * which always returns the smallest free id, so the slot array stays dense and freed slots act as
+ * a free list that is refilled first. compared to std::map, lookup is a single array access and
+ * iteration walks contiguous memory in ascending id order, i.e. in the same order as before.
+ *
+ * iterators store the container and the slot index instead of a pointer into the slot array, so
+ * they remain valid when the slot array is reallocated during insertion. as for std::map,
+ * iterators referring to erased elements are invalidated, all others remain valid. */
+template <typename T>
+class IdSlotMap {
+    public:
+        typedef std::pair<uint32_t, T>  value_type;
+
+    private:
+        std::vector<value_type>         slots;
+        size_t                          nelements;
+        /* lower bound for the index of the first occupied slot, advanced lazily in begin() */
+        mutable uint32_t                first_hint;
+
+        static const uint32_t           npos = std::numeric_limits<uint32_t>::max();
+
+        uint32_t
+        nextOccupied(uint32_t idx) const
+        {
+            while (idx < this->slots.size() && this->slots[idx].second == NULL) {
+                ++idx;
+            }
+            return (idx < this->slots.size() ? idx : npos);
+        }
+
+        uint32_t
+        prevOccupied(uint32_t idx) const
+        {
+            /* idx == npos => start with last slot */
+            if (idx == npos) {
+                idx = this->slots.size();
+            }
+            while (idx > 0) {
+                --idx;
+                if (this->slots[idx].second != NULL) {
+                    return idx;
+                }
+            }
+            return npos;
+        }
+
+    public:
+        /* iterator template for both iterator (C = IdSlotMap<T>) and const_iterator
+         * (C = const IdSlotMap<T>) */
+        template <typename C, typename V>
+        class slot_iterator : public std::iterator<std::bidirectional_iterator_tag, V> {
+            friend class IdSlotMap<T>;
+            template <typename C2, typename V2> friend class slot_iterator;
+
+            private:
+                C              *c;
+                uint32_t        idx;
+
+            public:
+                slot_iterator() : c(NULL), idx(npos) {}
+                slot_iterator(C *c, uint32_t idx) : c(c), idx(idx) {}
+
+                /* iterator -> const_iterator, as for std::map */
+                template <typename C2, typename V2>
+                slot_iterator(slot_iterator<C2, V2> const &x) : c(x.c), idx(x.idx) {}
+
+                inline V   &operator*() const   { return (this->c->slots[this->idx]); }
+                inline V   *operator->() const  { return &(this->c->slots[this->idx]); }
+
+                inline slot_iterator &
+                operator++()
+                {
+                    this->idx = this->c->nextOccupied(this->idx + 1);
+                    return (*this);
+                }
+
+                inline slot_iterator
+                operator++(int)
+                {
+                    slot_iterator tmp(*this);
+                    this->operator++();
+                    return tmp;
+                }
+
+                inline slot_iterator &
+                operator--()
+                {
+                    this->idx = this->c->prevOccupied(this->idx);
+                    return (*this);
+                }
+
+                inline slot_iterator
+                operator--(int)
+                {
+                    slot_iterator tmp(*this);
+                    this->operator--();
+                    return tmp;
+                }
+
+                inline bool operator==(const slot_iterator &x) const { return (this->idx == x.idx); }
+                inline bool operator!=(const slot_iterator &x) const { return (this->idx != x.idx); }
+        };
+
+        typedef slot_iterator<IdSlotMap<T>, value_type>                 iterator;
+        typedef slot_iterator<const IdSlotMap<T>, const value_type>     const_iterator;
+
+                                    IdSlotMap();
+
+        iterator                    begin();
+        const_iterator              begin() const;
+        iterator                    end();
+        const_iterator              end() const;
+        iterator                    find(uint32_t id);
+        /* first element with id >= given id */
+        iterator                    lower_bound(uint32_t id);
+        const_iterator              lower_bound(uint32_t id) const;
+        T                          &at(uint32_t id);
+        const T                    &at(uint32_t id) const;
+        bool                        exists(uint32_t id) const;
+
+        std::pair<iterator, bool>   insert(const value_type &x);
+        iterator                    erase(iterator it);
+        size_t                      erase(uint32_t id);
+
+        void                        clear();
+        void                        swap(IdSlotMap<T> &x);
+        void                        reserve(size_t n);
+
+        size_t                      size() const;
+        bool                        empty() const;
+        /* one past the largest id that can currently be stored without growing the slot array */
+        uint32_t                    idBound() const;
+};
+
+template <typename T>
+IdSlotMap<T>::IdSlotMap() : nelements(0), first_hint(0)
+{
+}
+
+template <typename T>
+typename IdSlotMap<T>::iterator
+IdSlotMap<T>::begin()
+{
+    this->first_hint = this->nextOccupied(this->first_hint);
+    if (this->first_hint == npos) {
+        this->first_hint = this->slots.size();
+        return this->end();
+    }
+    return iterator(this, this->first_hint);
+}
+
+template <typename T>
+typename IdSlotMap<T>::const_iterator
+IdSlotMap<T>::begin() const
+{
+    this->first_hint = this->nextOccupied(this->first_hint);
+    if (this->first_hint == npos) {
+        this->first_hint = this->slots.size();
+        return this->end();
+    }
+    return const_iterator(this, this->first_hint);
+}
+
+template <typename T>
+typename IdSlotMap<T>::iterator
+IdSlotMap<T>::end()
+{
+    return iterator(this, npos);
+}
+
+template <typename T>
+typename IdSlotMap<T>::const_iterator
+IdSlotMap<T>::end() const
+{
+    return const_iterator(this, npos);
+}
+
+template <typename T>
+typename IdSlotMap<T>::iterator
+IdSlotMap<T>::find(uint32_t id)
+{
+    if (this->exists(id)) {
+        return iterator(this, id);
+    }
+    else return this->end();
+}
+
+template <typename T>
+typename IdSlotMap<T>::iterator
+IdSlotMap<T>::lower_bound(uint32_t id)
+{
+    return iterator(this, this->nextOccupied(id));
+}
+
+template <typename T>
+typename IdSlotMap<T>::const_iterator
+IdSlotMap<T>::lower_bound(uint32_t id) const
+{
+    return const_iterator(this, this->nextOccupied(id));
+}
+
+template <typename T>
+T &
+IdSlotMap<T>::at(uint32_t id)
+{
+    if (!this->exists(id)) {
+        throw std::out_of_range("IdSlotMap::at(): no element with given id.");
+    }
+    return (this->slots[id].second);
+}
+
+template <typename T>
+const T &
+IdSlotMap<T>::at(uint32_t id) const
+{
+    if (!this->exists(id)) {
+        throw std::out_of_range("IdSlotMap::at(): no element with given id.");
+    }
+    return (this->slots[id].second);
+}
+
+template <typename T>
+bool
+IdSlotMap<T>::exists(uint32_t id) const
+{
+    return (id < this->slots.size() && this->slots[id].second != NULL);
+}
+
+template <typename T>
+std::pair<typename IdSlotMap<T>::iterator, bool>
+IdSlotMap<T>::insert(const value_type &x)
+{
+    const uint32_t id = x.first;
+
+    if (x.second == NULL || id == npos) {
+        throw std::invalid_argument("IdSlotMap::insert(): NULL element or invalid id.");
+    }
+
+    /* grow slot array if necessary. new slots are marked free with their own id */
+    if (id >= this->slots.size()) {
+        size_t old_size = this->slots.size();
+        this->slots.resize(id + 1);
+        for (size_t i = old_size; i < this->slots.size(); i++) {
+            this->slots[i].first = i;
+        }
+    }
+
+    if (this->slots[id].second != NULL) {
+        return std::make_pair(iterator(this, id), false);
+    }
+
+    this->slots[id].second = x.second;
+    this->nelements++;
+    if (id < this->first_hint) {
+        this->first_hint = id;
+    }
+    return std::make_pair(iterator(this, id), true);
+}
+
+template <typename T>
+typename IdSlotMap<T>::iterator
+IdSlotMap<T>::erase(iterator it)
+{
+    uint32_t id = it.idx;
+    this->slots[id].second = NULL;
+    this->nelements--;
+
+    /* drop trailing free slots, which keeps reverse iteration from end() cheap */
+    while (!this->slots.empty() && this->slots.back().second == NULL) {
+        this->slots.pop_back();
+    }
+    return iterator(this, this->nextOccupied(id + 1));
+}
+
+template <typename T>
+size_t
+IdSlotMap<T>::erase(uint32_t id)
+{
+    if (this->exists(id)) {
+        this->erase(iterator(this, id));
+        return 1;
+    }
+    else return 0;
+}
+
+template <typename T>
+void
+IdSlotMap<T>::clear()
+{
+    this->slots.clear();
+    this->nelements     = 0;
+    this->first_hint    = 0;
+}
+
+template <typename T>
+void
+IdSlotMap<T>::swap(IdSlotMap<T> &x)
+{
+    this->slots.swap(x.slots);
+    std::swap(this->nelements, x.nelements);
+    std::swap(this->first_hint, x.first_hint);
+}
+
+template <typename T>
+void
+IdSlotMap<T>::reserve(size_t n)
+{
+    this->slots.reserve(n);
+}
+
+template <typename T>
+size_t
+IdSlotMap<T>::size() const
+{
+    return this->nelements;
+}
+
+template <typename T>
+bool
+IdSlotMap<T>::empty() const
+{
+    return (this->nelements == 0);
+}
+
+template <typename T>
+uint32_t
+IdSlotMap<T>::idBound() const
+{
+    return this->slots.size();
+}
+
+#endif
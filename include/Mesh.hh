@@ -51,6 +51,8 @@
 #include "Vec3.hh"
 #include "BoundingBox.hh"
 #include "IdQueue.hh"
+#include "IdSlotMap.hh"
+#include "SlabPool.hh"
 #include "Octree.hh"
 
 enum mesh_error_types {
@@ -284,14 +286,22 @@ class Mesh {
                     //return (this->int_it->second.get());
                 }
         };
-        /* forward declaration of classes Vertex and Face */
+        /* forward declaration of classes Vertex, Face, Edge and TraversalStates */
         class   Vertex;
         class   Face;
+        class   Edge;
+        class   TraversalStates;
+
+        /* adjacency / incidence lists of vertices. their nodes are drawn from the per-mesh node
+         * pool Mesh::node_pool */
+        typedef std::list<Vertex *, SlabAllocator<Vertex *> >   VertexList;
+        typedef std::list<Face *, SlabAllocator<Face *> >       FaceList;
 
     private:
         /* typedefs for pointer typed internally used. could also be std::shared_ptr<..> with minor modifications */
         typedef Mesh<Tm, Tv, Tf, R>::Vertex *   VertexPointerType;    
         typedef Mesh<Tm, Tv, Tf, R>::Face *     FacePointerType;    
+        typedef Mesh<Tm, Tv, Tf, R>::Edge *     EdgePointerType;
 
     public:
         /* NOTE: typdefs are not treated as full types by either the standard or compilers. for
@@ -301,14 +311,14 @@ class Mesh {
         typedef
             MeshIterator<
                 Vertex,
-                std::map<uint32_t, VertexPointerType >
+                IdSlotMap<VertexPointerType>
             >   vertex_iterator;
         */
 
         class   vertex_iterator :
             public MeshIterator<
                 Mesh<Tm, Tv, Tf, R>::Vertex,
-                std::map<uint32_t, VertexPointerType>
+                IdSlotMap<VertexPointerType>
             >
         {
             public:
@@ -318,7 +328,7 @@ class Mesh {
 
                 vertex_iterator(
                     Mesh<Tm, Tv, Tf, R>                                        *m,
-                    typename std::map<uint32_t, VertexPointerType >::iterator   it)
+                    typename IdSlotMap<VertexPointerType>::iterator     it)
                 {
                     this->mesh      = m;
                     this->int_it    = it;
@@ -328,7 +338,7 @@ class Mesh {
                 vertex_iterator(const vertex_iterator &x)
                     : MeshIterator<
                         Mesh<Tm, Tv, Tf, R>::Vertex,
-                        std::map<uint32_t, VertexPointerType>
+                        IdSlotMap<VertexPointerType>
                       >()
                 {
                     this->mesh      = x.mesh;
@@ -343,7 +353,7 @@ class Mesh {
         class   vertex_const_iterator :
             public MeshIterator<
                 const Mesh<Tm, Tv, Tf, R>::Vertex,
-                std::map<uint32_t, VertexPointerType >
+                IdSlotMap<VertexPointerType>
             >
         {
             public:
@@ -353,7 +363,7 @@ class Mesh {
 
                 vertex_const_iterator(
                     Mesh<Tm, Tv, Tf, R>                                        *m,
-                    typename std::map<uint32_t, VertexPointerType >::iterator   it)
+                    typename IdSlotMap<VertexPointerType>::iterator     it)
                 {
                     this->mesh      = m;
                     this->int_it    = it;
@@ -363,7 +373,7 @@ class Mesh {
                 vertex_const_iterator(const vertex_const_iterator &x)
                     :  MeshIterator<
                         const Mesh<Tm, Tv, Tf, R>::Vertex,
-                        std::map<uint32_t, VertexPointerType >
+                        IdSlotMap<VertexPointerType>
                     > ()
                 {
                     this->mesh      = x.mesh;
@@ -376,7 +386,7 @@ class Mesh {
                 vertex_const_iterator(const vertex_iterator &x)
                     :  MeshIterator<
                         const Mesh<Tm, Tv, Tf, R>::Vertex,
-                        std::map<uint32_t, VertexPointerType >
+                        IdSlotMap<VertexPointerType>
                     > ()
                 {
                     this->mesh      = x.mesh;
@@ -395,14 +405,14 @@ class Mesh {
         /*
         typedef MeshIterator<
                 Face,
-                std::map<uint32_t, FacePointerType >
+                IdSlotMap<FacePointerType>
             > face_iterator;
         */
 
         class   face_iterator :
             public MeshIterator<
                 Mesh<Tm, Tv, Tf, R>::Face,
-                std::map<uint32_t, FacePointerType >
+                IdSlotMap<FacePointerType>
             >
         {
             public:
@@ -412,7 +422,7 @@ class Mesh {
 
                 face_iterator(
                     Mesh<Tm, Tv, Tf, R>                                        *m,
-                    typename std::map<uint32_t, FacePointerType >::iterator     it)
+                    typename IdSlotMap<FacePointerType>::iterator     it)
                 {
                     this->mesh      = m;
                     this->int_it    = it;
@@ -422,7 +432,7 @@ class Mesh {
                 face_iterator(const face_iterator &x)
                     :  MeshIterator<
                         Mesh<Tm, Tv, Tf, R>::Face,
-                        std::map<uint32_t, FacePointerType >
+                        IdSlotMap<FacePointerType>
                     > ()
                 {
                     this->mesh      = x.mesh;
@@ -437,7 +447,7 @@ class Mesh {
         class face_const_iterator :
             public MeshIterator<
                 const Mesh<Tm, Tv, Tf, R>::Face,
-                std::map<uint32_t, FacePointerType >
+                IdSlotMap<FacePointerType>
             >
         {
             public:
@@ -447,7 +457,7 @@ class Mesh {
 
                 face_const_iterator(
                     Mesh<Tm, Tv, Tf, R>                                        *m,
-                    typename std::map<uint32_t, FacePointerType >::iterator     it)
+                    typename IdSlotMap<FacePointerType>::iterator     it)
                 {
                     this->mesh      = m;
                     this->int_it    = it;
@@ -457,7 +467,7 @@ class Mesh {
                 face_const_iterator(const face_const_iterator &x)
                     : MeshIterator<
                         const Mesh<Tm, Tv, Tf, R>::Face,
-                        std::map<uint32_t, FacePointerType >
+                        IdSlotMap<FacePointerType>
                     > ()
                 {
                     this->mesh      = x.mesh;
@@ -470,7 +480,7 @@ class Mesh {
                 face_const_iterator(const face_iterator &x)
                     : MeshIterator<
                         const Mesh<Tm, Tv, Tf, R>::Face,
-                        std::map<uint32_t, FacePointerType >
+                        IdSlotMap<FacePointerType>
                     > ()
                 {
                     this->mesh      = x.mesh;
@@ -483,6 +493,87 @@ class Mesh {
                 }
         };
 
+        /* edge iterators, specialized from MeshIterator in the same way as vertex and face
+         * iterators */
+        class   edge_iterator :
+            public MeshIterator<
+                Mesh<Tm, Tv, Tf, R>::Edge,
+                IdSlotMap<EdgePointerType>
+            >
+        {
+            public:
+                edge_iterator()
+                {
+                }
+
+                edge_iterator(
+                    Mesh<Tm, Tv, Tf, R>                                        *m,
+                    typename IdSlotMap<EdgePointerType>::iterator     it)
+                {
+                    this->mesh      = m;
+                    this->int_it    = it;
+                }
+
+                edge_iterator(const edge_iterator &x)
+                    :  MeshIterator<
+                        Mesh<Tm, Tv, Tf, R>::Edge,
+                        IdSlotMap<EdgePointerType>
+                    > ()
+                {
+                    this->mesh      = x.mesh;
+                    this->int_it    = x.int_it;
+                }
+
+               ~edge_iterator()
+               {
+               }
+        };
+
+        class edge_const_iterator :
+            public MeshIterator<
+                const Mesh<Tm, Tv, Tf, R>::Edge,
+                IdSlotMap<EdgePointerType>
+            >
+        {
+            public:
+                edge_const_iterator()
+                {
+                }
+
+                edge_const_iterator(
+                    Mesh<Tm, Tv, Tf, R>                                        *m,
+                    typename IdSlotMap<EdgePointerType>::iterator     it)
+                {
+                    this->mesh      = m;
+                    this->int_it    = it;
+                }
+
+                edge_const_iterator(const edge_const_iterator &x)
+                    : MeshIterator<
+                        const Mesh<Tm, Tv, Tf, R>::Edge,
+                        IdSlotMap<EdgePointerType>
+                    > ()
+                {
+                    this->mesh      = x.mesh;
+                    this->int_it    = x.int_it;
+                }
+
+                /* implicit conversion of edge_iterator to edge_const_iterator */
+                edge_const_iterator(const edge_iterator &x)
+                    : MeshIterator<
+                        const Mesh<Tm, Tv, Tf, R>::Edge,
+                        IdSlotMap<EdgePointerType>
+                    > ()
+                {
+                    this->mesh      = x.mesh;
+                    this->int_it    = x.int_it;
+                }
+
+               ~edge_const_iterator()
+                {
+                }
+        };
+
         /* forward declaration of Mesh::VertexAccessor */
         class VertexAccessor;
 
@@ -513,22 +604,20 @@ class Mesh {
 
             private:
                 Mesh<Tm, Tv, Tf, R>                *mesh;
-                typename std::map<
-                    uint32_t,
-                    VertexPointerType >::iterator   m_vit;
-
-                Vec3<R>                             position;
+                /* the id doubles as the slot index in Mesh::V and Mesh::V_pos, the position
+                 * itself is stored in the mesh's contiguous position array */
+                uint32_t                            v_id;
                 uint32_t                            current_traversal_id : 23, traversal_state : 8;
                 Tv                                  data;
 
-                std::list<Vertex *>                 adjacent_vertices;
-                std::list<Face *>                   incident_faces;
+                VertexList                          adjacent_vertices;
+                FaceList                            incident_faces;
 
                 /* private ctors */
                                                     Vertex();
                                                     Vertex(
                                                         Mesh<Tm, Tv, Tf, R>    *mesh,
-                                                        const                   Vec3<R> &pos,
+                                                        uint32_t                id,
                                                         const Tv               *data = NULL);
                                                     Vertex(const Vertex &x);
 
@@ -536,15 +625,17 @@ class Mesh {
                 Vertex                             &operator=(const Vertex &x);
 
                 /* Vertex objects must not be publically allocated with new() or delete() => private
-                 * new and delete operators to prevent this at compile time. */
-                static void                        *operator new(size_t size);
-                static void                         operator delete(void *p);
+                 * new and delete operators to prevent this at compile time. vertices are allocated
+                 * from the vertex pool of the given mesh and destroyed with Mesh::destroyVertex(). */
+                static void                        *operator new(size_t size, Mesh<Tm, Tv, Tf, R> &m);
+                static void                         operator delete(void *p, Mesh<Tm, Tv, Tf, R> &m);
+                static void                         operator delete(void *p) = delete;
 
                 /* other private methods */
                 void                                replaceAdjacentVertices(const std::map<Vertex *, Vertex*> &replace_map);
 
                 /* static getPtr() method required by iterator */
-                static Vertex *                     getPtr(typename std::map<uint32_t, VertexPointerType >::iterator it);
+                static Vertex *                     getPtr(typename IdSlotMap<VertexPointerType>::iterator it);
 
                 /* private methods to insert / delete adjacent vertices / incident faces, which
                  * abstract from the internally used lists (used to be set for incident faces). this
@@ -565,31 +656,37 @@ class Mesh {
                 uint32_t
                 id() const
                 {
-                    return this->m_vit->first;
+                    return this->v_id;
                 }
 
                 Vec3<R>
                 pos() const
                 {
-                    return this->position;
+                    return this->mesh->V_pos[this->v_id];
                 }
 
+                /* NOTE: the returned reference is invalidated by vertex insertion, which might
+                 * reallocate the position array. */
                 Vec3<R> &
                 pos()
                 {
-                    return this->position;
+                    return this->mesh->V_pos[this->v_id];
                 }
 
+                /* unlike assignment through pos(), this records the old position in the undo
+                 * journal if the mesh has a checkpoint set. */
+                void                                setPos(const Vec3<R> &p);
+
                 vertex_iterator
                 iterator() const
                 {
-                    return vertex_iterator(this->mesh, this->m_vit);
+                    return vertex_iterator(this->mesh, typename IdSlotMap<VertexPointerType>::iterator(&(this->mesh->V), this->v_id));
                 }
 
                 vertex_const_iterator
                 const_iterator() const
                 {
-                    return vertex_iterator(this->mesh, this->m_vit);
+                    return this->iterator();
                 }
 
                 uint32_t
@@ -677,14 +774,14 @@ class Mesh {
                 }
                 */
 
-                const std::list<Vertex*>&           getVertexStar() const;
+                const VertexList&                   getVertexStar() const;
                 void                                getVertexStar(std::list<Vertex *> &vstar) const;
                 void                                getVertexStarIndices(std::list<uint32_t> &vstar) const;
                 void                                getVertexStarIndicesVector(std::vector<uint32_t>& vstar) const;
                 void                                getVertexStarIterators(std::list<vertex_iterator> &vstar) const;
                 
                 // way more efficient:
-                const std::list<Face*>&             getFaceStar() const;
+                const FaceList&                     getFaceStar() const;
                 void                                getFaceStar(std::list<Face *> &fstar) const;
                 void                                getFaceStar(std::list<Face const *> &fstar) const;
                 void                                getFaceStarIndices(std::list<uint32_t> &fstar) const;
@@ -729,10 +826,7 @@ class Mesh {
 
             private:
                 Mesh<Tm, Tv, Tf, R>                *mesh;
-                typename std::map<
-                    uint32_t,
-                    FacePointerType
-                >::iterator                         m_fit;
+                uint32_t                            f_id;
 
                 std::array<Vertex *,4>              vertices;
                 uint32_t                            quad : 1,  current_traversal_id : 23, traversal_state : 8;
@@ -752,8 +846,14 @@ class Mesh {
                                                     Face(const Face &x);
                 Face                               &operator=(const Face &b);
 
+                /* same as for Vertex: faces are allocated from the face pool of the given mesh and
+                 * destroyed with Mesh::destroyFace(). */
+                static void                        *operator new(size_t size, Mesh<Tm, Tv, Tf, R> &m);
+                static void                         operator delete(void *p, Mesh<Tm, Tv, Tf, R> &m);
+                static void                         operator delete(void *p) = delete;
+
                 /* static getPtr() method required by iterator */
-                static Face *                       getPtr(typename std::map<uint32_t, FacePointerType >::iterator it);
+                static Face *                       getPtr(typename IdSlotMap<FacePointerType>::iterator it);
 
                 void                                replaceVertices(const std::map<Vertex *, Vertex*> &replace_map);
                 bool                                operator<(const Face &b) const;
@@ -789,8 +889,14 @@ class Mesh {
                 Vec3<R>                             getNormal() const;
                 BoundingBox<R>                      getBoundingBox() const;
                 void                                getEdges(std::list<std::pair<vertex_iterator, vertex_iterator> > &edge_list) const;
+                /* edges of the face in order, read off the edge index, which must be enabled */
+                void                                getEdges(std::vector<Edge *> &edges) const;
                 void                                getFaceNeighbours(std::vector<Face*>& nb_faces) const;
                 void                                getFaceNeighbourhood(uint32_t max_depth, std::vector<Face*> &face_neighbourhood);
+                void                                getFaceNeighbourhood(
+                                                        uint32_t                max_depth,
+                                                        std::vector<Face*>     &face_neighbourhood,
+                                                        TraversalStates        &states);
                 void                                invertOrientation();
 
                 /* triangle-specific methods */
@@ -916,7 +1022,52 @@ class Mesh {
 
         };
 
-        /* ------------------ Accessor classes for vertices / faces ------------- */
+        /* edge class. edges exist as objects only while the edge index is enabled (see
+         * enableEdgeIndex()), which creates, updates and erases them along with all topological
+         * modifications. an edge keeps its id for as long as it exists, the ids of erased edges
+         * are reused for edges created later on. this also applies to edges that temporarily lose
+         * all their faces while a face is re-registered, e.g. border edges of faces affected by
+         * collapseTriEdge(). the first two incident faces are stored inline, only non-manifold
+         * edges spill over into f_more. */
+        class Edge {
+            friend class Mesh<Tm, Tv, Tf, R>;
+
+            private:
+                Mesh<Tm, Tv, Tf, R>                *mesh;
+                uint32_t                            e_id;
+                Vertex                             *u, *v;
+                uint32_t                            n;
+                Face                               *f[2];
+                std::vector<Face *>                 f_more;
+
+                /* static getPtr() method required by iterator */
+                static Edge *                       getPtr(typename IdSlotMap<EdgePointerType>::iterator it);
+
+            public:
+                /* public only since edges are default-constructed inside the edge index map */
+                                                    Edge() : mesh(NULL), e_id(0), u(NULL), v(NULL), n(0) { f[0] = f[1] = NULL; }
+
+                uint32_t
+                id() const
+                {
+                    return this->e_id;
+                }
+
+                edge_iterator                       iterator() const;
+
+                /* end points of the edge, u being the one with the smaller id */
+                void                                getVertices(Vertex *&u, Vertex *&v) const;
+                void                                getIterators(vertex_iterator &u_it, vertex_iterator &v_it) const;
+                void                                getIndices(uint32_t &u_id, uint32_t &v_id) const;
+
+                /* incident faces. getFaces() reports them in ascending id order. */
+                uint32_t                            numFaces() const;
+                void                                getFaces(std::vector<Face *> &faces) const;
+                bool                                isBorderEdge() const;
+                bool                                isManifoldEdge() const;
+        };
+
+        /* ------------------ Accessor classes for vertices / faces / edges ----- */
         class VertexAccessor {
             friend class Mesh<Tm, Tv, Tf, R>;
 
@@ -994,6 +1145,47 @@ class Mesh {
                 bool                        empty() const;
         };
 
+        /* read-only access to the edges of the edge index. all methods throw if the index is
+         * disabled. edges are iterated in ascending id order. lowerBound() and idBound() split the
+         * edges into disjoint id ranges, e.g. for parallel loops: chunk c of n covers
+         * [lowerBound(c * idBound() / n), lowerBound((c + 1) * idBound() / n)). */
+        class EdgeAccessor {
+            friend class Mesh<Tm, Tv, Tf, R>;
+
+            private:
+                Mesh<Tm, Tv, Tf, R>        &mesh;
+
+                /* private constructor, can only be called by Mesh */
+                                            EdgeAccessor(Mesh<Tm, Tv, Tf, R> &m);
+                /* not assignable, not copy-constructible */
+                EdgeAccessor               &operator=(const EdgeAccessor &x) = delete;
+                                            EdgeAccessor(const EdgeAccessor &x) = delete;
+
+                void                        checkEnabled(const char *fn) const;
+
+            public:
+                edge_iterator               begin();
+                edge_const_iterator         begin() const;
+
+                edge_iterator               end();
+                edge_const_iterator         end() const;
+
+                edge_iterator               find(const uint32_t &id);
+                edge_const_iterator         find(const uint32_t &id) const;
+                edge_iterator               find(const vertex_const_iterator &u_it, const vertex_const_iterator &v_it);
+                edge_const_iterator         find(const vertex_const_iterator &u_it, const vertex_const_iterator &v_it) const;
+
+                edge_iterator               lowerBound(const uint32_t &id);
+                edge_const_iterator         lowerBound(const uint32_t &id) const;
+                uint32_t                    idBound() const;
+
+                Mesh::Edge                 &at(const uint32_t &id);
+                bool                        exists(const uint32_t &id) const;
+
+                size_t                      size() const;
+                bool                        empty() const;
+        };
+
 
     private:
         /* structs used for the template types of the employed Octree */
@@ -1020,15 +1212,107 @@ class Mesh {
         IdQueue                             F_idq;
         IdQueue                             traversal_idq;
 
-        /* vertex and face maps */
-        std::map<
-                uint32_t,
-                VertexPointerType
-            >                               V;
-        std::map<
-                uint32_t,
-                FacePointerType
-            >                               F;
+        /* vertex and face slot arrays indexed by id. vertex positions are kept in a separate
+         * contiguous array with the same indexing, so that geometric sweeps over all vertices
+         * don't touch any topology information. */
+        IdSlotMap<VertexPointerType>        V;
+        IdSlotMap<FacePointerType>          F;
+        std::vector<Vec3<R>>                V_pos;
+
+        /* slab pools for Vertex and Face objects and for the nodes of the adjacency / incidence
+         * lists. clear() and the dtor return the slabs to the system as a whole. */
+        SlabPool                            vertex_pool;
+        SlabPool                            face_pool;
+        SlabPool                            node_pool;
+
+        /* the lists of a mesh copied with operator=() / copyAppend() are built by several threads,
+         * each of which draws the list nodes from a pool of its own, since SlabPool is not
+         * thread-safe. the pools live as long as the lists and are released by clear(). */
+        std::vector<std::unique_ptr<SlabPool>>
+                                            copy_node_pools;
+
+        void                                destroyVertex(Vertex *v);
+        void                                destroyFace(Face *f);
+        void                                releaseCopyNodePools();
+
+        /* parallel part of operator=() / copyAppend(): clone X_vertices / X_faces into the already
+         * allocated new_vertices / new_faces, which are mapped by X's ids in v_of_xid / f_of_xid,
+         * and build their adjacency / incidence lists by remapping those of X. */
+        void                                cloneElements(
+                                                std::vector<Vertex *> const    &X_vertices,
+                                                std::vector<Face *> const      &X_faces,
+                                                std::vector<Vertex *> const    &new_vertices,
+                                                std::vector<Face *> const      &new_faces,
+                                                std::vector<Vertex *> const    &v_of_xid,
+                                                std::vector<Face *> const      &f_of_xid,
+                                                bool                            copy_attributes);
+
+        /* optional edge index: maps an undirected edge {u, v}, keyed by the vertex pointers in
+         * ascending address order, to its Edge object. pointers are used as keys since they survive
+         * renumberConsecutively() and moveAppend(), ids don't. the Edge objects live inside the map,
+         * whose nodes are never relocated, and are additionally registered by id in E. */
+        struct EdgeIndexHash {
+            size_t
+            operator()(const std::pair<const Vertex *, const Vertex *> &e) const
+            {
+                size_t h = std::hash<const Vertex *>()(e.first);
+                return h ^ (std::hash<const Vertex *>()(e.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+            }
+        };
+
+        typedef std::unordered_map<
+                std::pair<const Vertex *, const Vertex *>,
+                Edge,
+                EdgeIndexHash
+            >                               EdgeIndexMap;
+
+        bool                                edge_index_enabled;
+        EdgeIndexMap                        edge_index;
+        IdSlotMap<EdgePointerType>          E;
+        IdQueue                             E_idq;
+
+        /* undo journal recording all changes since the last checkpoint(). erased vertices and faces
+         * stay allocated while a checkpoint is set, so that rollback() can restore them at their
+         * old addresses. */
+        enum MeshJournalOps {
+            JOURNAL_VERTEX_INSERT,
+            JOURNAL_VERTEX_ERASE,
+            JOURNAL_VERTEX_POS,
+            JOURNAL_VERTEX_LISTS,
+            JOURNAL_FACE_INSERT,
+            JOURNAL_FACE_ERASE,
+            JOURNAL_FACE_VERTICES
+        };
+
+        struct JournalEntry {
+            uint32_t                        op;
+            Vertex                         *v;
+            Face                           *f;
+            Vec3<R>                         pos;
+            std::array<Vertex *, 4>         f_vertices;
+            std::vector<Vertex *>           adjacent_vertices;
+            std::vector<Face *>             incident_faces;
+
+            JournalEntry(uint32_t _op, Vertex *_v, Face *_f) : op(_op), v(_v), f(_f) {}
+        };
+
+        bool                                journal_active;
+        bool                                journal_replaying;
+        std::vector<JournalEntry>           journal;
+        IdQueue                             V_idq_checkpoint;
+        IdQueue                             F_idq_checkpoint;
+
+        bool                                journaling() const;
+        void                                journalVertexPos(Vertex *v);
+        void                                journalVertexLists(Vertex *v);
+        void                                journalFaceVertices(Face *f);
+
+        static std::pair<const Vertex *, const Vertex *>
+                                            edgeIndexKey(const Vertex *u, const Vertex *v);
+        Edge                               *edgeIndexFind(const Vertex *u, const Vertex *v) const;
+        void                                edgeIndexClear();
+        void                                edgeIndexInsertFace(Face *f);
+        void                                edgeIndexEraseFace(Face *f);
 
         /* data object of template type Tm */
         Tm                                  data;
@@ -1041,6 +1325,44 @@ class Mesh {
                 R
             >                              *O;
         bool                                octree_updated;
+        bool                                bb_updated;
+
+        /* once built, the octree is kept up to date incrementally: vertices and faces are inserted
+         * into / erased from all leaves their bounding box intersects. a leaf holding more than
+         * OCTREE_MAX_ELEMENTS elements is split (up to OCTREE_MAX_DEPTH), an inner node whose
+         * children are leaves holding at most OCTREE_MERGE_ELEMENTS elements in total is turned
+         * back into a leaf. elements outside the root cube make the root grow. position changes
+         * still invalidate the octree, which is then rebuilt lazily by updateOctree(). */
+        enum {
+            OCTREE_MAX_ELEMENTS     = 64,
+            OCTREE_MAX_DEPTH        = 9,
+            OCTREE_MERGE_ELEMENTS   = 16,
+            OCTREE_MAX_ROOT_GROWTH  = 8
+        };
+
+        bool                                octreeLive() const;
+        void                                octreeInsertVertex(Vertex *v);
+        void                                octreeEraseVertex(Vertex *v);
+        void                                octreeInsertFace(Face *f);
+        void                                octreeEraseFace(Face *f);
+        bool                                octreeContain(BoundingBox<R> const &elem_bb);
+        void                                octreeInsertRecursive(
+                                                OctreeNode<Mesh_OctreeNodeInfo>    *n,
+                                                uint32_t                            depth,
+                                                Vec3<R> const                      &aabb_min,
+                                                Vec3<R> const                      &aabb_max,
+                                                Vertex                             *v,
+                                                Face                               *f);
+        void                                octreeEraseRecursive(
+                                                OctreeNode<Mesh_OctreeNodeInfo>    *n,
+                                                Vec3<R> const                      &aabb_min,
+                                                Vec3<R> const                      &aabb_max,
+                                                Vertex                             *v,
+                                                Face                               *f);
+        void                                octreeMergeChildren(OctreeNode<Mesh_OctreeNodeInfo> *n);
+
+        static void
+        setOctreeChildCubes(OctreeNode<Mesh_OctreeNodeInfo> *n);
 
         static void
         partitionOctree(
@@ -1072,13 +1394,44 @@ class Mesh {
          * the traversal id queue. */
         void                                resetTraversalStates();
 
+        /* adapter giving the traversal states stored inside vertices / faces for a fixed traversal
+         * id the interface of TraversalStates, so that the traversals below are written once for
+         * both kinds of traversal state. */
+        class InlineTraversalStates {
+            private:
+                uint32_t                    traversal_id;
+
+            public:
+                explicit                    InlineTraversalStates(uint32_t traversal_id) : traversal_id(traversal_id) {}
+
+                uint8_t                     getVertexState(Vertex *v) const         { return v->getTraversalState(this->traversal_id); }
+                void                        setVertexState(Vertex *v, uint8_t s)    { v->setTraversalState(this->traversal_id, s); }
+                uint8_t                     getFaceState(Face *f) const             { return f->getTraversalState(this->traversal_id); }
+                void                        setFaceState(Face *f, uint8_t s)        { f->setTraversalState(this->traversal_id, s); }
+        };
+
+        template <typename S>
+        void                                traverseFaceNeighbourhood(
+                                                Face                   *fstart,
+                                                uint32_t                max_depth,
+                                                std::vector<Face*>     &face_neighbourhood,
+                                                S                      &states);
+
+        template <typename S>
+        void                                traverseConnectedComponent(
+                                                Vertex                 *vstart,
+                                                S                      &states,
+                                                std::list<Vertex *>    *cc_vertices,
+                                                std::list<Face *>      *cc_faces);
+
     public:
         /* Mesh public interface */
 
-        /* the only two publically accessible members are immutable instances of the accessor classes for vertices and
-         * faces. they are both non-copy-constructible and non-assignable. */
+        /* the only publically accessible members are immutable instances of the accessor classes for vertices,
+         * faces and edges. they are all non-copy-constructible and non-assignable. */
         VertexAccessor                      vertices;
         FaceAccessor                        faces;
+        EdgeAccessor                        edges;
 
         /* ctor, copy ctor */
                                             Mesh();
@@ -1093,6 +1446,20 @@ class Mesh {
         /* clear all data, clear faces only */
         void                                clear();
         void                                clearFaces();
+
+        /* savepoint / undo: checkpoint() sets a savepoint. from then on, vertex and face
+         * insertions and erasures, position changes through Vertex::setPos(), scale() and
+         * translate(), as well as the local topological edits done by collapseTriEdge() and
+         * mergeUnrelatedVertices() are journaled. rollback() reverts the mesh to the savepoint in
+         * time proportional to the number of journaled changes and leaves the savepoint in place.
+         * all vertex and face pointers and ids from the savepoint are valid again afterwards.
+         * releaseCheckpoint() discards the journal. vertex / face data and traversal states are
+         * not journaled. clear(), clearFaces() and assignment release a checkpoint implicitly,
+         * renumberConsecutively() refuses to run while one is set. */
+        void                                checkpoint();
+        void                                rollback();
+        void                                releaseCheckpoint();
+        bool                                hasCheckpoint() const;
         /* renumber vertices and faces consecutively from the given start ids onwards */
         void                                renumberConsecutively(uint32_t vertex_start_id = 0, uint32_t face_start_id = 0);
 
@@ -1109,6 +1476,15 @@ class Mesh {
         /* invert orientation of all faces */
         void                                invertOrientation();
 
+        /* optional edge index mapping each edge to its incident faces. while enabled, it is kept up
+         * to date by all topological modifications, provides the Edge objects accessed through
+         * Mesh::edges and turns the edge queries below (checkEdge(), getFacesIncidentToEdge() and
+         * its manifold versions) as well as numEdges() into O(1) lookups instead of scans over the
+         * incidence lists. costs roughly 100 bytes per edge. */
+        void                                enableEdgeIndex();
+        void                                disableEdgeIndex();
+        bool                                hasEdgeIndex() const;
+
         /* traveral state is publically accessible for traversal methods. */
         enum MeshTraversalStates {
             TRAV_UNSEEN      = 0,
@@ -1118,6 +1494,34 @@ class Mesh {
         };
         uint32_t                            getFreshTraversalId();
 
+        /* traversal states kept outside of the mesh: one state per vertex / face id, tagged with
+         * an epoch that reset() increments, so starting a new traversal costs O(1) instead of a
+         * fresh traversal id. since the traversal methods taking a TraversalStates object don't
+         * write to the mesh, several threads may traverse the same mesh concurrently as long as
+         * each uses its own TraversalStates object and nobody modifies the mesh meanwhile.
+         * vertices / faces inserted after construction are handled transparently. */
+        class TraversalStates {
+            private:
+                Mesh<Tm, Tv, Tf, R> const  *mesh;
+                uint32_t                    epoch;
+                std::vector<uint32_t>       v_states;
+                std::vector<uint32_t>       f_states;
+
+                uint8_t                     getState(std::vector<uint32_t> const &states, uint32_t id) const;
+                void                        setState(std::vector<uint32_t> &states, uint32_t id, uint8_t state);
+
+            public:
+                explicit                    TraversalStates(Mesh<Tm, Tv, Tf, R> const &M);
+
+                /* set all states to TRAV_UNSEEN */
+                void                        reset();
+
+                uint8_t                     getVertexState(Vertex const *v) const;
+                void                        setVertexState(Vertex const *v, uint8_t state);
+                uint8_t                     getFaceState(Face const *f) const;
+                void                        setFaceState(Face const *f, uint8_t state);
+        };
+
         /* append another mesh: add vertices / faces and offset indices. not that no topological connection
          * between (this) mesh and the appended mesh is performed, it simply computes the union of two
          * distinct meshes inside one object. note also that the old ids (and of course all
@@ -1151,6 +1555,13 @@ class Mesh {
                                                 std::list<Vertex *>    *cc_vertices = NULL,
                                                 std::list<Face *>      *cc_faces    = NULL);
 
+        /* version using external traversal states, which does not modify the mesh. */
+        void                                getConnectedComponent(
+                                                Mesh::vertex_iterator   vstart_it,
+                                                TraversalStates        &states,
+                                                std::list<Vertex *>    *cc_vertices = NULL,
+                                                std::list<Face *>      *cc_faces    = NULL);
+
         /* delete all connected components containing isolated vertices or border edges */
         void                                deleteBorderCCsAndIsolatedVertices();
 
@@ -1308,9 +1719,42 @@ class Mesh {
         void                                checkInternalConsistency() const;
 
         /* -----------------  I/O  ----------------- */
+        /* the obj reader maps the file, parses line-aligned chunks of it in parallel and builds the
+         * mesh in bulk. faces can be triangles or quads given as "a", "a/t", "a//n" or "a/t/n". */
         void                                readFromObjFile(const char *filename);
         void                                writeObjFile(const char *jobname);
 
+        /* parsing part of readFromObjFile(): the positions and face indices in the layout of
+         * buildFromArrays() below */
+        static void                         readObjArrays(
+                                                const char                     *filename,
+                                                std::vector<R>                 &pos,
+                                                std::vector<uint32_t>          &idx);
+
+        /* binary mesh format ".amb": a versioned header followed by the vertex positions, one
+         * block of four uint32_t vertex indices per face (UINT32_MAX as fourth index marks a
+         * triangle) and optionally the raw vertex / face data, which is only written for
+         * trivially copyable Tv / Tf and only read back if the element sizes match. ids are
+         * consecutive as in the obj format. the file is memory-mapped for reading and the mesh
+         * is built in bulk directly from the mapping. writeBinaryFile() writes "<jobname>.amb". */
+        void                                readFromBinaryFile(const char *filename);
+        void                                writeBinaryFile(const char *jobname, bool write_data = false);
+
+        /* read ".amb" files with readFromBinaryFile(), everything else with readFromObjFile() */
+        void                                readFromFile(const char *filename);
+
+        /* bulk construction used by the readers: replace the mesh contents with nvertices
+         * vertices at the positions pos[3*i .. 3*i+2] and nfaces faces with vertex ids
+         * idx[4*i .. 4*i+3], where idx[4*i+3] == UINT32_MAX marks a triangle. elements get the ids
+         * 0..n-1 in array order. vdata / fdata may be NULL. */
+        void                                buildFromArrays(
+                                                uint32_t                        nvertices,
+                                                R const                        *pos,
+                                                uint32_t                        nfaces,
+                                                uint32_t const                 *idx,
+                                                Tv const                       *vdata,
+                                                Tf const                       *fdata);
+
 
         /* NOTE: In the C++11 standard, nested classes are automatically "friends" of the containing
          * class, but not vice versa. the declarations below are therefore obsolete */
@@ -47,6 +47,8 @@
 #ifndef MESH_ALGORITHMS_H
 #define MESH_ALGORITHMS_H
 
+#include "MeshPageStore.hh"
+#include "Profiler.hh"
 
 /* exception classes for Red-Blue Union algorithms */
 namespace RedBlue_ExCodes {
@@ -308,15 +310,17 @@ namespace MeshAlg {
             >                                              *blue_update_its = NULL);
 
     
-    /* greedy edge collapse post-processing */
+    /* greedy edge collapse post-processing. if locked is given, edges incident to vertices v with v.id() <
+     * locked->size() and (*locked)[v.id()] are never collapsed. */
     template <typename Tm, typename Tv, typename Tf, typename R>
     void
     greedyEdgeCollapsePostProcessing(
-        Mesh<Tm, Tv, Tf, R>    &M,
-        R const                &alpha   = 1.75,
-        R const                &lambda  = 0.125,
-        R const                &mu      = 0.5,
-        uint32_t                d       = 15);
+        Mesh<Tm, Tv, Tf, R>        &M,
+        R const                    &alpha   = 1.75,
+        R const                    &lambda  = 0.125,
+        R const                    &mu      = 0.5,
+        uint32_t                    d       = 15,
+        std::vector<bool> const    *locked  = NULL);
 
     /* smoothing algorithms */
     template <typename Tm, typename Tv, typename Tf, typename R>
@@ -326,13 +330,15 @@ namespace MeshAlg {
         R const                &lambda,
         uint32_t                maxiter);
 
+    /* HC smoothing, locked vertices (see greedyEdgeCollapsePostProcessing()) keep their position */
     template <typename Tm, typename Tv, typename Tf, typename R>
     void
     HCLaplacianSmoothing(
-        Mesh<Tm, Tv, Tf, R>    &M,
-        R const                &alpha   = 0.4,
-        R const                &beta    = 0.7,
-        uint32_t                maxiter = 100);
+        Mesh<Tm, Tv, Tf, R>        &M,
+        R const                    &alpha   = 0.4,
+        R const                    &beta    = 0.7,
+        uint32_t                    maxiter = 100,
+        std::vector<bool> const    *locked  = NULL);
 
     /* functions to allow partial flushing of a mesh to an obj file. NOTE: this does not provide paging functionality
      * that can be applied transparently by the user, i.e.: if a part of a mesh has been dumped, it is no longer part of
@@ -349,7 +355,10 @@ namespace MeshAlg {
      * in order not to meddle with the internal structure (e.g. vertex / face numbering), the following methods have
      * been designed to take care of the vertex indexing / numbering issue. obj files vertex lines semantics do not
      * specify vertex indices, but number the vertices (represented as single lines each) consecutively in order of
-     * appearance. */
+     * appearance.
+     *
+     * if page_store is given, the flushed faces are added to it instead of being written to the obj file, which is
+     * not touched then. */
     template <typename Tm, typename Tv, typename Tf, typename R>
     void
     partialFlushToObjFile(
@@ -369,7 +378,8 @@ namespace MeshAlg {
                     uint32_t          
                 >
             >                                                      &out_boundary_vertices,
-        uint32_t                                                   &out_last_flush_vertex_id);
+        uint32_t                                                   &out_last_flush_vertex_id,
+        MeshPageStore<R>                                           *page_store = NULL);
 
     /* class storing information about the flushing process to ease use of the above function. used in conjunction with
      * the wrapper overload of partialFlushToObjFile(..) below. */
@@ -385,13 +395,19 @@ namespace MeshAlg {
                     >
                 >                                                   last_boundary_vertices;
             uint32_t                                                last_flush_vertex_id;
+            /* if set, flushed faces go to the page store instead of the obj file */
+            MeshPageStore<R>                                       *page_store;
 
             MeshObjFlushInfo()
-            : obj_file(NULL), last_flush_vertex_id(0)
+            : obj_file(NULL), last_flush_vertex_id(0), page_store(NULL)
+            {}
+
+            MeshObjFlushInfo(MeshPageStore<R> *_page_store)
+            : obj_file(NULL), last_flush_vertex_id(0), page_store(_page_store)
             {}
 
             MeshObjFlushInfo(const std::string& _filename)
-            : filename(_filename), obj_file(NULL), last_flush_vertex_id(0)
+            : filename(_filename), obj_file(NULL), last_flush_vertex_id(0), page_store(NULL)
             {
                 this->obj_file  = fopen( (this->filename + ".obj").c_str(), "w");
                 if (!this->obj_file) {
@@ -420,6 +436,35 @@ namespace MeshAlg {
         Mesh<Tm, Tv, Tf, R>                                        &M,
         MeshObjFlushInfo<Tm, Tv, Tf, R>                            &M_flush_info,
         std::list<typename Mesh<Tm, Tv, Tf, R>::Face *>            &face_list);
+
+    /* assemble the complete mesh of a partially flushed M in M_out without writing it to disk: the flushed part is
+     * read back from M_flush_info's obj file and the remaining part is taken from M, which is left unchanged. ids and
+     * order of vertices and faces are the same as after flushing all remaining faces of M with
+     * partialFlushToObjFile() and reading the obj file with readFromObjFile(). */
+    template <typename Tm, typename Tv, typename Tf, typename R>
+    void
+    collectFlushedMesh(
+        Mesh<Tm, Tv, Tf, R>                                        &M,
+        MeshObjFlushInfo<Tm, Tv, Tf, R>                            &M_flush_info,
+        Mesh<Tm, Tv, Tf, R>                                        &M_out);
+
+    /* greedy edge collapse and HC smoothing of a mesh held in a page store, one page at a time. vertices on the seams
+     * between pages are locked, i.e. they are neither moved nor collapsed. every stage is therefore run twice, the
+     * second time on a shifted partition, so that only vertices near the corners of both partitions' leaves stay
+     * unprocessed. the result generally differs slightly from in-core post-processing of the same mesh. */
+    template <typename Tm, typename Tv, typename Tf, typename R>
+    void
+    outOfCorePostProcessing(
+        MeshPageStore<R>       &store,
+        bool                    gec,
+        R const                &gec_alpha,
+        R const                &gec_lambda,
+        R const                &gec_mu,
+        uint32_t                gec_d,
+        bool                    hc,
+        R const                &hc_alpha,
+        R const                &hc_beta,
+        uint32_t                hc_maxiter);
 }
 
 #include "../tsrc/MeshAlgorithms_impl.hh"
@@ -0,0 +1,183 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MESH_PAGE_STORE_H
+#define MESH_PAGE_STORE_H
+
+#include "common.hh"
+#include "aux.hh"
+#include "Vec3.hh"
+#include "Mesh.hh"
+
+/* out-of-core storage for meshes that don't fit into memory as a whole. the faces are kept in pages on a scratch
+ * file, one page per leaf of an octree over the bounding box of the mesh holding the faces whose centroids lie in
+ * that leaf. the octree is refined until every page fits into the memory budget, so that every page can be loaded
+ * into a Mesh of its own, processed and stored back.
+ *
+ * vertices are identified by global ids handed out by the store. every face record carries the positions of its
+ * vertices, so a vertex referenced by faces of several pages (a "seam vertex") is stored once per page. to keep
+ * these copies consistent, seam vertices must neither be moved nor removed while a page is being processed, see
+ * loadPage(). the store is not thread-safe.
+ *
+ * besides the loaded page and the write buffers, which are bounded by the budget, only data per page is held in
+ * memory: partition() derives the octree from face counts gathered in a few passes over the scratch file, and all
+ * per-vertex data lives in file-backed scratch arrays "<filename>.*", which the kernel pages out as needed. */
+template <typename R>
+class MeshPageStore {
+    public:
+        /* one face: global vertex ids, where v[3] == UINT32_MAX marks a triangle, and the vertex positions */
+        struct FaceRecord {
+            uint32_t                        v[4];
+            R                               pos[4][3];
+        };
+
+        /* memory taken by one face of a Mesh under post-processing, including the edge index and the per-face
+         * data of MeshAlg::greedyEdgeCollapsePostProcessing(). the page size is derived from the budget with it. */
+        static const size_t                 mesh_bytes_per_face = 1024;
+
+    private:
+        struct Chunk {
+            uint64_t                        offset;
+            uint64_t                        nfaces;
+        };
+
+        /* a page is a list of chunks of face records on the scratch file */
+        typedef std::vector<Chunk>          Page;
+
+        static const uint32_t               vertex_unused   = UINT32_MAX;
+        static const uint32_t               vertex_seam     = UINT32_MAX - 1;
+
+        /* maximum octree depth. leaves are identified by 3 * max_depth bit morton codes. */
+        static const uint32_t               max_depth       = 10;
+        /* octree levels counted per pass over the faces in partition() */
+        static const uint32_t               levels_per_pass = 3;
+
+        std::string                         filename_base;
+        std::string                         filename;
+        uint32_t                            file_generation;
+        FILE                               *file;
+        uint64_t                            file_end;
+
+        size_t                              memory_budget;
+        uint64_t                            max_page_faces;
+
+        std::vector<Page>                   pages;
+        /* faces added since the last partition() */
+        Page                                staging;
+        uint64_t                            nfaces;
+
+        uint32_t                            next_vertex_id;
+        /* per global vertex id: the page of the faces referencing it or vertex_seam if there are several. like all
+         * per-vertex arrays of the store, it lives in a file-backed scratch array outside the memory budget. */
+        Aux::File::ScratchArray             vertex_page;
+        uint32_t                            nvertex_page;
+
+        Vec3<R>                             bb_min;
+        Vec3<R>                             bb_max;
+        uint32_t                            typical_leaf_depth;
+
+        void                                appendChunk(FILE *f, uint64_t &f_end, Page &page, FaceRecord const *faces, size_t n);
+        void                                readFaces(Chunk const &chunk, uint64_t first, size_t n, FaceRecord *faces);
+        uint64_t                            pageSize(Page const &page) const;
+        void                                setVertexPage(uint32_t id, uint32_t p);
+        uint32_t                            getVertexPage(uint32_t id);
+        void                                openScratchArray(Aux::File::ScratchArray &a, char const *suffix, size_t size);
+
+        /* call f(record) for all faces in the given chunks, which are read in blocks of bounded size */
+        template <typename F>
+        void                                forEachFace(std::vector<Chunk> const &chunks, F const &f);
+
+    public:
+                                            MeshPageStore(std::string const &filename, size_t memory_budget);
+                                            MeshPageStore(MeshPageStore const &) = delete;
+        MeshPageStore                      &operator=(MeshPageStore const &) = delete;
+                                           ~MeshPageStore();
+
+        /* hand out n consecutive fresh global vertex ids and return the first one */
+        uint32_t                            newVertexIds(uint32_t n);
+        uint32_t                            numVertexIds() const;
+        uint64_t                            numFaces() const;
+        uint32_t                            numPages() const;
+
+        /* add faces, which are kept apart from the pages until the next partition() */
+        void                                addFaces(FaceRecord const *faces, size_t n);
+
+        /* add a mesh given in the array layout of Mesh::buildFromArrays(), its vertices get fresh ids */
+        void                                addArrays(uint32_t nvertices, R const *pos, uint32_t nfaces, uint32_t const *idx);
+
+        /* (re)distribute all faces into pages. the octree of a shifted partition is offset by half the side length
+         * of a typical leaf, so that most seams of an unshifted partition lie inside the pages of a shifted one and
+         * vice versa. the scratch file is rewritten in the process, which also reclaims the space of pages
+         * replaced by storePage(). */
+        void                                partition(bool shifted = false);
+
+        /* load page p into the empty mesh M, whose vertices get the ids 0..n-1. vertex_gid maps them to their
+         * global ids, locked flags the seam vertices. */
+        template <typename Tm, typename Tv, typename Tf>
+        void                                loadPage(
+                                                uint32_t                    p,
+                                                Mesh<Tm, Tv, Tf, R>        &M,
+                                                std::vector<uint32_t>      &vertex_gid,
+                                                std::vector<bool>          &locked);
+
+        /* replace page p by the faces of M, which has been filled by loadPage(p, M, vertex_gid, ..) and then
+         * modified without touching locked vertices. vertices with ids not covered by vertex_gid are new and
+         * get fresh global ids. */
+        template <typename Tm, typename Tv, typename Tf>
+        void                                storePage(
+                                                uint32_t                        p,
+                                                Mesh<Tm, Tv, Tf, R>            &M,
+                                                std::vector<uint32_t> const    &vertex_gid);
+
+        /* write all faces to the obj file "<jobname>.obj" in the layout of Mesh::writeObjFile(), including vertex
+         * normals. vertices are numbered in order of first use. the numbering and the normals are kept in
+         * file-backed scratch arrays. */
+        void                                writeObjFile(const char *jobname);
+};
+
+#include "../tsrc/MeshPageStore_impl.hh"
+
+#endif
@@ -50,6 +50,11 @@
 #include "CellNetwork.hh"
 #include "CanalSurface.hh"
 #include "NLM.hh"
+#include "Profiler.hh"
+#include "TaskPool.hh"
+#include "BVH.hh"
+
+#include <unordered_map>
 
 /* forward declarations */
 template <typename R> class NLM_CellNetwork;
@@ -103,6 +108,8 @@ class NLM_CellNetwork
         uint32_t        analysis_nthreads;
         R               analysis_univar_solver_eps;
         R               analysis_bivar_solver_eps;
+        bool            analysis_incremental;
+        bool            analysis_stop_at_first_intersection;
 
         R               partition_filter_angle;
         R               partition_filter_max_ratio_ratio;
@@ -212,6 +219,8 @@ class NLM_CellNetwork
             uint32_t        analysis_nthreads;
             R               analysis_univar_solver_eps;
             R               analysis_bivar_solver_eps;
+            bool            analysis_incremental;
+            bool            analysis_stop_at_first_intersection;
 
             /*
             R               partition_filter_angle;
@@ -273,7 +282,9 @@ class NLM_CellNetwork
             JOB_GSI             = 2,
             JOB_SONS            = 3,
             JOB_NS_NS_ADJ       = 4,
-            JOB_NS_NS_NONADJ    = 5
+            JOB_NS_NS_NONADJ    = 5,
+            JOB_NS_NS_NONADJ_PART = 6,
+            JOB_NTYPES          = 7
         };
 
         enum NLM_ISEC_JOB_STATES {
@@ -282,7 +293,10 @@ class NLM_CellNetwork
             JOB_DONE
         };
 
+        /* the job type is a plain member set by the constructor of the derived job, so that the workers and the
+         * result conversion dispatch on it without a virtual call */
         struct IsecJob {
+            uint32_t            job_type;
             uint32_t            job_state;
 
 
@@ -294,9 +308,11 @@ class NLM_CellNetwork
             bool                result;
 
             IsecJob(
+                uint32_t    job_type,
                 R const    &univar_solver_eps,
                 R const    &bivar_solver_eps) 
             {
+                this->job_type          = job_type;
                 this->job_state         = JOB_UNPROCESSED;
                 this->univar_solver_eps = univar_solver_eps;
                 this->bivar_solver_eps  = bivar_solver_eps;
@@ -308,8 +324,19 @@ class NLM_CellNetwork
             {
             }
 
-            virtual uint32_t
-            type() const = 0;
+            uint32_t
+            type() const
+            {
+                return this->job_type;
+            }
+
+            /* take over the result of a job of the same type with identical input, used by incremental analysis */
+            virtual void
+            copyResult(IsecJob const &job)
+            {
+                this->job_state         = JOB_DONE;
+                this->result            = job.result;
+            }
 
             void
             reset()
@@ -326,16 +353,17 @@ class NLM_CellNetwork
             REG_Job(
                 neurite_segment_const_iterator const   &ns_it,
                 R const                                &univar_solver_eps)
-                    : IsecJob(univar_solver_eps, Aux::Numbers::inf<R>())
+                    : IsecJob(JOB_REG, univar_solver_eps, Aux::Numbers::inf<R>())
             {
                 this->ns_it             = ns_it;
                 this->checkpoly_roots   = checkpoly_roots;
             }    
 
-            virtual uint32_t
-            type() const final
+            virtual void
+            copyResult(IsecJob const &job)
             {
-                return JOB_REG;
+                IsecJob::copyResult(job);
+                this->checkpoly_roots = static_cast<REG_Job const &>(job).checkpoly_roots;
             }
         };
 
@@ -346,15 +374,16 @@ class NLM_CellNetwork
             LSI_Job(
                 neurite_segment_const_iterator const   &ns_it,
                 R const                                &univar_solver_eps)
-                    : IsecJob(univar_solver_eps, Aux::Numbers::inf<R>())
+                    : IsecJob(JOB_LSI, univar_solver_eps, Aux::Numbers::inf<R>())
             {
                 this->ns_it = ns_it;
             }    
 
-            virtual uint32_t
-            type() const final
+            virtual void
+            copyResult(IsecJob const &job)
             {
-                return JOB_LSI;
+                IsecJob::copyResult(job);
+                this->lsi_neg_points = static_cast<LSI_Job const &>(job).lsi_neg_points;
             }
         };
 
@@ -366,15 +395,16 @@ class NLM_CellNetwork
                 neurite_segment_const_iterator const   &ns_it,
                 R const                                &univar_solver_eps,
                 R const                                &bivar_solver_eps)
-                    : IsecJob(univar_solver_eps, bivar_solver_eps)
+                    : IsecJob(JOB_GSI, univar_solver_eps, bivar_solver_eps)
             {
                 this->ns_it = ns_it;
             }    
 
-            virtual uint32_t
-            type() const final
+            virtual void
+            copyResult(IsecJob const &job)
             {
-                return JOB_GSI;
+                IsecJob::copyResult(job);
+                this->gsi_stat_points = static_cast<GSI_Job const &>(job).gsi_stat_points;
             }
         };
 
@@ -388,17 +418,18 @@ class NLM_CellNetwork
                 soma_const_iterator const              &s_it,
                 neurite_segment_const_iterator const   &ns_it,
                 R const                                &univar_solver_eps)
-                    : IsecJob(univar_solver_eps, Aux::Numbers::inf<R>())
+                    : IsecJob(JOB_SONS, univar_solver_eps, Aux::Numbers::inf<R>())
             {
                 this->s_it                  = s_it;
                 this->ns_it                 = ns_it;
                 this->neurite_root_segment  = this->ns_it->getSourceVertex()->isNeuriteRootVertex();
             }
 
-            virtual uint32_t
-            type() const final
+            virtual void
+            copyResult(IsecJob const &job)
             {
-                return JOB_SONS;
+                IsecJob::copyResult(job);
+                this->isec_stat_points = static_cast<SONS_Job const &>(job).isec_stat_points;
             }
         };
 
@@ -408,15 +439,23 @@ class NLM_CellNetwork
             std::vector<NLM::p3<R>>         isec_stat_points;
 
             NSNS_Job(
+                uint32_t                                job_type,
                 neurite_segment_const_iterator const   &ns_first_it,
                 neurite_segment_const_iterator const   &ns_second_it,
                 R const                                &univar_solver_eps,
                 R const                                &bivar_solver_eps)
-                    : IsecJob(univar_solver_eps, bivar_solver_eps)
+                    : IsecJob(job_type, univar_solver_eps, bivar_solver_eps)
             {
                 this->ns_first_it   = ns_first_it;
                 this->ns_second_it  = ns_second_it;
             }
+
+            virtual void
+            copyResult(IsecJob const &job)
+            {
+                IsecJob::copyResult(job);
+                this->isec_stat_points = static_cast<NSNS_Job const &>(job).isec_stat_points;
+            }
         };
 
         struct NSNS_NonAdj_Job : public NSNS_Job {
@@ -425,15 +464,9 @@ class NLM_CellNetwork
                 neurite_segment_const_iterator const   &ns_second_it,
                 R const                                &univar_solver_eps,
                 R const                                &bivar_solver_eps)
-                    : NSNS_Job(ns_first_it, ns_second_it, univar_solver_eps, bivar_solver_eps)
+                    : NSNS_Job(JOB_NS_NS_NONADJ, ns_first_it, ns_second_it, univar_solver_eps, bivar_solver_eps)
             {
             }
-
-            virtual uint32_t
-            type() const final
-            {
-                return JOB_NS_NS_NONADJ;
-            }
         };
 
         struct NSNS_Adj_Job : public NSNS_Job {
@@ -445,15 +478,66 @@ class NLM_CellNetwork
                 bool                                    fst_end_snd_start,
                 R const                                &univar_solver_eps,
                 R const                                &bivar_solver_eps)
-                    : NSNS_Job(ns_first_it, ns_second_it, univar_solver_eps, bivar_solver_eps)
+                    : NSNS_Job(JOB_NS_NS_ADJ, ns_first_it, ns_second_it, univar_solver_eps, bivar_solver_eps)
             {
                 this->fst_end_snd_start = fst_end_snd_start;
             }
+        };
 
-            virtual uint32_t
-            type() const final
+        /* one parameter sub-domain of the bivariate system of an expensive NSNS_NonAdj_Job, which is split into parts
+         * that can be solved in parallel. a part only computes the bivariate roots in its domain, the candidate
+         * evaluation for the parent job happens once all of its parts are done. */
+        struct NSNS_NonAdj_Part_Job : public IsecJob {
+            NSNS_NonAdj_Job                        *parent;
+            PolyAlg::RealRectangle<R>               domain;
+            std::vector<PolyAlg::RealRectangle<R>>  pq_roots;
+            bool                                    solver_failed;
+
+            NSNS_NonAdj_Part_Job(
+                NSNS_NonAdj_Job                    *parent,
+                PolyAlg::RealRectangle<R> const    &domain)
+                    : IsecJob(JOB_NS_NS_NONADJ_PART, parent->univar_solver_eps, parent->bivar_solver_eps)
             {
-                return JOB_NS_NS_ADJ;
+                this->parent        = parent;
+                this->domain        = domain;
+                this->solver_failed = false;
+            }
+        };
+
+        /* all jobs of one analysis, stored contiguously per job type. order holds pointers to all jobs in the order of
+         * exhaustive testing, which is the order the results are reported in. the pointers stay valid as long as the
+         * arrays are not modified, also if the table is moved. */
+        struct IsecJobTable {
+            std::vector<REG_Job>                    reg;
+            std::vector<LSI_Job>                    lsi;
+            std::vector<GSI_Job>                    gsi;
+            std::vector<SONS_Job>                   sons;
+            std::vector<NSNS_Adj_Job>               nsns_adj;
+            std::vector<NSNS_NonAdj_Job>            nsns_nonadj;
+
+            std::vector<IsecJob *>                  order;
+
+            IsecJob *
+            job(
+                uint32_t    type,
+                size_t      i)
+            {
+                switch (type) {
+                    case JOB_REG:           return &(this->reg[i]);
+                    case JOB_LSI:           return &(this->lsi[i]);
+                    case JOB_GSI:           return &(this->gsi[i]);
+                    case JOB_SONS:          return &(this->sons[i]);
+                    case JOB_NS_NS_ADJ:     return &(this->nsns_adj[i]);
+                    case JOB_NS_NS_NONADJ:  return &(this->nsns_nonadj[i]);
+                    default:
+                        throw("NLM_CellNetwork::IsecJobTable::job(): invalid job type.");
+                }
+            }
+
+            size_t
+            size() const
+            {
+                return (this->order.size());
             }
         };
 
@@ -846,50 +930,6 @@ class NLM_CellNetwork
             }
         }
 
-        /* thread related types */
-        enum ThreadState {
-            THREAD_IDLE,
-            THREAD_PROCESSING,
-            THREAD_DONE
-        };
-
-        struct ThreadInfo {
-            uint32_t                            thread_id;
-            uint32_t                            thread_state;
-            std::thread                         thread;
-            std::mutex                          mutex;
-            std::list<std::shared_ptr<IsecJob>> job_list;
-
-            ThreadInfo(uint32_t id) : thread(), mutex()
-            {
-                thread_id       = id;
-                thread_state    = THREAD_IDLE;
-            }
-
-            ThreadInfo(ThreadInfo const &ti) = delete;
-            ThreadInfo &operator=(ThreadInfo const &ti) = delete;
-            /* move constructor */
-
-            ThreadInfo (ThreadInfo &&ti)
-                /* mutex can't be moved, construct a fresh one.. */
-                : mutex() {
-                this->thread_id     = ti.thread_id; 
-                this->thread_state  = ti.thread_state;
-                /* move thread handler from ti to (this) with move constructor, this invalidates the thread in ti, yet
-                 * leaves the (logical) thread process completely unaffected */
-                this->thread        = std::move(ti.thread);
-                this->job_list      = std::move(ti.job_list);
-            }
-
-            void
-            reset()
-            {
-                thread_state    = THREAD_IDLE;
-                job_list.clear();
-            }
-        };
-
-
     protected:
         /* partitioning of individual neurite sub-tree starting with neurite segment e = (u, v), where the (non-public)
          * caller must ensure that e's source vertex u is a neurite vertex of the cell-tree rooted in soma s.
@@ -930,13 +970,24 @@ class NLM_CellNetwork
                                                         R const                    &bivar_solver_eps,
                                                         std::vector<NLM::p3<R>>    &gsi_stat_points);   
 
-        /* neurite / neurite intersection for non-adjacent neurite segment canal surfaces */
+        /* neurite / neurite intersection for non-adjacent neurite segment canal surfaces. if presolved_roots is given,
+         * the bivariate system is not solved again and the given roots are evaluated instead. */
         static bool                                 checkNeuriteNeuriteIntersection(
                                                         BLRCanalSurface<3u, R> const   &Gamma,
                                                         BLRCanalSurface<3u, R> const   &Delta,
                                                         R const                    &univar_solver_eps,
                                                         R const                    &bivar_solver_eps,
-                                                        std::vector<NLM::p3<R>>    &isec_stat_points);
+                                                        std::vector<NLM::p3<R>>    &isec_stat_points,
+                                                        std::vector<PolyAlg::RealRectangle<R>> const *presolved_roots = NULL);
+
+        /* solve the bivariate neurite / neurite system (p, q) on the parameter sub-domain D and append the root
+         * rectangles to pq_roots. returns false if the solver failed. */
+        static bool                                 solveNeuriteNeuriteSystem(
+                                                        BiBernsteinPolynomial<5u, 3u, R, R>        &p,
+                                                        BiBernsteinPolynomial<3u, 5u, R, R>        &q,
+                                                        PolyAlg::RealRectangle<R> const            &D,
+                                                        R const                                    &bivar_solver_eps,
+                                                        std::vector<PolyAlg::RealRectangle<R>>     &pq_roots);
 
         /* same for adjacent neurite canal segments. if Gamma and Delta do not share their starting
          * point, then Gamma and Delta MUST be given in the order that  satisfies gamma(1.0) = delta(0.0),
@@ -954,16 +1005,60 @@ class NLM_CellNetwork
         void                                        getAllNeuritePaths(std::list<NLM::NeuritePath<R> const *> &neurite_paths) const;
 
         /* compute all intersection jobs for one full analysis cycle */
-        void                                        computeFullAnalysisIntersectionJobs(std::list<std::shared_ptr<IsecJob>> &job_queue) const;
-
-        /* thread-related methods */
-        static void                                 startWorkerThread(ThreadInfo *tinfo);
-       
-        std::vector<ThreadInfo>                     thread_slots; 
+        void                                        computeFullAnalysisIntersectionJobs(IsecJobTable &jobs) const;
+
+        /* cost model for scheduling the analysis jobs. the estimated cost of a job is the work of its solvers, derived
+         * from the polynomial degrees, times factors for the curvature of the spine curves and the bounding box
+         * overlap of the involved canal segments, which both drive the number of subdivisions.
+         *
+         * if the profiler is enabled, the measured time per cost unit of every job type relative to the whole batch
+         * is kept in job_cost_scale and corrects the estimates of subsequent analyses in the same process. only the
+         * job order depends on the calibration, splitting decisions use the uncalibrated model. */
+        static R                                    job_cost_scale[JOB_NTYPES];
+
+        static R                                    estimateJobCost(IsecJob const &job);
+        static char const                          *jobStageName(uint32_t type);
+        static void                                 getSolverStageTimes(
+                                                        Profiler::Node                 *prof_parent,
+                                                        std::vector<double>            &times);
+        static void                                 calibrateJobCosts(
+                                                        std::vector<IsecJob *> const   &jobs,
+                                                        std::vector<R> const           &model_costs,
+                                                        std::vector<double> const      &times_before,
+                                                        std::vector<double> const      &times_after);
+
+        /* thread-related methods. processIntersectionJob() solves a single job and is called concurrently by the
+         * workers of analysis_pool, which is created on first use and kept as long as the thread count does not
+         * change. if stop_at_first_intersection is set, the cheapest jobs are processed first and the first positive
+         * result cancels all running solvers and skips the remaining jobs. only that result is returned, all other
+         * jobs that have not been completed before are reset to JOB_UNPROCESSED. */
+        static void                                 processIntersectionJob(
+                                                        IsecJob                    *generic_job,
+                                                        Profiler::StageSet         &prof_stages);
+
+        std::unique_ptr<TaskPool>                   analysis_pool;
         void                                        processIntersectionJobsMultiThreaded(
                                                         uint32_t const                             &nthreads,
-                                                        std::list<std::shared_ptr<IsecJob>> const  &job_queue,
-                                                        std::list<std::shared_ptr<IsecJob>>        &results);
+                                                        std::vector<IsecJob *> const               &job_queue,
+                                                        std::vector<IsecJob *>                     &results,
+                                                        bool                                        stop_at_first_intersection = false);
+
+        /* incremental analysis: if analysis_incremental is set, the job table of the last analysis is kept in
+         * analysis_cache_jobs and its solved jobs are indexed in analysis_cache, keyed by a hash of the job type, the
+         * solver tolerances and the input geometry of the job, i.e. the bezier control points and radii of the
+         * magnified canal segments and the soma spheres. a re-analysis after an edit solves only the jobs whose key is
+         * not found and copies the results of all other jobs. */
+        std::unique_ptr<IsecJobTable>                       analysis_cache_jobs;
+        std::unordered_map<uint64_t, IsecJob const *>       analysis_cache;
+
+        static uint64_t                             hashBytes(
+                                                        uint64_t                    h,
+                                                        void const                 *data,
+                                                        size_t                      n);
+        static uint64_t                             hashCanalSegment(BLRCanalSurface<3u, R> const &Gamma);
+        void                                        computeJobHashes(
+                                                        std::vector<IsecJob *> const               &jobs,
+                                                        std::vector<uint64_t>                      &hashes) const;
 
 
         /* compute initial neurite root vertices as described in the thesis: all vertices inside the soma sphere are deleted.
@@ -1064,12 +1159,30 @@ class NLM_CellNetwork
         /* update geometry of entire network */
         void                                        updateNetworkGeometry();
 
-        /* perform one full analysis iteration on the entire cell network. */
+        /* perform one full analysis iteration on the entire cell network. with analysis_incremental set, only the
+         * jobs whose input has changed since the last analysis are solved. with analysis_stop_at_first_intersection
+         * set, the analysis ends at the first intersection found, which is then the only one reported. */
         bool                                        performFullAnalysis();
 
-        /* mesh generation */
+        /* drop all results kept for incremental analysis */
+        void                                        clearAnalysisCache();
+
+        /* precompute the lazily initialised tables of the solvers: binomial coefficients up to BB degree 24 and the
+         * approximation data of the bivariate solver for bi-degrees (5, 5) and (7, 7). called by performFullAnalysis()
+         * before any worker thread is started, and by callers that fork processes sharing the data. */
+        static void                                 initAnalysisData();
+
+        /* mesh generation. the union mesh is written to "<filename>.obj", which also takes the
+         * partial flushes, unless write_obj is false. if M_out is given, the union mesh is
+         * additionally handed over in memory with the vertex / face order of the obj file. if
+         * page_store is given, which must be empty, partial flushes and finally the whole union
+         * mesh go to the page store instead and the obj file is written from there. */
         template <typename Tm, typename Tv, typename Tf>
-        void                                        renderCellNetwork(std::string filename);
+        void                                        renderCellNetwork(
+                                                        std::string                 filename,
+                                                        Mesh<Tm, Tv, Tf, R>        *M_out      = NULL,
+                                                        bool                        write_obj  = true,
+                                                        MeshPageStore<R>           *page_store = NULL);
 
         template <typename Tm, typename Tv, typename Tf>
         void                                        renderModellingMeshesIndividually(std::string filename) const;
@@ -49,6 +49,7 @@
 
 #include <vector>
 #include <list>
+#include <utility>
 
 #include "CubeCommon.hh"
 
@@ -810,7 +811,57 @@ class Octree {
                 /* now n aint no leaf no more o_O */
                 n->setLeaf(false);
             }
-            else throw("Octree::splitLeaf(). can't split non-leaf.\n"); 
+            else throw("Octree::splitLeaf(). can't split non-leaf.\n");
+        }
+
+        /* inverse of splitLeaf(): free the entire subtree below n, which becomes a leaf again. the
+         * caller is responsible for moving the children's data to n beforehand. */
+        void
+        mergeChildren(OctreeNode<nT> *n)
+        {
+            if (!n->isLeaf()) {
+                octree_free_recursive(n);
+                n->first_child = NULL;
+                n->setLeaf(true);
+            }
+            else throw("Octree::mergeChildren(): can't merge children of leaf.\n");
+        }
+
+        /* grow the tree by one level at the top: the root is split with new data root_data and its
+         * old contents (data and subtree) are moved to the child of type old_root_type. the
+         * children's data has to be set by the caller, except for that of the old root. */
+        void
+        growRoot(
+            nT const           &root_data,
+            uint8_t             old_root_type,
+            Vec3<R> const      &new_root_vertex,
+            R                   new_l)
+        {
+            OctreeNode<nT>     *old_first_child = this->root.first_child;
+            bool                old_leaf        = this->root.isLeaf();
+            nT                  old_data        = std::move(this->root.data);
+            OctreeNode<nT>     *c, *tmp;
+
+            this->root.data         = root_data;
+            this->root.first_child  = NULL;
+            this->root.setLeaf(true);
+            this->splitLeaf(&(this->root));
+
+            /* hand the old subtree over to child c: the last sibling among the old root's children
+             * has to point to c now */
+            c                       = this->root.getChild(old_root_type);
+            c->data                 = std::move(old_data);
+            c->first_child          = old_first_child;
+            c->setLeaf(old_leaf);
+            if (old_first_child) {
+                for (tmp = old_first_child; !tmp->isLastSibling(); tmp = tmp->uplink.next_sibling) {
+                    ;
+                }
+                tmp->uplink.parent  = c;
+            }
+
+            this->root_vertex       = new_root_vertex;
+            this->root_l            = new_l;
         }
 
         void
@@ -50,6 +50,8 @@
 #include "Polynomial.hh"
 #include "BivariatePolynomial.hh"
 
+#include <atomic>
+
 namespace PolyAlg {
 
     /* polynomial base conversion algorithms */
@@ -212,6 +214,39 @@ namespace PolyAlg {
         }
     };
 
+    /* cooperative cancellation of the root finders. while a flag is installed for the calling thread with a
+     * CancellationScope, BezClip_roots() and BiLinClip_roots() check it once per subdivision step and return the roots
+     * found so far as soon as it is set. the caller has to discard such an incomplete result. */
+    inline std::atomic<bool> const *&
+    cancellationFlag()
+    {
+        static thread_local std::atomic<bool> const *flag = NULL;
+        return flag;
+    }
+
+    inline bool
+    cancelled()
+    {
+        std::atomic<bool> const *flag = cancellationFlag();
+        return (flag && flag->load(std::memory_order_relaxed));
+    }
+
+    class CancellationScope {
+        private:
+            std::atomic<bool> const    *saved_flag;
+
+        public:
+            CancellationScope(std::atomic<bool> const *flag) : saved_flag(cancellationFlag())
+            {
+                cancellationFlag() = flag;
+            }
+
+           ~CancellationScope()
+            {
+                cancellationFlag() = this->saved_flag;
+            }
+    };
+
     void
     initPolyAlgorithmData();
     
@@ -0,0 +1,162 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "common.hh"
+
+/* hierarchical stage profiler. stages are opened with Profiler::Scope objects, which nest along the call hierarchy
+ * of the opening thread and record wall time, cpu time of the calling thread and the number of calls per node of
+ * the resulting stage tree. custom counters can be attached to the innermost open stage with Profiler::count().
+ * threads other than the one that enabled the profiler start with an empty stage stack and attach their scopes to
+ * an explicitly given parent, usually the result of Profiler::current() of the spawning thread.
+ *
+ * the profiler is disabled by default. all operations are no-ops then, so that scopes can stay in hot code paths. */
+namespace Profiler {
+
+    struct Node {
+        std::string                             name;
+        Node                                   *parent;
+        uint64_t                                calls;
+        double                                  wall_time;
+        double                                  cpu_time;
+        std::map<std::string, uint64_t>         counters;
+        /* in order of first entry */
+        std::vector<std::unique_ptr<Node>>      children;
+
+                                                Node(std::string const &name, Node *parent);
+        Node                                   *getChild(std::string const &name);
+    };
+
+    /* enable / disable recording. the root of the stage tree is cleared by enable(). */
+    void                                        enable();
+    void                                        disable();
+    bool                                        enabled();
+
+    /* innermost open stage of the calling thread, root if no stage is open, NULL if disabled */
+    Node                                       *current();
+
+    /* add n to counter "counter" of the innermost open stage of the calling thread */
+    void                                        count(char const *counter, uint64_t n = 1);
+
+    /* write stage tree as JSON object to filename. the string pairs of info are written as top level fields before
+     * the stages. returns false if the file can't be written. */
+    bool                                        writeJSON(
+                                                    std::string const                                      &filename,
+                                                    std::list<std::pair<std::string, std::string>> const   &info);
+
+    class Scope {
+        private:
+            Node                               *node;
+            Node                               *prev;
+            double                              wall_start;
+            double                              cpu_start;
+
+            void                                open(char const *name, Node *parent);
+
+                                                Scope(Scope const &x)               = delete;
+            Scope                              &operator=(Scope const &x)           = delete;
+
+        public:
+            /* open stage name below the innermost open stage of the calling thread */
+                                                Scope(char const *name);
+            /* open stage name below parent, for threads spawned from within a stage. NULL parent opens nothing. */
+                                                Scope(char const *name, Node *parent);
+                                               ~Scope();
+    };
+
+    /* fixed set of stages below a common parent for short sections that are entered very often from many threads,
+     * e.g. once per solver job. every thread records calls and times into slots of its own without locking, merge()
+     * adds them to the stage nodes. merge() must not run concurrently with recording threads, e.g. it is called
+     * between two batches of a TaskPool, and is called by the destructor. StageSet::Scope does not change the
+     * innermost open stage, i.e. Profiler::count() within it goes to the enclosing stage. */
+    class StageSet {
+        private:
+            struct Slot {
+                uint64_t                        calls;
+                double                          wall_time;
+                double                          cpu_time;
+            };
+
+            uint64_t                            id;
+            Node                               *parent;
+            std::vector<std::string>            names;
+            std::vector<Node *>                 nodes;
+            /* one slot array per recording thread, guarded by mutex */
+            std::mutex                          mutex;
+            std::vector<std::unique_ptr<std::vector<Slot>>> thread_slots;
+
+            std::vector<Slot>                  &slots();
+
+                                                StageSet(StageSet const &x)         = delete;
+            StageSet                           &operator=(StageSet const &x)        = delete;
+
+        public:
+            /* stages names[i] below parent. NULL parent records nothing. */
+                                                StageSet(Node *parent, std::vector<char const *> const &names);
+                                               ~StageSet();
+
+            void                                merge();
+
+            class Scope {
+                private:
+                    StageSet                   *set;
+                    uint32_t                    stage;
+                    double                      wall_start;
+                    double                      cpu_start;
+
+                                                Scope(Scope const &x)               = delete;
+                    Scope                      &operator=(Scope const &x)           = delete;
+
+                public:
+                                                Scope(StageSet &set, uint32_t stage);
+                                               ~Scope();
+            };
+    };
+}
+
+#endif
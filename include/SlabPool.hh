@@ -0,0 +1,216 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SLAB_POOL
+#define SLAB_POOL
+
+#include "common.hh"
+
+/* fixed-size node pool carving nodes out of large slabs. freed nodes are kept in an intrusive free
+ * list and reused, slabs are only returned to the system as a whole in release() or in the dtor.
+ * used by Mesh for Vertex / Face objects and the nodes of the adjacency / incidence lists, where
+ * millions of small objects are created and destroyed during meshing. not thread-safe. */
+class SlabPool {
+    private:
+        struct FreeNode {
+            FreeNode   *next;
+        };
+
+        size_t                  node_size;
+        size_t                  slab_nodes;
+
+        std::vector<void *>     slabs;
+        FreeNode               *free_head;
+        /* unused tail [bump_cur, bump_end) of the most recently allocated slab */
+        char                   *bump_cur;
+        char                   *bump_end;
+        size_t                  nallocated;
+
+        void                    addSlab(size_t nnodes);
+
+        /* not copyable */
+                                SlabPool(const SlabPool &x)         = delete;
+        SlabPool               &operator=(const SlabPool &x)        = delete;
+
+    public:
+                                SlabPool(size_t node_size, size_t node_align, size_t slab_bytes = 1 << 16);
+                               ~SlabPool();
+
+        inline void *
+        allocate()
+        {
+            this->nallocated++;
+            if (this->free_head) {
+                FreeNode *n     = this->free_head;
+                this->free_head = n->next;
+                return n;
+            }
+            if (this->bump_cur == this->bump_end) {
+                this->addSlab(this->slab_nodes);
+            }
+            void *p         = this->bump_cur;
+            this->bump_cur += this->node_size;
+            return p;
+        }
+
+        inline void
+        deallocate(void *p)
+        {
+            FreeNode *n     = static_cast<FreeNode *>(p);
+            n->next         = this->free_head;
+            this->free_head = n;
+            this->nallocated--;
+        }
+
+        /* make sure that the next n allocations are served without further slab allocations, using
+         * a single slab for all of them. */
+        void                    reserve(size_t n);
+
+        /* return all slabs to the system at once. all nodes handed out before are invalid
+         * afterwards, so the caller must have destroyed all objects living in them. */
+        void                    release();
+
+        /* take over all slabs and free nodes of x, which is empty afterwards. nodes allocated from
+         * x may be deallocated into (this) pool afterwards. node sizes must match. */
+        void                    adopt(SlabPool &x);
+
+        size_t                  nodeSize() const    { return this->node_size; }
+        size_t                  numAllocated() const { return this->nallocated; }
+        size_t                  numSlabs() const    { return this->slabs.size(); }
+};
+
+/* minimal C++11 allocator drawing single nodes from a SlabPool. requests that don't fit into a pool
+ * node (arrays, larger rebound types) and default constructed allocators without pool fall back to
+ * the global operator new. allocators propagate on container copy / move / swap, so that a
+ * container can be re-bound to another pool by move assignment. */
+template <typename T>
+class SlabAllocator {
+    template <typename U> friend class SlabAllocator;
+
+    private:
+        SlabPool   *pool;
+
+        inline bool
+        fromPool(size_t n) const
+        {
+            return (this->pool && n == 1 && sizeof(T) <= this->pool->nodeSize());
+        }
+
+    public:
+        typedef T                   value_type;
+        typedef T                  *pointer;
+        typedef const T            *const_pointer;
+        typedef T                  &reference;
+        typedef const T            &const_reference;
+        typedef size_t              size_type;
+        typedef ptrdiff_t           difference_type;
+        typedef std::true_type      propagate_on_container_copy_assignment;
+        typedef std::true_type      propagate_on_container_move_assignment;
+        typedef std::true_type      propagate_on_container_swap;
+
+        template <typename U>
+        struct rebind {
+            typedef SlabAllocator<U> other;
+        };
+
+        SlabAllocator() : pool(NULL) {}
+        explicit SlabAllocator(SlabPool *pool) : pool(pool) {}
+
+        template <typename U>
+        SlabAllocator(const SlabAllocator<U> &x) : pool(x.pool) {}
+
+        inline T *
+        allocate(size_t n)
+        {
+            if (this->fromPool(n)) {
+                return static_cast<T *>(this->pool->allocate());
+            }
+            else return static_cast<T *>(::operator new(n * sizeof(T)));
+        }
+
+        inline void
+        deallocate(T *p, size_t n)
+        {
+            if (this->fromPool(n)) {
+                this->pool->deallocate(p);
+            }
+            else ::operator delete(p);
+        }
+
+        template <typename U, typename... Args>
+        void
+        construct(U *p, Args&&... args)
+        {
+            ::new((void *)p) U(std::forward<Args>(args)...);
+        }
+
+        template <typename U>
+        void
+        destroy(U *p)
+        {
+            p->~U();
+        }
+
+        size_t
+        max_size() const
+        {
+            return std::numeric_limits<size_t>::max() / sizeof(T);
+        }
+
+        SlabPool *
+        getPool() const
+        {
+            return this->pool;
+        }
+
+        template <typename U>
+        bool operator==(const SlabAllocator<U> &x) const { return (this->pool == x.pool); }
+
+        template <typename U>
+        bool operator!=(const SlabAllocator<U> &x) const { return (this->pool != x.pool); }
+};
+
+#endif
@@ -0,0 +1,184 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SMALL_VECTOR
+#define SMALL_VECTOR
+
+#include "common.hh"
+
+/* vector of trivially copyable elements keeping up to N of them inside the object itself. used for
+ * the incidence lists of Graph, where almost all vertices have at most N incident edges: the edges
+ * are then stored in the vertex and iterating them touches no further memory. only when more than N
+ * elements are stored, they are moved to a heap array that grows geometrically.
+ *
+ * iterators are plain pointers and, as for std::vector, are invalidated by insertions and
+ * erasures. */
+template <typename T, uint32_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable<T>::value, "SmallVector: element type must be trivially copyable.");
+    static_assert(N > 0, "SmallVector: inline capacity must be positive.");
+
+    private:
+        T                  *elems;
+        uint32_t            n;
+        uint32_t            cap;
+        T                   inline_elems[N];
+
+        void
+        grow(uint32_t min_cap)
+        {
+            uint32_t    new_cap     = std::max<uint32_t>(2 * this->cap, min_cap);
+            T          *new_elems   = new T[new_cap];
+
+            std::copy(this->elems, this->elems + this->n, new_elems);
+            if (this->elems != this->inline_elems) {
+                delete[] this->elems;
+            }
+            this->elems = new_elems;
+            this->cap   = new_cap;
+        }
+
+    public:
+        typedef T          *iterator;
+        typedef T const    *const_iterator;
+        typedef T           value_type;
+
+        SmallVector() : elems(inline_elems), n(0), cap(N)
+        {
+        }
+
+        SmallVector(SmallVector const &x) : elems(inline_elems), n(0), cap(N)
+        {
+            this->operator=(x);
+        }
+
+       ~SmallVector()
+        {
+            if (this->elems != this->inline_elems) {
+                delete[] this->elems;
+            }
+        }
+
+        SmallVector &
+        operator=(SmallVector const &x)
+        {
+            if (this != &x) {
+                if (x.n > this->cap) {
+                    this->grow(x.n);
+                }
+                std::copy(x.elems, x.elems + x.n, this->elems);
+                this->n = x.n;
+            }
+            return (*this);
+        }
+
+        iterator            begin()                     { return this->elems; }
+        const_iterator      begin() const               { return this->elems; }
+        iterator            end()                       { return this->elems + this->n; }
+        const_iterator      end() const                 { return this->elems + this->n; }
+
+        size_t              size() const                { return this->n; }
+        bool                empty() const               { return (this->n == 0); }
+
+        T                  &operator[](size_t i)        { return this->elems[i]; }
+        T const            &operator[](size_t i) const  { return this->elems[i]; }
+        T                  &front()                     { return this->elems[0]; }
+        T const            &front() const               { return this->elems[0]; }
+        T                  &back()                      { return this->elems[this->n - 1]; }
+        T const            &back() const                { return this->elems[this->n - 1]; }
+
+        /* keeps the heap array, if any, for later insertions */
+        void                clear()                     { this->n = 0; }
+
+        void
+        reserve(uint32_t new_cap)
+        {
+            if (new_cap > this->cap) {
+                this->grow(new_cap);
+            }
+        }
+
+        void
+        push_back(T const &x)
+        {
+            if (this->n == this->cap) {
+                this->grow(this->n + 1);
+            }
+            this->elems[this->n++] = x;
+        }
+
+        void
+        pop_back()
+        {
+            --this->n;
+        }
+
+        /* insert x before pos, return iterator to inserted element */
+        iterator
+        insert(const_iterator pos, T const &x)
+        {
+            uint32_t i = pos - this->elems;
+            if (this->n == this->cap) {
+                this->grow(this->n + 1);
+            }
+            std::copy_backward(this->elems + i, this->elems + this->n, this->elems + this->n + 1);
+            this->elems[i] = x;
+            this->n++;
+            return (this->elems + i);
+        }
+
+        /* erase element at pos, return iterator to its successor */
+        iterator
+        erase(const_iterator pos)
+        {
+            uint32_t i = pos - this->elems;
+            std::copy(this->elems + i + 1, this->elems + this->n, this->elems + i);
+            this->n--;
+            return (this->elems + i);
+        }
+};
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TASKPOOL_H
+#define TASKPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+
+#include "common.hh"
+
+/* persistent pool of worker threads for batches of independent tasks. run(n, f) calls f(i) for every i in [0, n)
+ * and blocks until all calls have returned, the calling thread takes part as worker 0. the worker threads are
+ * created once and sleep between batches, so a batch only costs one wakeup per worker.
+ *
+ * the index range of a batch is split evenly among the workers. every worker owns a range [head, tail) packed into
+ * a single 64-bit atomic word: the owner takes tasks from the head, and a worker whose range has run dry steals the
+ * upper half of some other worker's range, both with a single compare-and-swap. no locks are taken while tasks are
+ * handed out, so expensive and cheap tasks can be mixed freely. since every index is handed out exactly once and a
+ * stolen range loses its lowest index to the thief immediately, a range word never takes the same value twice within
+ * a batch, which rules out ABA on the compare-and-swaps. */
+class TaskPool {
+    private:
+        /* range word of one worker, padded to its own cache line */
+        struct WorkerRange {
+            std::atomic<uint64_t>               range;
+            char                                pad[64 - sizeof(std::atomic<uint64_t>)];
+
+                                                WorkerRange() : range(0) {}
+        };
+
+        uint32_t                                nworkers;
+        std::vector<std::thread>                threads;
+        std::vector<WorkerRange>                ranges;
+
+        /* batch state, guarded by mutex. batch counts the batches started so far, nbusy the helper threads that
+         * have not finished the current batch yet. */
+        std::mutex                              mutex;
+        std::condition_variable                 cv_start;
+        std::condition_variable                 cv_done;
+        uint64_t                                batch;
+        uint32_t                                nbusy;
+        bool                                    shutdown;
+        std::function<void(size_t)> const      *task;
+        std::exception_ptr                      error;
+
+        void                                    stop();
+        static uint64_t                         packRange(uint32_t head, uint32_t tail);
+        bool                                    popOwn(uint32_t w, size_t &i);
+        bool                                    steal(uint32_t w, size_t &i);
+        void                                    work(uint32_t w);
+        void                                    workerLoop(uint32_t w);
+
+    public:
+        /* nworkers includes the calling thread, i.e. nworkers - 1 threads are spawned. */
+                                                TaskPool(uint32_t nworkers);
+                                               ~TaskPool();
+
+                                                TaskPool(TaskPool const &p) = delete;
+        TaskPool                               &operator=(TaskPool const &p) = delete;
+
+        uint32_t                                numWorkers() const;
+
+        /* first index of the range initially owned by worker w in a batch of n tasks */
+        static size_t                           rangeBegin(
+                                                    size_t                              n,
+                                                    uint32_t                            nworkers,
+                                                    uint32_t                            w);
+
+        /* layout for a batch of n tasks given in priority order: the k-th task is to be placed at index layout[k].
+         * the tasks are dealt round-robin into the initial worker ranges, so every worker starts with the most
+         * important tasks of its range and the least important ones are the first to be stolen. */
+        void                                    priorityLayout(
+                                                    size_t                              n,
+                                                    std::vector<size_t>                &layout) const;
+
+        /* call f(i) for all i in [0, n) and wait for completion. the order of calls is unspecified. the first
+         * exception thrown by any f is rethrown once all tasks have been processed. */
+        void                                    run(
+                                                    size_t                              n,
+                                                    std::function<void(size_t)> const  &f);
+};
+
+#endif
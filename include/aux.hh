@@ -127,6 +127,170 @@ namespace Aux {
 #endif
         }
 
+        /* compute the tables of bicof<R, n>() for all n <= nmax up front, e.g. before threads are spawned or
+         * processes are forked */
+        template <typename R, uint32_t nmax>
+        struct BicofTables {
+            static void init()
+            {
+                bicof<R, nmax>(0);
+                BicofTables<R, nmax - 1>::init();
+            }
+        };
+
+        template <typename R>
+        struct BicofTables<R, 0> {
+            static void init()
+            {
+                bicof<R, 0>(0);
+            }
+        };
+
+        /* -------------- */
+
+        /* slow path of parseDouble(): convert [begin, end) in the classic locale */
+        bool    parseDoubleClassic(char const *begin, char const *end, double &x);
+
+        /* locale-independent parsing of a decimal number "[+-]ddd[.ddd][(e|E)[+-]ddd]" starting at
+         * p without reading beyond end. on success, x is set, p is advanced past the number and
+         * true is returned. with at most 19 significant digits and a decimal exponent in
+         * [-22, 22], which covers everything printed with "%.10e", the mantissa and the power of
+         * ten are exact doubles and one multiplication / division gives the correctly rounded
+         * result. all other numbers take the slow path, so the result always equals strtod()'s. */
+        inline bool
+        parseDouble(
+            char const    *&p,
+            char const     *end,
+            double         &x)
+        {
+            static const double pow10[23] = {
+                    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+                };
+
+            char const     *s           = p;
+            bool            neg         = false;
+            bool            exact       = true;
+            uint64_t        m           = 0;
+            uint32_t        ndigits     = 0;
+            uint32_t        nsig        = 0;
+            int32_t         exp10       = 0;
+
+            if (s < end && (*s == '+' || *s == '-')) {
+                neg = (*s == '-');
+                s++;
+            }
+
+            /* integer and fractional part. digits beyond the 19th significant one don't fit m. */
+            for (bool frac = false; s < end; s++) {
+                if (*s >= '0' && *s <= '9') {
+                    ndigits++;
+                    if (m != 0 || *s != '0') {
+                        if (++nsig > 19) {
+                            exact = false;
+                        }
+                        else {
+                            m = 10 * m + (*s - '0');
+                        }
+                    }
+                    exp10 -= frac;
+                }
+                else if (*s == '.' && !frac) {
+                    frac = true;
+                }
+                else {
+                    break;
+                }
+            }
+            if (ndigits == 0) {
+                return false;
+            }
+
+            if (s < end && (*s == 'e' || *s == 'E')) {
+                char const *e       = s + 1;
+                bool        eneg    = false;
+                int32_t     ev      = 0;
+
+                if (e < end && (*e == '+' || *e == '-')) {
+                    eneg = (*e == '-');
+                    e++;
+                }
+                if (e == end || *e < '0' || *e > '9') {
+                    return false;
+                }
+                for (; e < end && *e >= '0' && *e <= '9'; e++) {
+                    ev = std::min<int32_t>(10 * ev + (*e - '0'), 100000);
+                }
+                exp10  += eneg ? -ev : ev;
+                s       = e;
+            }
+
+            if (!exact || m > (1ull << 53) || exp10 < -22 || exp10 > 22) {
+                if (!parseDoubleClassic(p, s, x)) {
+                    return false;
+                }
+            }
+            else {
+                x = (exp10 < 0) ? (double)m / pow10[-exp10] : (double)m * pow10[exp10];
+                x = neg ? -x : x;
+            }
+
+            p = s;
+            return true;
+        }
+
+        /* parse a decimal unsigned 32 bit integer starting at p, see parseDouble() */
+        inline bool
+        parseUInt32(
+            char const    *&p,
+            char const     *end,
+            uint32_t       &x)
+        {
+            char const *s = p;
+            uint64_t    v = 0;
+
+            for (; s < end && *s >= '0' && *s <= '9'; s++) {
+                v = 10 * v + (*s - '0');
+                if (v > UINT32_MAX) {
+                    return false;
+                }
+            }
+            if (s == p) {
+                return false;
+            }
+
+            x = (uint32_t)v;
+            p = s;
+            return true;
+        }
+
+        /* write exactly the characters printf("%+.10e", x) would produce to out, which must have
+         * room for 32 characters, and return their number. no terminating zero is written. finite
+         * x with a moderate exponent are scaled by an exact power of ten in long double precision
+         * and rounded to 11 digits directly, everything else (and results close to a rounding
+         * tie) falls back to snprintf(). */
+        uint32_t    formatExp10(char *out, double x);
+
+        /* write the decimal representation of x to out (at most 10 characters, no terminating
+         * zero) and return the number of characters written */
+        inline uint32_t
+        formatUInt32(
+            char       *out,
+            uint32_t    x)
+        {
+            char        tmp[10];
+            uint32_t    n = 0;
+
+            do {
+                tmp[n++]    = '0' + (x % 10);
+                x          /= 10;
+            } while (x);
+
+            for (uint32_t i = 0; i < n; i++) {
+                out[i] = tmp[n - 1 - i];
+            }
+            return n;
+        }
     }
 
     namespace Numerics {
@@ -719,6 +883,66 @@ namespace Aux {
 
     namespace File {
         bool isEmpty(FILE *f);
+
+        /* fseek() to an absolute 64 bit offset, returns false on failure */
+        bool seek(FILE *f, uint64_t offset);
+
+        /* names of all regular files in directory path ending in suffix (and not equal to it), sorted.
+         * returns false if path is not a readable directory. */
+        bool listDirectory(std::string const &path, std::string const &suffix, std::vector<std::string> &names);
+
+        /* read-only view of a whole file: memory-mapped where mmap() is available, read into a
+         * buffer otherwise. the data is aligned to at least 8 bytes and stays valid until
+         * close() or destruction. */
+        class MappedFile {
+            private:
+                char const             *map_data;
+                size_t                  map_size;
+                bool                    mapped;
+                std::vector<uint64_t>   buffer;
+
+            public:
+                                        MappedFile();
+                                        MappedFile(MappedFile const &) = delete;
+                MappedFile             &operator=(MappedFile const &) = delete;
+                                       ~MappedFile();
+
+                /* returns false if the file can't be opened or read. sequential advises the
+                 * kernel to read ahead aggressively. */
+                bool                    open(const char *filename, bool sequential = true);
+                void                    close();
+
+                char const             *data() const;
+                size_t                  size() const;
+        };
+
+        /* writable, zero-initialised array of bytes backed by a scratch file, which is removed by
+         * close(). where mmap() is available, the file is mapped shared, so that the kernel can page
+         * the array out to the file instead of keeping it in memory. otherwise, the array is held in
+         * memory. resize() keeps the contents, new bytes are zero. */
+        class ScratchArray {
+            private:
+                char                   *map_data;
+                size_t                  map_size;
+                size_t                  array_size;
+                int                     fd;
+                std::string             filename;
+                std::vector<uint64_t>   buffer;
+
+            public:
+                                        ScratchArray();
+                                        ScratchArray(ScratchArray const &) = delete;
+                ScratchArray           &operator=(ScratchArray const &) = delete;
+                                       ~ScratchArray();
+
+                /* returns false if the scratch file can't be created */
+                bool                    open(std::string const &filename, size_t size);
+                bool                    resize(size_t size);
+                void                    close();
+
+                char                   *data();
+                size_t                  size() const;
+        };
     }
 
     namespace Geometry {
@@ -1620,6 +1844,109 @@ namespace Aux {
             size_t             *idx     = 0,
             int                 base    = 10);
 
+        /* split the index range [0, n) into nchunks contiguous chunks of (almost) equal size and
+         * call f(begin, end, chunk) for every chunk on a thread of its own. the calling thread
+         * processes the last chunk itself. the chunking only depends on n and nchunks, so f can
+         * keep per-chunk state indexed by chunk. the first exception thrown by any f is rethrown
+         * after all threads have been joined. */
+        template <typename F>
+        void
+        parallelFor(
+            size_t      n,
+            uint32_t    nchunks,
+            F const    &f)
+        {
+            std::vector<std::thread>        threads;
+            std::vector<std::exception_ptr> errors(std::max<uint32_t>(nchunks, 1));
+            uint32_t                        c;
+
+            nchunks = std::max<uint32_t>(nchunks, 1);
+            auto run = [&] (uint32_t c) -> void
+                {
+                    try {
+                        f((n * c) / nchunks, (n * (c + 1)) / nchunks, c);
+                    }
+                    catch (...) {
+                        errors[c] = std::current_exception();
+                    }
+                };
+
+            for (c = 0; c + 1 < nchunks; c++) {
+                threads.push_back(std::thread(run, c));
+            }
+            run(nchunks - 1);
+
+            for (auto &t : threads) {
+                t.join();
+            }
+            for (auto &e : errors) {
+                if (e) {
+                    std::rethrow_exception(e);
+                }
+            }
+        }
+
+        /* limit the number of threads used by parallelChunks() for the whole process, e.g. in
+         * processes sharing the machine with others. 0 (default) means one per hardware thread. */
+        void        setMaxThreads(uint32_t n);
+        uint32_t    maxThreads();
+
+        /* number of chunks for parallelFor(): one per hardware thread, but at least grain elements
+         * per chunk */
+        inline uint32_t
+        parallelChunks(
+            size_t      n,
+            size_t      grain)
+        {
+            size_t nhw = maxThreads();
+            return static_cast<uint32_t>(std::max<size_t>(std::min(nhw, n / grain), 1));
+        }
+
+        /* write n items to f, formatted in parallel. format(i, out) writes item i to out, which
+         * has room for max_item_size characters, and returns the number of characters written.
+         * items are processed in batches: every chunk of a batch formats a contiguous range into
+         * a buffer of its own, which are then written in order with one fwrite() each. returns
+         * false if any write failed. */
+        template <typename F>
+        bool
+        parallelWrite(
+            FILE       *f,
+            size_t      n,
+            size_t      max_item_size,
+            F const    &format)
+        {
+            /* items per chunk and batch, keeps each buffer at a few MB */
+            size_t const                    chunk_items = std::max<size_t>((1 << 22) / max_item_size, 1);
+#ifdef __DEBUG__
+            /* debug output is not thread-safe */
+            uint32_t const                  nchunks     = 1;
+#else
+            uint32_t const                  nchunks     = parallelChunks(n, chunk_items);
+#endif
+            std::vector<std::vector<char>>  buffers(nchunks, std::vector<char>(std::min(n, chunk_items) * max_item_size));
+            std::vector<size_t>             lengths(nchunks);
+            bool                            ok          = true;
+
+            for (size_t batch_begin = 0; batch_begin < n; batch_begin += nchunks * chunk_items) {
+                size_t batch_n = std::min(n - batch_begin, nchunks * chunk_items);
+
+                parallelFor(batch_n, nchunks,
+                    [&] (size_t begin, size_t end, uint32_t chunk) -> void
+                    {
+                        char *out = buffers[chunk].data();
+                        for (size_t i = begin; i < end; i++) {
+                            out += format(batch_begin + i, out);
+                        }
+                        lengths[chunk] = out - buffers[chunk].data();
+                    });
+
+                for (uint32_t c = 0; c < nchunks; c++) {
+                    ok = ok && (fwrite(buffers[c].data(), 1, lengths[c], f) == lengths[c]);
+                }
+            }
+            return ok;
+        }
+
         template<typename T>
         bool
         vectorContains(const std::vector<T> &vec, const T &x)
@@ -1657,12 +1984,12 @@ namespace Aux {
 
         // EDIT: added pointer-* to parameter type of x and compare IDs rather than memory addresses
         // as this function is used exclusively in the case where x is a pointer to a geometric object
-        template<typename T>
+        template<typename T, typename TAlloc>
         bool
         listSortedInsert(
-            std::list<T*>    &l,
-            T*               x,
-            bool             duplicates = false)
+            std::list<T*, TAlloc>  &l,
+            T*                      x,
+            bool                    duplicates = false)
         {
             auto    lit = l.begin();
             while (lit != l.end() && (*lit)->id() < x->id()) {
@@ -71,12 +71,15 @@
 #include <set>
 #include <string>
 #include <thread>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <algorithm>
 // author forgot <numeric> which s sometimes included implicitly
 #include <numeric>
 #include <stdexcept>
+#include <exception>
 
 /* stream io */
 #include <iostream>
@@ -93,6 +96,8 @@
     #include <netdb.h>
     #include <arpa/inet.h>
     #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
 #endif
 
 namespace Common {
@@ -48,6 +48,11 @@
 #include "NLM_CellNetwork.hh"
 #include "CellNetworkAlg.hh"
 #include "MeshAlgorithms.hh"
+#include "Profiler.hh"
+
+#ifndef __WIN32__
+    #include <sys/wait.h>
+#endif
 
 /* initialize static command line switch info */
 const std::list<
@@ -73,11 +78,20 @@ const std::list<
         { "ana-nthreads",                           1 },
         { "ana-univar-eps",                         1 },
         { "ana-bivar-eps",                          1 },
+        { "ana-stop-at-first-isec",                 0 },
         { "no-mesh-pp",                             0 },
         { "mesh-pp-gec",                            4 },
         { "no-mesh-pp-gec",                         0 },
         { "mesh-pp-hc",                             3 },
         { "no-mesh-pp-hc",                          0 },
+        { "mesh-pp-input",                          1 },
+        { "mesh-pp-binary",                         0 },
+        { "mesh-pp-in-memory",                      0 },
+        { "meshing-no-obj",                         0 },
+        { "mesh-ooc",                               1 },
+        { "batch",                                  1 },
+        { "batch-nworkers",                         1 },
+        { "profile",                                1 },
         { "meshing-soma-refs",                      1 },
         { "meshing-cansurf-angularsegments",        1 },
         { "meshing-triangle-height",                1 },
@@ -106,6 +120,14 @@ const std::list<
         { "mesh-pp-hc",     "no-mesh-pp-hc" },
         { "no-mesh-pp",     "mesh-pp-gec"},
         { "no-mesh-pp",     "mesh-pp-hc"},
+        { "no-mesh-pp",     "mesh-pp-input"},
+        { "no-mesh-pp",     "mesh-pp-binary"},
+        { "no-mesh-pp",     "mesh-pp-in-memory"},
+        { "mesh-pp-input",  "mesh-pp-in-memory"},
+        { "mesh-ooc",       "mesh-pp-in-memory"},
+        { "mesh-ooc",       "mesh-pp-binary"},
+        { "i",              "batch"},
+        { "batch",          "mesh-pp-input"},
         { "meshing-flush",  "no-meshing-flush" },
         { "no-analysis",    "meshing" },
         { "no-analysis",    "force-meshing" },
@@ -118,6 +140,9 @@ const std::list<
         { "no-analysis",    "meshing-merging-initial-radiusfactor", },
         { "no-analysis",    "meshing-merging-radiusfactor-decrement"},
         { "no-analysis",    "meshing-complexedge-max-growthfactor"  },
+        { "no-analysis",    "mesh-pp-in-memory"                     },
+        { "no-analysis",    "meshing-no-obj"                        },
+        { "no-analysis",    "ana-stop-at-first-isec"                },
     };
 
 const std::string usage_string = 
@@ -175,8 +200,8 @@ const std::string usage_string =
 "                                the network name is the name of the SWC\n"\
 "                                morphology file without suffix (that is,\n"\
 "                                without \".swc\").\n"\
-"                                for convenience, the extensions \".swc\", \".obj\"\n"\
-"                                and \".amv\" are stripped from the input\n"\
+"                                for convenience, the extensions \".swc\", \".obj\",\n"\
+"                                \".amb\" and \".amv\" are stripped from the input\n"\
 "                                string if present.\n"\
 "                                EXAMPLE: the network name for \"ri05.CNG.swc\"\n"\
 "                                if \"ri05.CNG\". using \"ri05.CNG.obj\" would yield\n"\
@@ -218,6 +243,14 @@ const std::string usage_string =
 "                                <eps> must be in [1E-11, 1E-3].\n"\
 "                                DEFAULT: 1E-4.\n"\
 "\n"\
+" -ana-stop-at-first-isec        stop the geometric analysis as soon as the first\n"\
+"                                intersection has been found, which is then the\n"\
+"                                only one reported. the cheapest intersection\n"\
+"                                tests are run first. useful to triage a large\n"\
+"                                number of morphologies, if only the information\n"\
+"                                whether a network is clean is required.\n"\
+"                                DEFAULT: disabled.\n"\
+"\n"\
 " -cellnet-pc <alpha> <beta> <gamma>\n"\
 " -no-cellnet-pc\n"\
 "                                enable / disable cell network preconditioning.\n"\
@@ -491,6 +524,74 @@ const std::string usage_string =
 "\n"\
 "                                \"<CELLNETWORK>_post_processed.obj\".\n"\
 "\n"\
+" -mesh-pp-input <MESH_FILE>     post-process the given mesh file instead of the\n"\
+"                                union mesh \"<CELLNETWORK>.obj\". files ending\n"\
+"                                in \".amb\" are read as binary meshes, all others\n"\
+"                                as obj files. an input file \"<CELLNETWORK>.amb\"\n"\
+"                                given with -i is post-processed by default.\n"\
+"\n"\
+" -mesh-pp-binary                write the post-processed mesh in the binary mesh\n"\
+"                                format to \"<CELLNETWORK>_post_processed.amb\"\n"\
+"                                instead of an obj file. binary meshes load much\n"\
+"                                faster and are accepted by am_meshstat as well.\n"\
+"                                DEFAULT: obj output.\n"\
+"\n"\
+" -mesh-pp-in-memory             hand the union mesh over to post-processing in\n"\
+"                                memory instead of re-reading \"<CELLNETWORK>.obj\".\n"\
+"                                with -meshing-flush, only the flushed part is\n"\
+"                                read back from disk. the result differs slightly\n"\
+"                                from the default, since the union mesh is not\n"\
+"                                rounded to the ten decimal places of the obj file.\n"\
+"                                DEFAULT: disabled.\n"\
+"\n"\
+" -meshing-no-obj                don't write the union mesh \"<CELLNETWORK>.obj\".\n"\
+"                                with -meshing-flush, the file is still used to\n"\
+"                                swap out flushed parts and removed afterwards.\n"\
+"                                requires -mesh-pp-in-memory or -mesh-ooc.\n"\
+"\n"\
+" -mesh-ooc <budget>             keep flushed parts of the union mesh and the\n"\
+"                                mesh under post-processing out of core, in\n"\
+"                                spatial pages on the scratch file\n"\
+"                                \"<CELLNETWORK>.pages.*\", which is removed\n"\
+"                                afterwards. <budget> in MB limits the size of\n"\
+"                                a page and of the write buffers. post-processing\n"\
+"                                runs page by page and leaves page seams in\n"\
+"                                place, so its result differs from the default.\n"\
+"                                only obj files are accepted by -mesh-pp-input.\n"\
+"                                DEFAULT: disabled.\n"\
+"\n"\
+" -batch <LIST>                  process many networks in one run instead of the\n"\
+"                                single one given with -i. <LIST> is either a\n"\
+"                                directory, whose \".swc\" files are processed,\n"\
+"                                or a text file naming one input file per line\n"\
+"                                (paths relative to the working directory, empty\n"\
+"                                lines and lines starting with '#' are ignored).\n"\
+"                                all other switches apply to every network. each\n"\
+"                                network is processed in a worker process of its\n"\
+"                                own, writing its output to \"<CELLNETWORK>.log\",\n"\
+"                                so that failures and crashes only affect that\n"\
+"                                network. a summary of all results is written to\n"\
+"                                \"<LIST>/batch.summary\" for a directory and to\n"\
+"                                \"<LIST>.summary\" for a list file.\n"\
+"\n"\
+" -batch-nworkers <n>            number of networks processed simultaneously in\n"\
+"                                batch mode. parallel mesh processing within a\n"\
+"                                network shares the remaining hardware threads,\n"\
+"                                -ana-nthreads is limited to the same share.\n"\
+"                                DEFAULT: <n> = number of hardware threads.\n"\
+"\n"\
+" -profile <file>                write a profile of the run to <file> in JSON\n"\
+"                                format: the tree of processing stages (parse,\n"\
+"                                preconditioning, partition, geometry, analysis\n"\
+"                                with job generation and one solve stage per job\n"\
+"                                type, meshing with per-path merging, RedBlue\n"\
+"                                calls and flushes, post-processing with GEC and\n"\
+"                                HC) with wall time, cpu time and number of calls\n"\
+"                                per stage, and counters such as the number of\n"\
+"                                jobs or RedBlue retries. in batch mode, each\n"\
+"                                network writes \"<CELLNETWORK>_<file>\".\n"\
+"                                DEFAULT: disabled.\n"\
+"\n"\
 " -debug-lvl <cmp> <lvl>         Enable debugging for component <cmp>\n"\
 "                                and set debug level to <lvl>.\n"\
 "                                Debug component 0 is global debugging.\n"\
@@ -514,6 +615,7 @@ AnaMorph_cellgen::AnaMorph_cellgen(
     this->ana_nthreads                              = 1;
     this->ana_univar_solver_eps                     = 1E-6;
     this->ana_bivar_solver_eps                      = 1E-4;
+    this->ana_stop_at_first_isec                    = false;
 
     this->partition_algo                            = NLM_CellNetwork<double>::partition_select_max_chordal_depth(
                                                           M_PI / 2.0,
@@ -554,6 +656,17 @@ AnaMorph_cellgen::AnaMorph_cellgen(
     this->pp_hc_alpha                               = 0.4;
     this->pp_hc_beta                                = 0.7;
     this->pp_hc_maxiter                             = 10;
+
+    this->pp_input_filename                         = "";
+    this->pp_output_binary                          = false;
+    this->pp_in_memory                              = false;
+    this->meshing_no_obj                            = false;
+    this->ooc_memory_budget                         = 0;
+
+    this->profile_filename                          = "";
+
+    this->batch_list                                = "";
+    this->batch_nworkers                            = std::max<unsigned int>(std::thread::hardware_concurrency(), 1);
 }
 
 bool
@@ -561,6 +674,8 @@ AnaMorph_cellgen::processCommandLineArguments()
 {
     using Aux::Alg::stou;
 
+    bool batch_nworkers_set = false;
+
     if (this->cl_settings.empty()) {
         printf("%s", this->usage_text.c_str());
         return false;
@@ -577,6 +692,32 @@ AnaMorph_cellgen::processCommandLineArguments()
         if (s == "i") {
             this->network_name = s_args.front();
         }
+        else if (s == "batch") {
+            this->batch_list = s_args.front();
+        }
+        else if (s == "batch-nworkers") {
+            try {
+                this->batch_nworkers    = stou(s_args[0]);
+                batch_nworkers_set      = true;
+            }
+            catch (std::out_of_range& ex) {
+                printf("ERROR: argument to switch \"batch-nworkers\" out of range.\n");
+                return false;
+            }
+            catch (...) {
+                printf("ERROR: invalid argument to switch \"batch-nworkers\".\n");
+                return false;
+            }
+
+            /* check value */
+            if (this->batch_nworkers == 0) {
+                printf("ERROR: number of workers given to switch \"batch-nworkers\" must be positive.\n");
+                return false;
+            }
+        }
+        else if (s == "profile") {
+            this->profile_filename = s_args.front();
+        }
         else if (s == "analysis") {
             this->ana = true;
         }
@@ -751,6 +892,9 @@ AnaMorph_cellgen::processCommandLineArguments()
                 return false;
             }
         }
+        else if (s == "ana-stop-at-first-isec") {
+            this->ana_stop_at_first_isec = true;
+        }
         else if (s == "no-mesh-pp") {
             this->pp_gec    = false;
             this->pp_hc     = false;
@@ -825,6 +969,37 @@ AnaMorph_cellgen::processCommandLineArguments()
         else if (s == "no-mesh-pp-hc") {
             this->pp_hc = false;
         }
+        else if (s == "mesh-pp-input") {
+            this->pp_input_filename = s_args.front();
+        }
+        else if (s == "mesh-pp-binary") {
+            this->pp_output_binary = true;
+        }
+        else if (s == "mesh-pp-in-memory") {
+            this->pp_in_memory = true;
+        }
+        else if (s == "meshing-no-obj") {
+            this->meshing_no_obj = true;
+        }
+        else if (s == "mesh-ooc") {
+            try {
+                this->ooc_memory_budget = stou(s_args[0]);
+            }
+            catch (std::out_of_range& ex) {
+                printf("ERROR: argument to switch \"mesh-ooc\" out of range.\n");
+                return false;
+            }
+            catch (...) {
+                printf("ERROR: invalid argument to switch \"mesh-ooc\".\n");
+                return false;
+            }
+
+            /* check value */
+            if (this->ooc_memory_budget < 16) {
+                printf("ERROR: memory budget parameter to switch \"mesh-ooc\" must be in [16, oo].\n");
+                return false;
+            }
+        }
         else if (s == "meshing-soma-refs") {
             try {
                 meshing_n_soma_refs = stou(s_args[0]);
@@ -1009,51 +1184,139 @@ AnaMorph_cellgen::processCommandLineArguments()
     }
 
     /* further checks on successfully parsed command line arguments */
-    if (this->network_name == "") {
+    if (this->batch_list != "") {
+        /* input file names are taken from the list */
+    }
+    else if (this->network_name == "") {
         printf("ERROR: no input file name given.\n");
         return false;
     }
+    else if (!this->setNetworkName(this->network_name)) {
+        return false;
+    }
+
+    if (this->batch_list == "" && batch_nworkers_set) {
+        printf("ERROR: switch \"batch-nworkers\" requires \"batch\".\n");
+        return false;
+    }
+    if (this->meshing_no_obj && (!(this->pp_in_memory || this->ooc_memory_budget) || !(this->pp_gec || this->pp_hc))) {
+        printf("ERROR: switch \"meshing-no-obj\" requires in-memory or out-of-core post-processing (\"mesh-pp-in-memory\", \"mesh-ooc\").\n");
+        return false;
+    }
+
+    return true;
+}
+
+bool
+AnaMorph_cellgen::setNetworkName(std::string const &filename)
+{
+    this->network_name = filename;
+
     /* remove .swc suffix from network_name */
-    else {
-        size_t  network_name_last_dot_index = this->network_name.find_last_of(".");
-        if (network_name_last_dot_index != std::string::npos) {
-            std::string network_name_extension = this->network_name.substr(network_name_last_dot_index, std::string::npos);
-            if (    network_name_extension != ".swc" &&
-                    network_name_extension != ".amv" &&
-                    network_name_extension != ".obj" &&
-                    network_name_extension != ".CNG")
-            {
-                printf("ERROR: input file name invalid.\n");
-                return false;
+    size_t  network_name_last_dot_index = this->network_name.find_last_of(".");
+    if (network_name_last_dot_index != std::string::npos) {
+        std::string network_name_extension = this->network_name.substr(network_name_last_dot_index, std::string::npos);
+        if (    network_name_extension != ".swc" &&
+                network_name_extension != ".amv" &&
+                network_name_extension != ".obj" &&
+                network_name_extension != ".amb" &&
+                network_name_extension != ".CNG")
+        {
+            printf("ERROR: input file name invalid.\n");
+            return false;
+        }
+        else {
+            /* a binary mesh given as input is what is to be post-processed */
+            if (network_name_extension == ".amb" && this->pp_input_filename == "") {
+                this->pp_input_filename = this->network_name;
             }
-            else {
-                if (network_name_extension != ".CNG") {
-                    this->network_name = this->network_name.substr(0, network_name_last_dot_index);
-                }
+            if (network_name_extension != ".CNG") {
+                this->network_name = this->network_name.substr(0, network_name_last_dot_index);
             }
         }
     }
 
+    if (this->pp_in_memory && this->pp_input_filename != "") {
+        printf("ERROR: switch \"mesh-pp-in-memory\" can't be used with a mesh file as post-processing input.\n");
+        return false;
+    }
+
     return true;
 }
 
 bool
 AnaMorph_cellgen::run()
 {
-    try {
-        /* process command line arguments and return false if an error has occurred */
-        if (!this->processCommandLineArguments()) {
-            return false;
-        }
+    /* process command line arguments and return false if an error has occurred */
+    if (!this->processCommandLineArguments()) {
+        return false;
+    }
+
+    if (this->batch_list != "") {
+        return this->runBatch();
+    }
+    else {
+        return this->runNetwork();
+    }
+}
+
+int
+AnaMorph_cellgen::runNetwork()
+{
+    if (this->profile_filename == "") {
+        return this->processNetwork();
+    }
+
+    /* in batch mode, the profile of each network is written next to its other output */
+    std::string profile_filename = this->profile_filename;
+    if (this->batch_list != "") {
+        profile_filename = this->network_name + "_" + profile_filename;
+    }
+
+    Profiler::enable();
+    int rc = this->processNetwork();
 
+    char nthreads[16];
+    snprintf(nthreads, sizeof(nthreads), "%u", this->ana_nthreads);
+    if (!Profiler::writeJSON(profile_filename, {
+            { "program",        "am_cellgen" },
+            { "network",        this->network_name },
+            { "status",         (rc == EXIT_SUCCESS) ? "ok" : "failed" },
+            { "ana_nthreads",   nthreads } }))
+    {
+        printf("ERROR: can't write profile \"%s\".\n", profile_filename.c_str());
+    }
+    Profiler::disable();
+
+    return rc;
+}
+
+int
+AnaMorph_cellgen::processNetwork()
+{
+    try {
         /* try to open input file */
         printf("AnaMorph cell generator (non-linear geometric modelling). swc input file name: \"%s.swc\"\n", this->network_name.c_str());
 
+        /* union mesh to be post-processed. filled directly by the meshing stage with
+         * -mesh-pp-in-memory, read from disk otherwise. */
+        Mesh<bool, bool, bool, double>  M_cell;
+        bool                            M_cell_rendered = false;
+
+        /* with -mesh-ooc, the union mesh lives in a page store instead */
+        std::unique_ptr<MeshPageStore<double>> M_cell_store;
+        if (this->ooc_memory_budget) {
+            M_cell_store.reset(new MeshPageStore<double>(this->network_name + ".pages", (size_t)this->ooc_memory_budget << 20));
+        }
+
         /* analysis and mesh generation */
         if (this->ana) {
             printf("reading network from input swc file \"%s.swc\"..", this->network_name.c_str());fflush(stdout);
             NLM_CellNetwork<double> C(this->network_name);
-            C.readFromNeuroMorphoSWCFile( this->network_name + ".swc", false);
+            {
+                Profiler::Scope prof_parse("parse");
+                C.readFromNeuroMorphoSWCFile( this->network_name + ".swc", false);
+            }
 
             printf("done.\n"\
                 "\t neuron vertices: %6zu   somas:              %6zu  axon vertices:   %6zu  dendrite vertices:   %6zu\n"\
@@ -1068,6 +1331,7 @@ AnaMorph_cellgen::run()
             C_settings.analysis_nthreads                        = this->ana_nthreads;
             C_settings.analysis_univar_solver_eps               = this->ana_univar_solver_eps;
             C_settings.analysis_bivar_solver_eps                = this->ana_bivar_solver_eps;
+            C_settings.analysis_stop_at_first_intersection      = this->ana_stop_at_first_isec;
 
             C_settings.partition_algo                           = this->partition_algo;
             C_settings.parametrization_algo                     = this->parametrization_algo;
@@ -1104,6 +1368,7 @@ AnaMorph_cellgen::run()
                     this->pc_alpha, this->pc_beta, this->pc_gamma);
                 fflush(stdout);
 
+                Profiler::Scope prof_pc("preconditioning");
                 CellNetworkAlg::preliminaryPreconditioning(C, this->pc_alpha, this->pc_beta, this->pc_gamma);
                 printf("done.\n\n");
             }
@@ -1117,16 +1382,26 @@ AnaMorph_cellgen::run()
 
             /* partition cell network and update geometry */
             printf("partitioning cell network.. ");fflush(stdout);
-            C.partitionNetwork();
+            {
+                Profiler::Scope prof_partition("partition");
+                C.partitionNetwork();
+            }
             printf("done.\n");
 
             printf("updating cell network geometry.. ");fflush(stdout);
-            C.updateNetworkGeometry();
+            {
+                Profiler::Scope prof_geometry("geometry");
+                C.updateNetworkGeometry();
+            }
             printf("done.\n");
 
             /* perform full analysis */
             printf("performing single full geometric analysis iteration.. ");fflush(stdout);
-            bool clean = C.performFullAnalysis();
+            bool clean;
+            {
+                Profiler::Scope prof_analysis("analysis");
+                clean = C.performFullAnalysis();
+            }
             printf("done.\n");
 
 #if 0	// This is meaningless unless one has the morphview code.
@@ -1144,12 +1419,23 @@ AnaMorph_cellgen::run()
 
             /* render cell network mesh */
             if (clean || this->force_meshing) {
-                printf("rendering cell network to consistent mesh \"%s.obj\".\n", network_name.c_str());
+                if (this->meshing_no_obj) {
+                    printf("rendering cell network to consistent mesh in memory.\n");
+                }
+                else {
+                    printf("rendering cell network to consistent mesh \"%s.obj\".\n", network_name.c_str());
+                }
                 if (this->force_meshing) {
                     printf("\t NOTE: meshing forced in spite of potentially unclean network.\n");fflush(stdout);
                 }
 
-                C.renderCellNetwork<bool, bool, bool>(network_name);
+                Profiler::Scope prof_meshing("meshing");
+                C.renderCellNetwork<bool, bool, bool>(
+                    network_name,
+                    this->pp_in_memory ? &M_cell : NULL,
+                    !this->meshing_no_obj,
+                    M_cell_store.get());
+                M_cell_rendered = this->pp_in_memory || M_cell_store;
 
                 printf("done.\n\n");
             }
@@ -1167,11 +1453,46 @@ AnaMorph_cellgen::run()
 
         /* mesh-post-processing */
         if (this->pp_gec || this->pp_hc) {
-            printf("post-processing union mesh \"%s.obj\".\n", this->network_name.c_str() );
-            /* reload mesh to ram */
-            Mesh<bool, bool, bool, double> M_cell;
+            std::string pp_input = (this->pp_input_filename != "") ? this->pp_input_filename : (this->network_name + ".obj");
+
+            if (this->pp_in_memory) {
+                printf("post-processing union mesh in memory.\n");
+            }
+            else if (M_cell_store && M_cell_rendered && this->pp_input_filename == "") {
+                printf("post-processing union mesh out of core, memory budget: %u MB.\n", this->ooc_memory_budget);
+            }
+            else {
+                printf("post-processing union mesh \"%s\".\n", pp_input.c_str() );
+            }
+
+            Profiler::Scope prof_pp("post_processing");
+
             try {
-                M_cell.readFromObjFile( (network_name + ".obj").c_str());
+                /* reload mesh to ram unless it has been handed over by the meshing stage */
+                {
+                    Profiler::Scope prof_read("read");
+                    if (M_cell_store) {
+                        if (!M_cell_rendered || this->pp_input_filename != "") {
+                            printf("\t reading \"%s\" into page store, memory budget: %u MB.\n", pp_input.c_str(), this->ooc_memory_budget);
+
+                            /* a rendered union mesh is dropped first, both share the scratch file name */
+                            M_cell_store.reset();
+                            M_cell_store.reset(new MeshPageStore<double>(this->network_name + ".pages", (size_t)this->ooc_memory_budget << 20));
+
+                            std::vector<double>     pos;
+                            std::vector<uint32_t>   idx;
+                            Mesh<bool, bool, bool, double>::readObjArrays(pp_input.c_str(), pos, idx);
+                            M_cell_store->addArrays(pos.size() / 3, pos.data(), idx.size() / 4, idx.data());
+                        }
+                    }
+                    else if (!this->pp_in_memory) {
+                        M_cell.readFromFile(pp_input.c_str());
+                    }
+                    else if (!M_cell_rendered) {
+                        throw MeshEx(MESH_IO_ERROR, "AnaMorph_cellgen::run(): no union mesh has been rendered.");
+                    }
+                }
+
                 if (this->pp_gec) {
                     printf("\t stage 1: improved edge-collapse algorithm. parameters:\n"\
                         "\t\t alpha:  %5.4f\n"\
@@ -1180,12 +1501,25 @@ AnaMorph_cellgen::run()
                         "\t\t d:      %5d\n",
                         this->pp_gec_alpha, this->pp_gec_lambda, this->pp_gec_mu, this->pp_gec_d);
 
-                    MeshAlg::greedyEdgeCollapsePostProcessing(
-                        M_cell,
-                        this->pp_gec_alpha,
-                        this->pp_gec_lambda,
-                        this->pp_gec_mu,
-                        this->pp_gec_d);
+                    Profiler::Scope prof_gec("gec");
+                    if (M_cell_store) {
+                        MeshAlg::outOfCorePostProcessing<bool, bool, bool>(
+                            *M_cell_store,
+                            true,
+                            this->pp_gec_alpha,
+                            this->pp_gec_lambda,
+                            this->pp_gec_mu,
+                            this->pp_gec_d,
+                            false, 0.0, 0.0, 0);
+                    }
+                    else {
+                        MeshAlg::greedyEdgeCollapsePostProcessing(
+                            M_cell,
+                            this->pp_gec_alpha,
+                            this->pp_gec_lambda,
+                            this->pp_gec_mu,
+                            this->pp_gec_d);
+                    }
                 }
 
                 if (this->pp_hc) {
@@ -1195,18 +1529,39 @@ AnaMorph_cellgen::run()
                         "\t\t maxiter: %5d\n",
                         this->pp_hc_alpha, this->pp_hc_beta, this->pp_hc_maxiter);
 
-                    MeshAlg::HCLaplacianSmoothing(
-                        M_cell,
-                        this->pp_hc_alpha,
-                        this->pp_hc_beta,
-                        this->pp_hc_maxiter);
+                    Profiler::Scope prof_hc("hc");
+                    if (M_cell_store) {
+                        MeshAlg::outOfCorePostProcessing<bool, bool, bool>(
+                            *M_cell_store,
+                            false, 0.0, 0.0, 0.0, 0,
+                            true,
+                            this->pp_hc_alpha,
+                            this->pp_hc_beta,
+                            this->pp_hc_maxiter);
+                    }
+                    else {
+                        MeshAlg::HCLaplacianSmoothing(
+                            M_cell,
+                            this->pp_hc_alpha,
+                            this->pp_hc_beta,
+                            this->pp_hc_maxiter);
+                    }
                 }
 
-                M_cell.writeObjFile( (this->network_name + "_post_processed").c_str() );
+                Profiler::Scope prof_write("write");
+                if (M_cell_store) {
+                    M_cell_store->writeObjFile( (this->network_name + "_post_processed").c_str() );
+                }
+                else if (this->pp_output_binary) {
+                    M_cell.writeBinaryFile( (this->network_name + "_post_processed").c_str() );
+                }
+                else {
+                    M_cell.writeObjFile( (this->network_name + "_post_processed").c_str() );
+                }
             }
             catch (MeshEx& e) {
                 if (e.error_type == MESH_IO_ERROR) {
-                    printf("\t ERROR: could not open mesh obj file for post-processing. skipping..\n");
+                    printf("\t ERROR: %s. skipping..\n", this->pp_in_memory ? "no union mesh to post-process" : "could not read mesh file for post-processing");
                 }
                 else throw;
             }
@@ -1240,3 +1595,191 @@ AnaMorph_cellgen::run()
         return EXIT_FAILURE;
     }
 }
+
+int
+AnaMorph_cellgen::runBatch()
+{
+    using Aux::Timing::doubletime;
+
+    /* collect input files: all swc files of a directory or the lines of a list file */
+    std::vector<std::string>    inputs;
+    std::vector<std::string>    dir_entries;
+    std::string                 list = this->batch_list;
+    std::string                 summary_filename;
+
+    while (list.size() > 1 && list.back() == '/') {
+        list.pop_back();
+    }
+
+    if (Aux::File::listDirectory(list, ".swc", dir_entries)) {
+        /* files of the working directory are named as with -i, the summary is written into the directory */
+        std::string dir = (list == ".") ? "" : ( (list.back() == '/') ? list : list + "/" );
+
+        for (auto &name : dir_entries) {
+            inputs.push_back(dir + name);
+        }
+        summary_filename = dir + "batch.summary";
+    }
+    else {
+        std::ifstream list_file(list);
+        if (!list_file) {
+            printf("ERROR: can't open batch list \"%s\".\n", list.c_str());
+            return EXIT_FAILURE;
+        }
+
+        std::string line;
+        while (std::getline(list_file, line)) {
+            size_t begin    = line.find_first_not_of(" \t\r");
+            size_t end      = line.find_last_not_of(" \t\r");
+            if (begin != std::string::npos && line[begin] != '#') {
+                inputs.push_back(line.substr(begin, end - begin + 1));
+            }
+        }
+        summary_filename = list + ".summary";
+    }
+
+    if (inputs.empty()) {
+        printf("ERROR: batch list \"%s\" contains no input files.\n", list.c_str());
+        return EXIT_FAILURE;
+    }
+
+    const size_t    n           = inputs.size();
+    const uint32_t  nworkers    = std::min<size_t>(this->batch_nworkers, n);
+
+    printf("AnaMorph cell generator (non-linear geometric modelling). batch mode: %zu networks from \"%s\", %u workers.\n",
+        n, list.c_str(), nworkers);
+
+    /* solver tables shared by all networks are computed once and inherited by the workers. parallel mesh
+     * processing and the analysis threads within the networks share the hardware threads left over by the
+     * workers. */
+    NLM_CellNetwork<double>::initAnalysisData();
+    Aux::Alg::setMaxThreads(std::max<uint32_t>(Aux::Alg::maxThreads() / nworkers, 1));
+    if (this->ana_nthreads > Aux::Alg::maxThreads()) {
+        printf("batch mode: analysis threads per network limited to %u.\n", Aux::Alg::maxThreads());
+        this->ana_nthreads = Aux::Alg::maxThreads();
+    }
+
+    std::vector<std::string>    status(n, "not started");
+    std::vector<double>         times(n, 0.0);
+    size_t                      nok         = 0;
+    double                      t_start     = doubletime();
+
+#ifndef __WIN32__
+    /* every network is processed in a forked worker process, which isolates failures and crashes. output goes to
+     * "<CELLNETWORK>.log". */
+    std::map<pid_t, size_t>     running;
+    std::vector<double>         t_started(n);
+    size_t                      next        = 0;
+    size_t                      ndone       = 0;
+
+    fflush(stdout);
+    while (next < n || !running.empty()) {
+        while (next < n && running.size() < nworkers) {
+            t_started[next] = doubletime();
+
+            pid_t pid = fork();
+            if (pid == 0) {
+                int rc = EXIT_FAILURE;
+                try {
+                    if (    this->setNetworkName(inputs[next]) &&
+                            freopen((this->network_name + ".log").c_str(), "w", stdout))
+                    {
+                        dup2(fileno(stdout), fileno(stderr));
+
+                        /* same random sequence as a single run of am_cellgen */
+                        std::srand(0);
+                        rc = this->runNetwork();
+                    }
+                }
+                catch (...) {
+                    rc = EXIT_FAILURE;
+                }
+                fflush(stdout);
+                _exit(rc);
+            }
+            else if (pid < 0) {
+                printf("ERROR: can't start worker process for \"%s\": %s.\n", inputs[next].c_str(), strerror(errno));
+                next++;
+                ndone++;
+            }
+            else {
+                running[pid] = next++;
+            }
+        }
+
+        if (running.empty()) {
+            continue;
+        }
+
+        int     wstatus;
+        pid_t   pid = waitpid(-1, &wstatus, 0);
+        if (pid < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            printf("ERROR: waitpid() failed: %s.\n", strerror(errno));
+            break;
+        }
+
+        auto it = running.find(pid);
+        if (it == running.end()) {
+            continue;
+        }
+        size_t i = it->second;
+        running.erase(it);
+
+        times[i] = doubletime() - t_started[i];
+        if (WIFEXITED(wstatus)) {
+            status[i] = (WEXITSTATUS(wstatus) == EXIT_SUCCESS) ? "ok" : "failed";
+        }
+        else if (WIFSIGNALED(wstatus)) {
+            status[i] = "crashed (signal " + std::to_string(WTERMSIG(wstatus)) + ")";
+        }
+        else {
+            status[i] = "failed";
+        }
+
+        printf("\t [%5zu / %5zu] %-20s %10.2f s  %s\n", ++ndone, n, status[i].c_str(), times[i], inputs[i].c_str());
+        fflush(stdout);
+    }
+#else
+    /* no fork() available: networks are processed one after another in this process, only exceptions are isolated */
+    for (size_t i = 0; i < n; i++) {
+        std::string pp_input_filename   = this->pp_input_filename;
+        double      t_started           = doubletime();
+        int         rc                  = EXIT_FAILURE;
+
+        if (this->setNetworkName(inputs[i])) {
+            std::srand(0);
+            rc = this->runNetwork();
+        }
+        this->pp_input_filename = pp_input_filename;
+
+        times[i]    = doubletime() - t_started;
+        status[i]   = (rc == EXIT_SUCCESS) ? "ok" : "failed";
+        printf("\t [%5zu / %5zu] %-20s %10.2f s  %s\n", i + 1, n, status[i].c_str(), times[i], inputs[i].c_str());
+    }
+#endif
+
+    for (auto &s : status) {
+        nok += (s == "ok");
+    }
+
+    /* write summary */
+    FILE *summary = fopen(summary_filename.c_str(), "w");
+    if (!summary) {
+        printf("ERROR: can't open summary file \"%s\" for writing.\n", summary_filename.c_str());
+        return EXIT_FAILURE;
+    }
+
+    fprintf(summary, "# am_cellgen batch summary for \"%s\": %zu networks, %zu ok, %zu failed, %u workers, %.2f s wall time.\n",
+        list.c_str(), n, nok, n - nok, nworkers, doubletime() - t_start);
+    fprintf(summary, "# %-18s %12s  %s\n", "status", "time [s]", "input");
+    for (size_t i = 0; i < n; i++) {
+        fprintf(summary, "%-20s %12.2f  %s\n", status[i].c_str(), times[i], inputs[i].c_str());
+    }
+    fclose(summary);
+
+    printf("batch done: %zu of %zu networks ok. summary written to \"%s\".\n", nok, n, summary_filename.c_str());
+    return (nok == n) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
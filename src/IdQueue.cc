@@ -113,6 +113,24 @@ IdQueue::getId()
     return id;
 }
 
+uint32_t
+IdQueue::getIdBlock(uint32_t n)
+{
+    if (!this->q.empty() || this->next_id != this->smallest_id || this->last_id != this->smallest_id) {
+        throw("IdQueue::getIdBlock(): ids have already been handed out.");
+    }
+    if (n >= UINT32_MAX - this->smallest_id) {
+        throw("IdQueue::getIdBlock(): block exceeds the id range => overflow.");
+    }
+
+    /* same state as after handing out the block id by id and before the next refill: next_id is
+     * the next free id and q holds no ids beyond last_id. */
+    this->next_id   = this->smallest_id + n;
+    this->last_id   = this->next_id;
+
+    return this->smallest_id;
+}
+
 void
 IdQueue::freeId(uint32_t id)
 {
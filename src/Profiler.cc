@@ -0,0 +1,372 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.hh"
+
+#include <atomic>
+#include <chrono>
+#include "Profiler.hh"
+
+namespace Profiler {
+
+    namespace {
+        bool                    prof_enabled    = false;
+        std::unique_ptr<Node>   prof_root;
+        double                  prof_start      = 0.0;
+        /* guards the stage tree. stages are coarse, so a single mutex is sufficient. */
+        std::mutex              prof_mutex;
+        thread_local Node      *prof_current    = NULL;
+
+        /* slots of the StageSet last recorded into by the calling thread. sets are identified by a serial number,
+         * since a new set may reuse the address of a destroyed one. */
+        std::atomic<uint64_t>   stage_set_serial(0);
+        thread_local uint64_t   stage_set_id    = 0;
+        thread_local void      *stage_set_slots = NULL;
+
+        double
+        wallTime()
+        {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        double
+        cpuTime()
+        {
+#ifndef __WIN32__
+            struct timespec ts;
+            clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+            return (ts.tv_sec + ts.tv_nsec / 1E9);
+#else
+            return ((double)std::clock() / CLOCKS_PER_SEC);
+#endif
+        }
+
+        /* names are program literals, only quotes, backslashes and control characters need escaping */
+        void
+        writeJSONString(FILE *f, std::string const &s)
+        {
+            fputc('"', f);
+            for (char c : s) {
+                if (c == '"' || c == '\\') {
+                    fputc('\\', f);
+                    fputc(c, f);
+                }
+                else if ((unsigned char)c < 0x20) {
+                    fprintf(f, "\\u%04x", (unsigned int)c);
+                }
+                else {
+                    fputc(c, f);
+                }
+            }
+            fputc('"', f);
+        }
+
+        void
+        writeJSONNode(FILE *f, Node const &n, uint32_t depth)
+        {
+            std::string ind(2 * depth, ' ');
+
+            fprintf(f, "%s{\n%s  \"name\": ", ind.c_str(), ind.c_str());
+            writeJSONString(f, n.name);
+            fprintf(f, ",\n%s  \"calls\": %lu,\n%s  \"wall_time\": %.6f,\n%s  \"cpu_time\": %.6f,\n%s  \"counters\": {",
+                ind.c_str(), (unsigned long)n.calls, ind.c_str(), n.wall_time, ind.c_str(), n.cpu_time, ind.c_str());
+
+            bool first = true;
+            for (auto &c : n.counters) {
+                fprintf(f, first ? " " : ", ");
+                writeJSONString(f, c.first);
+                fprintf(f, ": %lu", (unsigned long)c.second);
+                first = false;
+            }
+            fprintf(f, "%s},\n%s  \"children\": [", first ? "" : " ", ind.c_str());
+
+            first = true;
+            for (auto &c : n.children) {
+                fprintf(f, first ? "\n" : ",\n");
+                writeJSONNode(f, *c, depth + 2);
+                first = false;
+            }
+            fprintf(f, "%s]\n%s}", first ? "" : ("\n" + ind + "  ").c_str(), ind.c_str());
+        }
+    }
+
+    Node::Node(
+        std::string const  &name,
+        Node               *parent)
+            : name(name), parent(parent), calls(0), wall_time(0.0), cpu_time(0.0)
+    {
+    }
+
+    Node *
+    Node::getChild(std::string const &name)
+    {
+        for (auto &c : this->children) {
+            if (c->name == name) {
+                return c.get();
+            }
+        }
+        this->children.push_back(std::unique_ptr<Node>(new Node(name, this)));
+        return this->children.back().get();
+    }
+
+    void
+    enable()
+    {
+        std::lock_guard<std::mutex> lock(prof_mutex);
+
+        prof_root.reset(new Node("root", NULL));
+        prof_start      = wallTime();
+        prof_current    = NULL;
+        prof_enabled    = true;
+    }
+
+    void
+    disable()
+    {
+        prof_enabled = false;
+    }
+
+    bool
+    enabled()
+    {
+        return prof_enabled;
+    }
+
+    Node *
+    current()
+    {
+        if (!prof_enabled) {
+            return NULL;
+        }
+        return (prof_current ? prof_current : prof_root.get());
+    }
+
+    void
+    count(
+        char const *counter,
+        uint64_t    n)
+    {
+        if (prof_enabled) {
+            std::lock_guard<std::mutex> lock(prof_mutex);
+            Node *node = prof_current ? prof_current : prof_root.get();
+            node->counters[counter] += n;
+        }
+    }
+
+    bool
+    writeJSON(
+        std::string const                                      &filename,
+        std::list<std::pair<std::string, std::string>> const   &info)
+    {
+        std::lock_guard<std::mutex> lock(prof_mutex);
+
+        if (!prof_root) {
+            return false;
+        }
+
+        FILE *f = fopen(filename.c_str(), "w");
+        if (!f) {
+            return false;
+        }
+
+        fprintf(f, "{\n");
+        for (auto &p : info) {
+            fprintf(f, "  ");
+            writeJSONString(f, p.first);
+            fprintf(f, ": ");
+            writeJSONString(f, p.second);
+            fprintf(f, ",\n");
+        }
+        fprintf(f, "  \"wall_time\": %.6f,\n", wallTime() - prof_start);
+        if (!prof_root->counters.empty()) {
+            fprintf(f, "  \"counters\": {");
+            bool first = true;
+            for (auto &c : prof_root->counters) {
+                fprintf(f, first ? " " : ", ");
+                writeJSONString(f, c.first);
+                fprintf(f, ": %lu", (unsigned long)c.second);
+                first = false;
+            }
+            fprintf(f, " },\n");
+        }
+        fprintf(f, "  \"stages\": [");
+
+        bool first = true;
+        for (auto &c : prof_root->children) {
+            fprintf(f, first ? "\n" : ",\n");
+            writeJSONNode(f, *c, 2);
+            first = false;
+        }
+        fprintf(f, "%s]\n}\n", first ? "" : "\n  ");
+
+        bool ok = !ferror(f);
+        return (fclose(f) == 0 && ok);
+    }
+
+    void
+    Scope::open(
+        char const *name,
+        Node       *parent)
+    {
+        {
+            std::lock_guard<std::mutex> lock(prof_mutex);
+            this->node = parent->getChild(name);
+        }
+        this->prev          = prof_current;
+        prof_current        = this->node;
+        this->wall_start    = wallTime();
+        this->cpu_start     = cpuTime();
+    }
+
+    Scope::Scope(char const *name)
+        : node(NULL), prev(NULL), wall_start(0.0), cpu_start(0.0)
+    {
+        if (prof_enabled) {
+            this->open(name, prof_current ? prof_current : prof_root.get());
+        }
+    }
+
+    Scope::Scope(
+        char const *name,
+        Node       *parent)
+            : node(NULL), prev(NULL), wall_start(0.0), cpu_start(0.0)
+    {
+        if (prof_enabled && parent) {
+            this->open(name, parent);
+        }
+    }
+
+    Scope::~Scope()
+    {
+        if (this->node) {
+            double wall = wallTime() - this->wall_start;
+            double cpu  = cpuTime() - this->cpu_start;
+            {
+                std::lock_guard<std::mutex> lock(prof_mutex);
+                this->node->calls++;
+                this->node->wall_time  += wall;
+                this->node->cpu_time   += cpu;
+            }
+            prof_current = this->prev;
+        }
+    }
+
+    StageSet::StageSet(
+        Node                               *parent,
+        std::vector<char const *> const    &names)
+            : id(++stage_set_serial), parent(prof_enabled ? parent : NULL), names(names.begin(), names.end()),
+              nodes(names.size(), NULL)
+    {
+    }
+
+    StageSet::~StageSet()
+    {
+        this->merge();
+    }
+
+    std::vector<StageSet::Slot> &
+    StageSet::slots()
+    {
+        /* a thread takes the lock only on its first record into this set */
+        if (stage_set_id != this->id) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            this->thread_slots.push_back(std::unique_ptr<std::vector<Slot>>(
+                new std::vector<Slot>(this->names.size(), Slot{ 0, 0.0, 0.0 })));
+            stage_set_id    = this->id;
+            stage_set_slots = this->thread_slots.back().get();
+        }
+        return *static_cast<std::vector<Slot> *>(stage_set_slots);
+    }
+
+    void
+    StageSet::merge()
+    {
+        if (!this->parent) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock_set(this->mutex);
+        std::lock_guard<std::mutex> lock(prof_mutex);
+
+        for (auto &ts : this->thread_slots) {
+            for (size_t i = 0; i < ts->size(); i++) {
+                Slot &slot = (*ts)[i];
+                if (slot.calls > 0) {
+                    /* stages are created on first use as for Profiler::Scope */
+                    if (!this->nodes[i]) {
+                        this->nodes[i] = this->parent->getChild(this->names[i]);
+                    }
+                    this->nodes[i]->calls      += slot.calls;
+                    this->nodes[i]->wall_time  += slot.wall_time;
+                    this->nodes[i]->cpu_time   += slot.cpu_time;
+                    slot = Slot{ 0, 0.0, 0.0 };
+                }
+            }
+        }
+    }
+
+    StageSet::Scope::Scope(
+        StageSet   &set,
+        uint32_t    stage)
+            : set(set.parent ? &set : NULL), stage(stage), wall_start(0.0), cpu_start(0.0)
+    {
+        if (this->set) {
+            this->wall_start    = wallTime();
+            this->cpu_start     = cpuTime();
+        }
+    }
+
+    StageSet::Scope::~Scope()
+    {
+        if (this->set) {
+            Slot &slot = this->set->slots()[this->stage];
+            slot.calls++;
+            slot.wall_time += wallTime() - this->wall_start;
+            slot.cpu_time  += cpuTime() - this->cpu_start;
+        }
+    }
+}
@@ -0,0 +1,143 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.hh"
+#include "SlabPool.hh"
+
+SlabPool::SlabPool(
+    size_t node_size,
+    size_t node_align,
+    size_t slab_bytes)
+: free_head(NULL), bump_cur(NULL), bump_end(NULL), nallocated(0)
+{
+    /* nodes must be able to hold the free list pointer. round up node size to the required
+     * alignment, slabs themselves are suitably aligned for any type by operator new. */
+    node_align          = std::max(node_align, alignof(FreeNode));
+    this->node_size     = std::max(node_size, sizeof(FreeNode));
+    this->node_size     = ((this->node_size + node_align - 1) / node_align) * node_align;
+    this->slab_nodes    = std::max<size_t>(slab_bytes / this->node_size, 16);
+}
+
+SlabPool::~SlabPool()
+{
+    this->release();
+}
+
+void
+SlabPool::addSlab(size_t nnodes)
+{
+    /* the unused tail of the current slab, if any, goes to the free list */
+    while (this->bump_cur != this->bump_end) {
+        this->deallocate(this->bump_cur);
+        this->nallocated++;
+        this->bump_cur += this->node_size;
+    }
+
+    char *slab      = static_cast<char *>(::operator new(nnodes * this->node_size));
+    this->slabs.push_back(slab);
+    this->bump_cur  = slab;
+    this->bump_end  = slab + nnodes * this->node_size;
+}
+
+void
+SlabPool::reserve(size_t n)
+{
+    /* count available nodes. this walks the free list, which is fine for the intended use right
+     * after construction / release() or with few free nodes. */
+    size_t navailable = (this->bump_end - this->bump_cur) / this->node_size;
+    for (FreeNode *fn = this->free_head; fn && navailable < n; fn = fn->next) {
+        navailable++;
+    }
+
+    if (navailable < n) {
+        this->addSlab(std::max(n - navailable, this->slab_nodes));
+    }
+}
+
+void
+SlabPool::release()
+{
+    for (auto &slab : this->slabs) {
+        ::operator delete(slab);
+    }
+    this->slabs.clear();
+    this->free_head     = NULL;
+    this->bump_cur      = NULL;
+    this->bump_end      = NULL;
+    this->nallocated    = 0;
+}
+
+void
+SlabPool::adopt(SlabPool &x)
+{
+    if (x.node_size != this->node_size) {
+        throw std::logic_error("SlabPool::adopt(): node sizes don't match.");
+    }
+
+    /* hand x's unused slab tail to its free list, then splice x's free list in front of ours */
+    while (x.bump_cur != x.bump_end) {
+        x.deallocate(x.bump_cur);
+        x.nallocated++;
+        x.bump_cur += x.node_size;
+    }
+    if (x.free_head) {
+        FreeNode *tail = x.free_head;
+        while (tail->next) {
+            tail = tail->next;
+        }
+        tail->next      = this->free_head;
+        this->free_head = x.free_head;
+    }
+
+    this->slabs.insert(this->slabs.end(), x.slabs.begin(), x.slabs.end());
+    this->nallocated   += x.nallocated;
+
+    x.slabs.clear();
+    x.free_head         = NULL;
+    x.bump_cur          = NULL;
+    x.bump_end          = NULL;
+    x.nallocated        = 0;
+}
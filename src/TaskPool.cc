@@ -0,0 +1,269 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.hh"
+
+#include "TaskPool.hh"
+
+TaskPool::TaskPool(uint32_t nworkers)
+    : nworkers(std::max<uint32_t>(nworkers, 1)), threads(), ranges(std::max<uint32_t>(nworkers, 1)), mutex(),
+      cv_start(), cv_done(), batch(0), nbusy(0), shutdown(false), task(NULL), error()
+{
+    try {
+        for (uint32_t w = 1; w < this->nworkers; w++) {
+            this->threads.push_back(std::thread(&TaskPool::workerLoop, this, w));
+        }
+    }
+    catch (std::system_error &) {
+        this->stop();
+        throw("TaskPool::TaskPool(): caught std::system_error from thread() constructor => system could not spawn thread.");
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    this->stop();
+}
+
+void
+TaskPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->shutdown = true;
+    }
+    this->cv_start.notify_all();
+
+    for (auto &t : this->threads) {
+        t.join();
+    }
+    this->threads.clear();
+}
+
+uint32_t
+TaskPool::numWorkers() const
+{
+    return this->nworkers;
+}
+
+size_t
+TaskPool::rangeBegin(
+    size_t      n,
+    uint32_t    nworkers,
+    uint32_t    w)
+{
+    return (n * w) / nworkers;
+}
+
+void
+TaskPool::priorityLayout(
+    size_t                  n,
+    std::vector<size_t>    &layout) const
+{
+    size_t      k, round;
+    uint32_t    w;
+
+    layout.resize(n);
+    for (k = 0, round = 0; k < n; round++) {
+        for (w = 0; w < this->nworkers && k < n; w++) {
+            if (rangeBegin(n, this->nworkers, w) + round < rangeBegin(n, this->nworkers, w + 1)) {
+                layout[k++] = rangeBegin(n, this->nworkers, w) + round;
+            }
+        }
+    }
+}
+
+uint64_t
+TaskPool::packRange(
+    uint32_t    head,
+    uint32_t    tail)
+{
+    return ((uint64_t)tail << 32) | head;
+}
+
+bool
+TaskPool::popOwn(
+    uint32_t    w,
+    size_t     &i)
+{
+    std::atomic<uint64_t>  &range   = this->ranges[w].range;
+    uint64_t                r       = range.load();
+    uint32_t                head, tail;
+
+    while (true) {
+        head    = (uint32_t)r;
+        tail    = (uint32_t)(r >> 32);
+        if (head >= tail) {
+            return false;
+        }
+        /* on failure, r is updated to the current value */
+        if (range.compare_exchange_weak(r, packRange(head + 1, tail))) {
+            i = head;
+            return true;
+        }
+    }
+}
+
+bool
+TaskPool::steal(
+    uint32_t    w,
+    size_t     &i)
+{
+    uint32_t    head, tail, mid;
+    uint64_t    r;
+
+    /* victims are visited round-robin starting at the right neighbour, which spreads thieves over the workers */
+    for (uint32_t k = 1; k < this->nworkers; k++) {
+        std::atomic<uint64_t> &victim = this->ranges[(w + k) % this->nworkers].range;
+
+        r = victim.load();
+        while (true) {
+            head    = (uint32_t)r;
+            tail    = (uint32_t)(r >> 32);
+            if (head >= tail) {
+                break;
+            }
+            /* take [mid, tail): index mid is processed right away, the rest becomes the own range. */
+            mid = tail - std::max<uint32_t>((tail - head) / 2, 1);
+            if (victim.compare_exchange_weak(r, packRange(head, mid))) {
+                /* the own range is empty, and nobody else writes to an empty range */
+                this->ranges[w].range.store(packRange(mid + 1, tail));
+                i = mid;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void
+TaskPool::work(uint32_t w)
+{
+    size_t i;
+
+    while (this->popOwn(w, i) || this->steal(w, i)) {
+        try {
+            (*this->task)(i);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (!this->error) {
+                this->error = std::current_exception();
+            }
+        }
+    }
+}
+
+void
+TaskPool::workerLoop(uint32_t w)
+{
+    uint64_t seen = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->cv_start.wait(lock, [&] () -> bool { return this->shutdown || this->batch != seen; });
+            if (this->shutdown) {
+                return;
+            }
+            seen = this->batch;
+        }
+
+        this->work(w);
+
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (--this->nbusy == 0) {
+                this->cv_done.notify_one();
+            }
+        }
+    }
+}
+
+void
+TaskPool::run(
+    size_t                              n,
+    std::function<void(size_t)> const  &f)
+{
+    if (n == 0) {
+        return;
+    }
+    else if (n > 0xffffffffu) {
+        throw("TaskPool::run(): batch size exceeds 32-bit index range.");
+    }
+
+    /* distribute [0, n) evenly. the ranges are written before the batch is published under the mutex, which orders
+     * them before any read by a woken worker. */
+    for (uint32_t w = 0; w < this->nworkers; w++) {
+        this->ranges[w].range.store(packRange((uint32_t)rangeBegin(n, this->nworkers, w), (uint32_t)rangeBegin(n, this->nworkers, w + 1)));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->task  = &f;
+        this->error = std::exception_ptr();
+        this->nbusy = this->nworkers - 1;
+        this->batch++;
+    }
+    this->cv_start.notify_all();
+
+    /* take part as worker 0, then wait for the helpers. every helper only reports done after its own range and all
+     * ranges it could steal from were empty, so all tasks have returned once nbusy drops to zero. */
+    this->work(0);
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->cv_done.wait(lock, [&] () -> bool { return this->nbusy == 0; });
+        this->task  = NULL;
+        error       = this->error;
+        this->error = std::exception_ptr();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
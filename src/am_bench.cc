@@ -0,0 +1,1258 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common.hh"
+#include "aux.hh"
+
+#include <atomic>
+#include <new>
+
+#include "Mesh.hh"
+#include "CellNetwork.hh"
+#include "NLM_CellNetwork.hh"
+#include "CellNetworkAlg.hh"
+#include "MeshAlgorithms.hh"
+
+std::string const usage_text = 
+"--------------------------------------------------------------------------------\n"
+" AnaMorph: a framework for geometric modelling, consistency analysis and surface\n"
+" mesh generation of anatomically reconstructed neuron morphologies.\n"
+"\n"
+" Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph).\n"
+"--------------------------------------------------------------------------------\n"\
+"\n"\
+"am_bench: benchmarks for performance critical parts of AnaMorph.\n"\
+"\n"\
+"Usage: am_bench [-faces <N>] [-nodes <N>] [-reps <N>] [-somas <N>] [-depth <N>]\n"\
+"                [-segments <N>] [-radius <min> <max>] [-threads <N>] [BENCHMARK ..]\n"\
+"\n"\
+"   -faces <N>      approximate number of faces of synthetic meshes. default: 10000000\n"\
+"   -nodes <N>      number of compartments of synthetic SWC files. default: 1000000\n"\
+"   -reps <N>       number of timed repetitions per benchmark. default: 3\n"\
+"\n"\
+"   synthetic morphologies of the pipeline and reanalysis benchmarks:\n"\
+"   -somas <N>      number of cells, placed side by side. default: 1\n"\
+"   -depth <N>      branching depth of the four neurites of each cell, i.e. every\n"\
+"                   neurite is a binary tree of 2^<N> - 1 sections. default: 3\n"\
+"   -segments <N>   number of compartments per section. default: 6\n"\
+"   -radius <min> <max>\n"\
+"                   radius at the neurite roots (<max>) and tips (<min>), decreasing\n"\
+"                   geometrically with the branching depth and jittered by up to 10%\n"\
+"                   with a fixed seed. default: 0.4 1.2\n"\
+"   -threads <N>    number of analysis threads. default: 1\n"\
+"\n"\
+"   -ops <N>        number of operations per repetition of the cheap polynomial\n"\
+"                   kernels. the univariate / bivariate root finders run <N> / 100\n"\
+"                   and <N> / 1000 operations. default: 1000000\n"\
+"\n"\
+"Benchmarks (all of them are run if none is given):\n"\
+"\n"\
+"   mesh_copy       Mesh::operator=()\n"\
+"   mesh_copyappend Mesh::copyAppend() into a non-empty mesh\n"\
+"   obj_read        Mesh::readFromObjFile() against the former getline() / sscanf()\n"\
+"                   reader. writes a temporary file \"am_bench_obj_read.obj\"\n"\
+"   obj_write       Mesh::writeObjFile() against the former fprintf() writer.\n"\
+"                   writes temporary files \"am_bench_obj_write*.obj\"\n"\
+"   swc_read        CellNetwork::readSWCData() against the former getline() / sscanf()\n"\
+"                   parser, and CellNetwork::readFromNeuroMorphoSWCFile() including the\n"\
+"                   construction of the network.\n"\
+"                   writes a temporary file \"am_bench_swc_read.swc\"\n"\
+"   pipeline        all stages of am_cellgen with default settings, timed separately:\n"\
+"                   parse, preconditioning, partition, geometry, analysis, meshing,\n"\
+"                   gec, hc, obj_write and obj_read of the post-processed mesh.\n"\
+"                   console output of the stages is suppressed. writes temporary\n"\
+"                   files \"am_bench_pipeline*\"\n"\
+"   poly_arith      BernsteinPolynomial multiply(), elevateDegree(), split() and\n"\
+"                   clipToInterval(), BiBernsteinPolynomial elevateDegree(),\n"\
+"                   split_x() and split_y() for the degrees of the analysis\n"\
+"   poly_roots      PolyAlg::BezClip_roots() and PolyAlg::BiLinClip_roots() on the\n"\
+"                   REG, SONS, LSI, GSI and NSNS polynomials of synthetic canal\n"\
+"                   segments (\"real\") and on random polynomials (\"random\")\n"\
+"   reanalysis      NLM_CellNetwork::performFullAnalysis() with incremental analysis\n"\
+"                   on a synthetic morphology: initial analysis, re-analysis after\n"\
+"                   shrinking the radii of every 32nd neurite vertex, and the same\n"\
+"                   re-analysis without cached results. writes a temporary file\n"\
+"                   \"am_bench_reanalysis.swc\"\n"\
+"\n"\
+"Output: one line per timed repetition\n"\
+"   <benchmark> <parameters> rep <i> time <seconds>\n"\
+"   <benchmark> <parameters> rep <i> ns/op <ns> allocs/op <n>   (poly_*)\n"\
+"\n";
+
+typedef Mesh<bool, bool, bool, double> BenchMesh;
+
+/* network without payload: measures the reader and the graph, not the constructors of the NLM data */
+typedef CellNetwork<
+        Common::UnitType, Common::UnitType, Common::UnitType, Common::UnitType, Common::UnitType,
+        Common::UnitType, Common::UnitType, Common::UnitType, Common::UnitType, Common::UnitType,
+        Common::UnitType, Common::UnitType, Common::UnitType, double
+    > BenchCellNetwork;
+
+/* parameters of synthetic morphologies for the pipeline benchmark */
+struct MorphologyOptions {
+    uint32_t    nsomas;
+    uint32_t    depth;
+    uint32_t    nsegments;
+    double      radius_min;
+    double      radius_max;
+};
+
+struct BenchOptions {
+    uint32_t            nfaces;
+    uint32_t            nnodes;
+    uint32_t            nreps;
+    uint32_t            nthreads;
+    uint32_t            nops;
+    MorphologyOptions   morph;
+};
+
+/* number of allocations through the global operator new, for the allocs/op column */
+static std::atomic<uint64_t> bench_nallocs(0);
+
+void *
+operator new(size_t n)
+{
+    bench_nallocs.fetch_add(1, std::memory_order_relaxed);
+    void *p = malloc(n ? n : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+/* free() is called through a pointer, otherwise gcc matches the inlined call against operator new and warns */
+static void (* const volatile bench_free)(void *) = free;
+
+void
+operator delete(void *p) noexcept
+{
+    bench_free(p);
+}
+
+/* fixed sequence of pseudo random numbers, which is the same on all platforms */
+class BenchRandom {
+    private:
+        uint32_t    seed;
+
+    public:
+        BenchRandom(uint32_t seed = 1) : seed(seed) {}
+
+        /* uniform in [a, b] */
+        double
+        uniform(double a, double b)
+        {
+            this->seed = this->seed * 1664525u + 1013904223u;
+            return a + (b - a) * ((this->seed >> 8) / (double)(1u << 24));
+        }
+};
+
+/* closed triangulated torus with about nfaces faces. the grid of nu x nv quads is split into two
+ * triangles each. */
+static void
+generateTorus(
+    BenchMesh          &M,
+    uint32_t            nfaces,
+    Vec3<double> const &offset = Vec3<double>(0.0, 0.0, 0.0))
+{
+    using Common::twopi;
+
+    const uint32_t  nv  = std::max<uint32_t>(sqrt(nfaces / 8.0), 3);
+    const uint32_t  nu  = std::max<uint32_t>(nfaces / (2 * nv), 3);
+    const double    R   = 2.0, r = 0.5;
+    uint32_t        i, j;
+
+    std::vector<BenchMesh::vertex_iterator> grid;
+    grid.reserve(nu * nv);
+    for (i = 0; i < nu; i++) {
+        double phi = (twopi * i) / nu;
+        for (j = 0; j < nv; j++) {
+            double theta = (twopi * j) / nv;
+            grid.push_back(M.vertices.insert(offset + Vec3<double>(
+                    (R + r * cos(theta)) * cos(phi),
+                    (R + r * cos(theta)) * sin(phi),
+                    r * sin(theta))));
+        }
+    }
+
+    for (i = 0; i < nu; i++) {
+        for (j = 0; j < nv; j++) {
+            auto a = grid[i * nv + j];
+            auto b = grid[((i + 1) % nu) * nv + j];
+            auto c = grid[((i + 1) % nu) * nv + (j + 1) % nv];
+            auto d = grid[i * nv + (j + 1) % nv];
+            M.faces.insert(a, b, c);
+            M.faces.insert(a, c, d);
+        }
+    }
+}
+
+static void
+report(
+    const char         *name,
+    std::string const  &params,
+    uint32_t            rep,
+    double              time)
+{
+    printf("%-20s %-24s rep %2u time %12.6f\n", name, params.c_str(), rep, time);
+    fflush(stdout);
+}
+
+/* time nops calls of op(i), i = 0, .., nops - 1, and report time and allocations per call */
+template <typename Op>
+static void
+reportOps(
+    const char         *name,
+    std::string const  &params,
+    uint32_t            nreps,
+    uint32_t            nops,
+    Op                  op)
+{
+    using namespace Aux::Timing;
+
+    nops = std::max<uint32_t>(nops, 1);
+    for (uint32_t rep = 1; rep <= nreps; rep++) {
+        uint64_t nallocs = bench_nallocs.load();
+
+        tick(0);
+        for (uint32_t i = 0; i < nops; i++) {
+            op(i);
+        }
+        double time = tack(0);
+
+        nallocs = bench_nallocs.load() - nallocs;
+        printf("%-20s %-24s rep %2u ns/op %12.1f allocs/op %8.2f\n", name, params.c_str(), rep,
+            time * 1E9 / nops, (double)nallocs / nops);
+        fflush(stdout);
+    }
+}
+
+static void
+benchMeshCopy(BenchOptions const &opts)
+{
+    using namespace Aux::Timing;
+
+    BenchMesh   M;
+    generateTorus(M, opts.nfaces);
+
+    std::string params = "faces=" + std::to_string(M.numFaces());
+    for (uint32_t rep = 1; rep <= opts.nreps; rep++) {
+        BenchMesh N;
+        tick(0);
+        N = M;
+        report("mesh_copy", params, rep, tack(0));
+    }
+}
+
+static void
+benchMeshCopyAppend(BenchOptions const &opts)
+{
+    using namespace Aux::Timing;
+
+    BenchMesh   B;
+    generateTorus(B, opts.nfaces / 2);
+
+    std::string params = "faces=" + std::to_string(B.numFaces());
+    for (uint32_t rep = 1; rep <= opts.nreps; rep++) {
+        BenchMesh M;
+        generateTorus(M, opts.nfaces / 2, Vec3<double>(10.0, 0.0, 0.0));
+        tick(0);
+        M.copyAppend(B);
+        report("mesh_copyappend", params, rep, tack(0));
+    }
+}
+
+/* the obj reader as it was before the parallel one: one std::getline() and up to five sscanf()
+ * calls per line, one insertion per vertex / face. baseline for benchObjRead(). */
+static void
+readObjFileGetline(
+    BenchMesh  &M,
+    const char *filename)
+{
+    std::ifstream                           f(filename);
+    std::string                             line;
+    std::list<Vec3<double>>                 vertices;
+    std::list<std::array<uint32_t, 3>>      faces;
+    double                                  x, y, z;
+    uint32_t                                v0, v1, v2, v3, n0, n1, n2;
+
+    M.clear();
+    while (std::getline(f, line)) {
+        const char *l = line.c_str();
+        if (line.empty() || l[0] == '#' || l[0] == 'o' || (l[0] == 'v' && l[1] == 't')) {
+        }
+        else if (sscanf(l, "v %lf %lf %lf", &x, &y, &z) == 3) {
+            vertices.push_back(Vec3<double>(x, y, z));
+        }
+        else if (sscanf(l, "vn %lf %lf %lf", &x, &y, &z) == 3) {
+        }
+        else if (sscanf(l, "f %u %u %u", &v0, &v1, &v2) == 3 ||
+                 sscanf(l, "f %u %u %u %u", &v0, &v1, &v2, &v3) == 4 ||
+                 sscanf(l, "f %u//%u %u//%u %u//%u", &v0, &n0, &v1, &n1, &v2, &n2) == 6)
+        {
+            faces.push_back({ { v0 - 1, v1 - 1, v2 - 1 } });
+        }
+    }
+
+    for (auto &p : vertices) {
+        M.vertices.insert(p);
+    }
+    for (auto &t : faces) {
+        M.faces.insert(t[0], t[1], t[2]);
+    }
+}
+
+static void
+benchObjRead(BenchOptions const &opts)
+{
+    using namespace Aux::Timing;
+
+    const char *jobname     = "am_bench_obj_read";
+    std::string filename    = std::string(jobname) + ".obj";
+    uint32_t    nfaces;
+    {
+        BenchMesh   M;
+        generateTorus(M, opts.nfaces);
+        nfaces = M.numFaces();
+        M.writeObjFile(jobname);
+    }
+
+    std::string params = "faces=" + std::to_string(nfaces);
+    for (uint32_t rep = 1; rep <= opts.nreps; rep++) {
+        {
+            BenchMesh M;
+            tick(0);
+            readObjFileGetline(M, filename.c_str());
+            report("obj_read", params + " getline", rep, tack(0));
+        }
+        {
+            BenchMesh M;
+            tick(0);
+            M.readFromObjFile(filename.c_str());
+            report("obj_read", params + " parallel", rep, tack(0));
+        }
+    }
+    remove(filename.c_str());
+}
+
+/* the obj writer as it was before the parallel one: one fprintf() per line. baseline for
+ * benchObjWrite(). */
+static void
+writeObjFileFprintf(
+    BenchMesh  &M,
+    const char *jobname)
+{
+    std::string filename = std::string(jobname) + ".obj";
+    FILE       *outfile  = fopen(filename.c_str(), "w");
+    uint32_t    v0, v1, v2;
+
+    if (!outfile) {
+        throw("writeObjFileFprintf(): can't open output file for writing.");
+    }
+
+    M.renumberConsecutively();
+    fprintf(outfile, "# obj file automatically generated by AnaMorph for jobname: \"%s\".\n", jobname);
+    fprintf(outfile, "o %s\n", jobname);
+    fprintf(outfile, "\n# %15ld vertices.\n", (long)M.numVertices());
+    for (auto &v : M.vertices) {
+        Vec3<double> p = v.pos();
+        fprintf(outfile, "v %+.10e %+.10e %+.10e\n", p[0], p[1], p[2]);
+    }
+    fprintf(outfile, "\n# dummy texture coordinate to increase compatibility with several programs importing .obj files.\n");
+    fprintf(outfile, "vt 0.0 0.0\n");
+    for (auto &v : M.vertices) {
+        Vec3<double> n(0.0, 0.0, 0.0);
+        for (auto f : v.getFaceStar()) {
+            n += f->getNormal();
+        }
+        n.normalize();
+        fprintf(outfile, "vn %+.10e %+.10e %+.10e\n", n[0], n[1], n[2]);
+    }
+    fprintf(outfile, "\n# %15ld faces.\n", (long)M.numFaces());
+    for (auto &f : M.faces) {
+        f.getTriIndices(v0, v1, v2);
+        fprintf(outfile, "f %u//%u %u//%u %u//%u\n", v0 + 1, v0 + 1, v1 + 1, v1 + 1, v2 + 1, v2 + 1);
+    }
+    fclose(outfile);
+}
+
+static void
+benchObjWrite(BenchOptions const &opts)
+{
+    using namespace Aux::Timing;
+
+    const char *jobname_fprintf     = "am_bench_obj_write_fprintf";
+    const char *jobname_parallel    = "am_bench_obj_write";
+    BenchMesh   M;
+
+    generateTorus(M, opts.nfaces);
+
+    std::string params = "faces=" + std::to_string(M.numFaces());
+    for (uint32_t rep = 1; rep <= opts.nreps; rep++) {
+        tick(0);
+        writeObjFileFprintf(M, jobname_fprintf);
+        report("obj_write", params + " fprintf", rep, tack(0));
+
+        tick(0);
+        M.writeObjFile(jobname_parallel);
+        report("obj_write", params + " parallel", rep, tack(0));
+    }
+    remove((std::string(jobname_fprintf) + ".obj").c_str());
+    remove((std::string(jobname_parallel) + ".obj").c_str());
+}
+
+/* synthetic neuron with nnodes compartments: a soma and eight neurites (one axon, five basal and two
+ * apical dendrites), each of which is a binary tree of unbranched sections of 64 compartments. */
+static void
+writeSyntheticSWC(
+    const char *filename,
+    uint32_t    nnodes)
+{
+    using Common::twopi;
+
+    struct Section {
+        uint32_t        parent;
+        uint32_t        type;
+        Vec3<double>    pos;
+        Vec3<double>    dir;
+        double          radius;
+    };
+
+    const uint32_t          section_length  = 64;
+    const double            step            = 0.5;
+    FILE                   *outfile         = fopen(filename, "w");
+    std::list<Section>      Q;
+    uint32_t                id              = 1, i;
+
+    if (!outfile) {
+        throw("writeSyntheticSWC(): can't open output file for writing.");
+    }
+
+    fprintf(outfile, "# synthetic morphology with %u compartments generated by am_bench.\n", nnodes);
+    fprintf(outfile, "%u %u %+.6e %+.6e %+.6e %+.6e %d\n", id++, 1u, 0.0, 0.0, 0.0, 8.0, -1);
+    for (i = 0; i < 8; i++) {
+        double          phi = (twopi * i) / 8;
+        Vec3<double>    dir(cos(phi), sin(phi), (i % 2) ? 0.25 : -0.25);
+        dir.normalize();
+        Q.push_back({ 1, (i == 0) ? 2u : (i < 6 ? 3u : 4u), dir * 8.0, dir, 2.0 });
+    }
+
+    while (id <= nnodes && !Q.empty()) {
+        Section s = Q.front();
+        Q.pop_front();
+
+        uint32_t parent = s.parent;
+        for (i = 0; i < section_length && id <= nnodes; i++) {
+            s.pos += s.dir * step;
+            fprintf(outfile, "%u %u %+.6e %+.6e %+.6e %+.6e %u\n", id, s.type, s.pos[0], s.pos[1], s.pos[2], s.radius, parent);
+            parent = id++;
+        }
+
+        /* branch: rotate the direction by +- 30 degrees about an axis orthogonal to it */
+        Vec3<double> ortho = s.dir.cross(Vec3<double>(0.0, 0.0, 1.0));
+        if (ortho.len2() < 1E-8) {
+            ortho = Vec3<double>(1.0, 0.0, 0.0);
+        }
+        ortho.normalize();
+        for (double sgn : { -1.0, 1.0 }) {
+            Vec3<double> dir = s.dir * cos(twopi / 12) + ortho * (sgn * sin(twopi / 12));
+            Q.push_back({ parent, s.type, s.pos, dir, std::max(s.radius * 0.9, 0.1) });
+        }
+    }
+    fclose(outfile);
+}
+
+/* the swc parser as it was before the flat one: one std::getline() and sscanf() per line into a vector
+ * of nodes with std::list members, sorting by id and one std::list of children per node. baseline for
+ * benchSWCRead(). */
+struct SWCNodeGetline {
+    uint32_t                    compartment_id;
+    uint32_t                    compartment_type;
+    int32_t                     parent_id;
+    std::list<Vec3<double>>     sections;
+    std::list<uint32_t>         child_ids;
+};
+
+static void
+readSWCFileGetline(
+    std::vector<SWCNodeGetline>    &swc_nodes,
+    const char                     *filename)
+{
+    std::ifstream   f(filename);
+    std::string     line;
+    Vec3<double>    p;
+    double          r;
+    uint32_t        compartment_id, compartment_type;
+    int32_t         parent_id;
+
+    swc_nodes.clear();
+    while (std::getline(f, line)) {
+        const char *l = line.c_str();
+        while (isspace(*l)) {
+            ++l;
+        }
+        if (*l == '\0' || *l == '#') {
+            continue;
+        }
+        if (sscanf(l, "%u %u %lf %lf %lf %lf %d\n", &compartment_id, &compartment_type, &p[0], &p[1], &p[2], &r, &parent_id) != 7) {
+            throw("readSWCFileGetline(): syntax error.");
+        }
+        swc_nodes.push_back({ compartment_id - 1, compartment_type, (parent_id != -1) ? parent_id - 1 : -1, { p }, { } });
+    }
+
+    std::sort(swc_nodes.begin(), swc_nodes.end(),
+        [] (SWCNodeGetline const &a, SWCNodeGetline const &b) -> bool
+        {
+            return (a.compartment_id < b.compartment_id);
+        });
+
+    for (auto &node : swc_nodes) {
+        if (node.parent_id != -1) {
+            swc_nodes[node.parent_id].child_ids.push_back(node.compartment_id);
+        }
+    }
+    for (auto &node : swc_nodes) {
+        node.child_ids.sort();
+    }
+}
+
+static void
+benchSWCRead(BenchOptions const &opts)
+{
+    using namespace Aux::Timing;
+
+    const char *filename = "am_bench_swc_read.swc";
+    writeSyntheticSWC(filename, opts.nnodes);
+
+    std::string params = "nodes=" + std::to_string(opts.nnodes);
+    for (uint32_t rep = 1; rep <= opts.nreps; rep++) {
+        {
+            std::vector<SWCNodeGetline> swc_nodes;
+            tick(0);
+            readSWCFileGetline(swc_nodes, filename);
+            report("swc_read", params + " getline", rep, tack(0));
+        }
+        {
+            BenchCellNetwork::SWCData swc;
+            tick(0);
+            BenchCellNetwork::readSWCData(filename, swc);
+            report("swc_read", params + " flat", rep, tack(0));
+        }
+        {
+            BenchCellNetwork C("am_bench_swc_read");
+            tick(0);
+            C.readFromNeuroMorphoSWCFile(filename);
+            report("swc_read", params + " network", rep, tack(0));
+        }
+    }
+    remove(filename);
+}
+
+/* synthetic cells for the pipeline benchmark, placed side by side along the x axis. every cell consists of a
+ * soma and four neurites (one axon, three dendrites) leaving it in the xy-plane and slightly off it. each
+ * neurite is a binary tree of the given depth with nsegments compartments per unbranched section. branches
+ * diverge by +- 30 degrees, the branching plane is turned by 90 degrees at every level, so that the
+ * subtrees spread in space and the network is clean for moderate depths. the radius decreases
+ * geometrically from radius_max at the roots to radius_min at the tips and is jittered by a fixed
+ * sequence of pseudo random numbers, which is the same on all platforms. */
+static void
+writeSyntheticMorphology(
+    const char                 *filename,
+    MorphologyOptions const    &morph)
+{
+    using Common::twopi;
+
+    struct Section {
+        uint32_t        parent;
+        uint32_t        type;
+        uint32_t        level;
+        Vec3<double>    pos;
+        Vec3<double>    dir;
+        Vec3<double>    normal;
+    };
+
+    const double            soma_radius = 8.0;
+    const double            step        = 2.5 * morph.radius_max;
+    const double            extent      = soma_radius + step * morph.nsegments * (morph.depth + 1);
+    const double            taper       = (morph.depth > 1) ? pow(morph.radius_min / morph.radius_max, 1.0 / (morph.depth - 1)) : 1.0;
+    FILE                   *outfile     = fopen(filename, "w");
+    uint32_t                id          = 1, i, j, k;
+    BenchRandom             rnd;
+
+    if (!outfile) {
+        throw("writeSyntheticMorphology(): can't open output file for writing.");
+    }
+
+    fprintf(outfile, "# synthetic morphology generated by am_bench: %u somas, depth %u, %u segments, radius [%.3f, %.3f].\n",
+        morph.nsomas, morph.depth, morph.nsegments, morph.radius_min, morph.radius_max);
+
+    for (k = 0; k < morph.nsomas; k++) {
+        Vec3<double>        center(k * 2.5 * extent, 0.0, 0.0);
+        uint32_t            soma_id = id++;
+        std::list<Section>  Q;
+
+        fprintf(outfile, "%u %u %+.6e %+.6e %+.6e %+.6e %d\n", soma_id, 1u, center[0], center[1], center[2], soma_radius, -1);
+        for (i = 0; i < 4; i++) {
+            double          phi = (twopi * i) / 4 + twopi / 16;
+            Vec3<double>    dir(cos(phi), sin(phi), (i % 2) ? 0.2 : -0.2);
+            dir.normalize();
+            Q.push_back({ soma_id, (i == 0) ? 2u : 3u, 0, center + dir * soma_radius, dir, Vec3<double>(0.0, 0.0, 1.0) });
+        }
+
+        while (!Q.empty()) {
+            Section s = Q.front();
+            Q.pop_front();
+
+            double      radius  = morph.radius_max * pow(taper, std::min(s.level, morph.depth - 1));
+            uint32_t    parent  = s.parent;
+            for (j = 0; j < morph.nsegments; j++) {
+                s.pos += s.dir * step;
+                fprintf(outfile, "%u %u %+.6e %+.6e %+.6e %+.6e %u\n", id, s.type, s.pos[0], s.pos[1], s.pos[2],
+                    radius * (1.0 + 0.1 * rnd.uniform(-1.0, 1.0)), parent);
+                parent = id++;
+            }
+
+            if (s.level + 1 < morph.depth) {
+                Vec3<double> ortho = s.dir.cross(s.normal);
+                ortho.normalize();
+                for (double sgn : { -1.0, 1.0 }) {
+                    Vec3<double> dir = s.dir * cos(twopi / 12) + ortho * (sgn * sin(twopi / 12));
+                    dir.normalize();
+                    Q.push_back({ parent, s.type, s.level + 1, s.pos, dir, ortho });
+                }
+            }
+        }
+    }
+    fclose(outfile);
+}
+
+/* redirects stdout to /dev/null for the lifetime of the object to keep the output of the benchmarks stable */
+class QuietStdout {
+    private:
+        int     saved_fd;
+
+    public:
+        QuietStdout() : saved_fd(-1)
+        {
+#ifndef __WIN32__
+            fflush(stdout);
+            int null_fd = open("/dev/null", O_WRONLY);
+            if (null_fd >= 0) {
+                this->saved_fd = dup(fileno(stdout));
+                dup2(null_fd, fileno(stdout));
+                close(null_fd);
+            }
+#endif
+        }
+
+       ~QuietStdout()
+        {
+#ifndef __WIN32__
+            if (this->saved_fd >= 0) {
+                fflush(stdout);
+                dup2(this->saved_fd, fileno(stdout));
+                close(this->saved_fd);
+            }
+#endif
+        }
+};
+
+static void
+benchPipeline(BenchOptions const &opts)
+{
+    using namespace Aux::Timing;
+
+    MorphologyOptions const    &morph       = opts.morph;
+    std::string const           name        = "am_bench_pipeline";
+    std::string const           out_name    = name + "_post_processed";
+
+    if (morph.nsomas == 0 || morph.depth == 0 || morph.nsegments == 0 || morph.radius_min <= 0.0 || morph.radius_min > morph.radius_max) {
+        throw("benchPipeline(): invalid morphology parameters.");
+    }
+    writeSyntheticMorphology((name + ".swc").c_str(), morph);
+
+    char params[64];
+    snprintf(params, sizeof(params), "s%u d%u g%u r%.2f-%.2f t%u",
+        morph.nsomas, morph.depth, morph.nsegments, morph.radius_min, morph.radius_max, opts.nthreads);
+
+    for (uint32_t rep = 1; rep <= opts.nreps; rep++) {
+        NLM_CellNetwork<double>         C(name);
+        Mesh<bool, bool, bool, double>  M, M_in;
+        bool                            clean;
+        std::vector<std::pair<const char *, double>> times;
+
+        /* same random sequence as a single run of am_cellgen */
+        std::srand(0);
+        {
+            QuietStdout quiet;
+
+            tick(0);
+            C.readFromNeuroMorphoSWCFile(name + ".swc", false);
+            times.push_back({ "parse", tack(0) });
+
+            /* settings of am_cellgen */
+            NLM_CellNetwork<double>::Settings C_settings = C.getSettings();
+            C_settings.analysis_nthreads                        = opts.nthreads;
+            C_settings.partition_algo                           = NLM_CellNetwork<double>::partition_select_max_chordal_depth(M_PI / 2.0, 10.0);
+            C_settings.meshing_canal_segment_n_phi_segments     = 6;
+            C_settings.meshing_cansurf_triangle_height_factor   = 1.0;
+            C.updateSettings(C_settings);
+
+            tick(0);
+            CellNetworkAlg::preliminaryPreconditioning(C, 3.0, 1.5, 10.0);
+            times.push_back({ "preconditioning", tack(0) });
+
+            tick(0);
+            C.partitionNetwork();
+            times.push_back({ "partition", tack(0) });
+
+            tick(0);
+            C.updateNetworkGeometry();
+            times.push_back({ "geometry", tack(0) });
+
+            tick(0);
+            clean = C.performFullAnalysis();
+            times.push_back({ "analysis", tack(0) });
+
+            if (clean) {
+                tick(0);
+                C.renderCellNetwork<bool, bool, bool>(name, &M, false, NULL);
+                times.push_back({ "meshing", tack(0) });
+
+                tick(0);
+                MeshAlg::greedyEdgeCollapsePostProcessing(M, 1.5, 0.125, 0.5, 5);
+                times.push_back({ "gec", tack(0) });
+
+                tick(0);
+                MeshAlg::HCLaplacianSmoothing(M, 0.4, 0.7, 10);
+                times.push_back({ "hc", tack(0) });
+
+                tick(0);
+                M.writeObjFile(out_name.c_str());
+                times.push_back({ "obj_write", tack(0) });
+
+                tick(0);
+                M_in.readFromFile((out_name + ".obj").c_str());
+                times.push_back({ "obj_read", tack(0) });
+            }
+        }
+
+        if (!clean) {
+            remove((name + ".swc").c_str());
+            throw("benchPipeline(): synthetic network is not clean, reduce depth or radii.");
+        }
+
+        for (auto &t : times) {
+            report("pipeline", std::string(params) + " " + t.first, rep, t.second);
+        }
+    }
+    remove((name + ".swc").c_str());
+    remove((out_name + ".obj").c_str());
+}
+
+/* re-analysis after a local edit: every 32nd neurite vertex gets its radius reduced by 10%, which is the typical
+ * situation of an interactive fix-up loop. "initial" is the first analysis with incremental analysis enabled,
+ * "incremental" the re-analysis after the edit and "full" the same re-analysis without cached results. */
+static void
+benchReanalysis(BenchOptions const &opts)
+{
+    using namespace Aux::Timing;
+
+    MorphologyOptions const    &morph       = opts.morph;
+    std::string const           name        = "am_bench_reanalysis";
+
+    if (morph.nsomas == 0 || morph.depth == 0 || morph.nsegments == 0 || morph.radius_min <= 0.0 || morph.radius_min > morph.radius_max) {
+        throw("benchReanalysis(): invalid morphology parameters.");
+    }
+    writeSyntheticMorphology((name + ".swc").c_str(), morph);
+
+    char params[64];
+    snprintf(params, sizeof(params), "s%u d%u g%u r%.2f-%.2f t%u",
+        morph.nsomas, morph.depth, morph.nsegments, morph.radius_min, morph.radius_max, opts.nthreads);
+
+    for (uint32_t rep = 1; rep <= opts.nreps; rep++) {
+        NLM_CellNetwork<double>         C(name);
+        bool                            clean_incremental, clean_full;
+        std::vector<std::pair<const char *, double>> times;
+
+        std::srand(0);
+        {
+            QuietStdout quiet;
+
+            C.readFromNeuroMorphoSWCFile(name + ".swc", false);
+
+            NLM_CellNetwork<double>::Settings C_settings = C.getSettings();
+            C_settings.analysis_nthreads                        = opts.nthreads;
+            C_settings.analysis_incremental                     = true;
+            C_settings.partition_algo                           = NLM_CellNetwork<double>::partition_select_max_chordal_depth(M_PI / 2.0, 10.0);
+            C.updateSettings(C_settings);
+
+            CellNetworkAlg::preliminaryPreconditioning(C, 3.0, 1.5, 10.0);
+            C.partitionNetwork();
+            C.updateNetworkGeometry();
+
+            tick(0);
+            C.performFullAnalysis();
+            times.push_back({ "initial", tack(0) });
+
+            uint32_t i = 0;
+            for (auto &v : C.neurite_vertices) {
+                if (i++ % 32 == 0) {
+                    v.scaleSinglePointRadius(0.9);
+                }
+            }
+            C.updateNetworkGeometry();
+
+            tick(0);
+            clean_incremental = C.performFullAnalysis();
+            times.push_back({ "incremental", tack(0) });
+
+            C.clearAnalysisCache();
+            tick(0);
+            clean_full = C.performFullAnalysis();
+            times.push_back({ "full", tack(0) });
+        }
+
+        if (clean_incremental != clean_full) {
+            remove((name + ".swc").c_str());
+            throw("benchReanalysis(): incremental and full re-analysis disagree. internal logic error.");
+        }
+
+        for (auto &t : times) {
+            report("reanalysis", std::string(params) + " " + t.first, rep, t.second);
+        }
+    }
+    remove((name + ".swc").c_str());
+}
+
+/* inputs of the polynomial kernels. "real" polynomials are computed from cubic canal segments shaped like the
+ * ones of partitioned neurites: spine curves of length about 10 with perturbed control points, radii in [0.3, 2.0].
+ * NSNS pairs cross each other close enough for the intersection system to have roots. "random" polynomials have
+ * uniformly distributed coefficients in [-1, 1]. */
+static const uint32_t npoly_inputs = 64;
+
+struct PolyInputs {
+    std::vector<BernsteinPolynomial<2u, double, double>>        r2;
+    std::vector<BernsteinPolynomial<3u, double, double>>        r3;
+    std::vector<BernsteinPolynomial<6u, double, double>>        r6;
+    std::vector<BernsteinPolynomial<4u, double, double>>        reg, r4;
+    std::vector<BernsteinPolynomial<5u, double, double>>        sons, r5;
+    std::vector<BernsteinPolynomial<12u, double, double>>       lsi, r12;
+    std::vector<BiBernsteinPolynomial<7u, 5u, double, double>>  gsi_p;
+    std::vector<BiBernsteinPolynomial<7u, 7u, double, double>>  gsi_p_elev, gsi_q_elev, r77p, r77q;
+    std::vector<BiBernsteinPolynomial<5u, 3u, double, double>>  nsns_p;
+    std::vector<BiBernsteinPolynomial<5u, 5u, double, double>>  nsns_p_elev, nsns_q_elev, r55p, r55q;
+};
+
+template <uint32_t deg>
+static void
+randomPolynomials(
+    std::vector<BernsteinPolynomial<deg, double, double>>  &v,
+    BenchRandom                                            &rnd)
+{
+    v.resize(npoly_inputs);
+    for (auto &p : v) {
+        for (uint32_t i = 0; i <= deg; i++) {
+            p[i] = rnd.uniform(-1.0, 1.0);
+        }
+    }
+}
+
+template <uint32_t deg1, uint32_t deg2>
+static void
+randomBiPolynomials(
+    std::vector<BiBernsteinPolynomial<deg1, deg2, double, double>> &v,
+    BenchRandom                                                    &rnd)
+{
+    v.resize(npoly_inputs);
+    for (auto &p : v) {
+        for (uint32_t i = 0; i <= deg1; i++) {
+            for (uint32_t j = 0; j <= deg2; j++) {
+                p(i, j) = rnd.uniform(-1.0, 1.0);
+            }
+        }
+    }
+}
+
+static BLRCanalSurface<3u, double>
+randomCanalSegment(
+    BenchRandom        &rnd,
+    Vec3<double> const &start,
+    Vec3<double> const &dir)
+{
+    std::vector<Vec3<double>> cp(4);
+    for (uint32_t i = 0; i < 4; i++) {
+        cp[i] = start + dir * (10.0 * i / 3.0) + Vec3<double>(rnd.uniform(-1.5, 1.5), rnd.uniform(-1.5, 1.5), rnd.uniform(-1.5, 1.5));
+    }
+    return BLRCanalSurface<3u, double>(cp, rnd.uniform(0.3, 2.0), rnd.uniform(0.3, 2.0));
+}
+
+static void
+generatePolyInputs(PolyInputs &in)
+{
+    BenchRandom rnd;
+
+    randomPolynomials(in.r2, rnd);
+    randomPolynomials(in.r3, rnd);
+    randomPolynomials(in.r4, rnd);
+    randomPolynomials(in.r5, rnd);
+    randomPolynomials(in.r6, rnd);
+    randomPolynomials(in.r12, rnd);
+    randomBiPolynomials(in.r77p, rnd);
+    randomBiPolynomials(in.r77q, rnd);
+    randomBiPolynomials(in.r55p, rnd);
+    randomBiPolynomials(in.r55q, rnd);
+
+    for (uint32_t i = 0; i < npoly_inputs; i++) {
+        Vec3<double> dir(rnd.uniform(-1.0, 1.0), rnd.uniform(-1.0, 1.0), rnd.uniform(-1.0, 1.0));
+        if (dir.len2() < 1E-4) {
+            dir = Vec3<double>(1.0, 0.0, 0.0);
+        }
+        dir.normalize();
+
+        BLRCanalSurface<3u, double> Gamma = randomCanalSegment(rnd, Vec3<double>(0.0, 0.0, 0.0), dir);
+
+        /* Delta starts beside the midpoint of Gamma and crosses it */
+        Vec3<double> ortho = dir.cross(Vec3<double>(0.0, 0.0, 1.0));
+        if (ortho.len2() < 1E-4) {
+            ortho = Vec3<double>(0.0, 1.0, 0.0);
+        }
+        ortho.normalize();
+        BLRCanalSurface<3u, double> Delta = randomCanalSegment(rnd, dir * 5.0 - ortho * 5.0, ortho);
+
+        BernsteinPolynomial<4u, double, double>         reg;
+        BernsteinPolynomial<5u, double, double>         sons, e0, e1, e2, e3;
+        BernsteinPolynomial<12u, double, double>        lsi;
+        BiBernsteinPolynomial<7u, 5u, double, double>   gsi_p;
+        BiBernsteinPolynomial<5u, 7u, double, double>   gsi_q;
+        BiBernsteinPolynomial<5u, 3u, double, double>   nsns_p;
+        BiBernsteinPolynomial<3u, 5u, double, double>   nsns_q;
+
+        Gamma.spineCurveComputeRegularityPolynomial(reg);
+        Gamma.spineCurveComputeStationaryPointDistPoly(dir * 5.0 + ortho * 6.0, sons);
+        Gamma.computeLocalSelfIntersectionPolynomial(lsi);
+        Gamma.computeGlobalSelfIntersectionSystem(gsi_p, gsi_q, e0, e1);
+        Gamma.computeIntersectionSystem(Delta, nsns_p, nsns_q, e0, e1, e2, e3);
+
+        in.reg.push_back(reg);
+        in.sons.push_back(sons);
+        in.lsi.push_back(lsi);
+        in.gsi_p.push_back(gsi_p);
+        in.gsi_p_elev.push_back(gsi_p.template elevateDegree<0, 2u>());
+        in.gsi_q_elev.push_back(gsi_q.template elevateDegree<2u, 0>());
+        in.nsns_p.push_back(nsns_p);
+        in.nsns_p_elev.push_back(nsns_p.template elevateDegree<0, 2u>());
+        in.nsns_q_elev.push_back(nsns_q.template elevateDegree<2u, 0>());
+    }
+}
+
+/* keeps results of the timed kernels alive */
+static volatile double poly_sink;
+
+template <uint32_t deg>
+static void
+benchUnivariateSplitClip(
+    BenchOptions const                                          &opts,
+    std::string const                                           &params,
+    std::vector<BernsteinPolynomial<deg, double, double>> const &v)
+{
+    reportOps("poly_split", params, opts.nreps, opts.nops,
+        [&v] (uint32_t i)
+        {
+            BernsteinPolynomial<deg, double, double> l, r;
+            v[i % npoly_inputs].split(0.25 + 0.5 * (i % 7) / 6.0, &l, &r);
+            poly_sink = l[0] + r[deg];
+        });
+
+    reportOps("poly_clip", params, opts.nreps, opts.nops,
+        [&v] (uint32_t i)
+        {
+            BernsteinPolynomial<deg, double, double> c;
+            v[i % npoly_inputs].clipToInterval(0.1 + 0.05 * (i % 5), 0.6 + 0.05 * (i % 7), &c);
+            poly_sink = c[0];
+        });
+}
+
+template <uint32_t deg1, uint32_t deg2>
+static void
+benchBivariateSplit(
+    BenchOptions const                                                  &opts,
+    std::string const                                                   &params,
+    std::vector<BiBernsteinPolynomial<deg1, deg2, double, double>> const &v)
+{
+    reportOps("bipoly_split_x", params, opts.nreps, opts.nops,
+        [&v] (uint32_t i)
+        {
+            BiBernsteinPolynomial<deg1, deg2, double, double> l, r;
+            v[i % npoly_inputs].split_x(0.25 + 0.5 * (i % 7) / 6.0, &l, &r);
+            poly_sink = l(0, 0) + r(deg1, deg2);
+        });
+
+    reportOps("bipoly_split_y", params, opts.nreps, opts.nops,
+        [&v] (uint32_t i)
+        {
+            BiBernsteinPolynomial<deg1, deg2, double, double> d, u;
+            v[i % npoly_inputs].split_y(0.25 + 0.5 * (i % 7) / 6.0, &d, &u);
+            poly_sink = d(0, 0) + u(deg1, deg2);
+        });
+}
+
+static void
+benchPolyArith(BenchOptions const &opts)
+{
+    PolyInputs in;
+    generatePolyInputs(in);
+
+    /* products of the derivative / spine curve components as in BLRCanalSurface */
+    reportOps("poly_multiply", "deg=2x2", opts.nreps, opts.nops,
+        [&in] (uint32_t i)
+        {
+            poly_sink = in.r2[i % npoly_inputs].multiply(in.r2[(i + 1) % npoly_inputs])[2];
+        });
+    reportOps("poly_multiply", "deg=2x3", opts.nreps, opts.nops,
+        [&in] (uint32_t i)
+        {
+            poly_sink = in.r2[i % npoly_inputs].multiply(in.r3[(i + 1) % npoly_inputs])[2];
+        });
+    reportOps("poly_multiply", "deg=6x6", opts.nreps, opts.nops,
+        [&in] (uint32_t i)
+        {
+            poly_sink = in.r6[i % npoly_inputs].multiply(in.r6[(i + 1) % npoly_inputs])[6];
+        });
+
+    /* elevations of the LSI polynomial and the GSI / NSNS systems */
+    reportOps("poly_elevate", "deg=6->12", opts.nreps, opts.nops,
+        [&in] (uint32_t i)
+        {
+            poly_sink = in.r6[i % npoly_inputs].template elevateDegree<12u>()[6];
+        });
+    reportOps("bipoly_elevate", "deg=7x5->7x7 real", opts.nreps, opts.nops,
+        [&in] (uint32_t i)
+        {
+            poly_sink = in.gsi_p[i % npoly_inputs].template elevateDegree<0, 2u>()(3, 3);
+        });
+    reportOps("bipoly_elevate", "deg=5x3->5x5 real", opts.nreps, opts.nops,
+        [&in] (uint32_t i)
+        {
+            poly_sink = in.nsns_p[i % npoly_inputs].template elevateDegree<0, 2u>()(2, 2);
+        });
+
+    benchUnivariateSplitClip(opts, "deg=4 reg",     in.reg);
+    benchUnivariateSplitClip(opts, "deg=5 sons",    in.sons);
+    benchUnivariateSplitClip(opts, "deg=12 lsi",    in.lsi);
+
+    benchBivariateSplit(opts, "deg=7x7 gsi",        in.gsi_p_elev);
+    benchBivariateSplit(opts, "deg=5x5 nsns",       in.nsns_p_elev);
+}
+
+template <uint32_t deg>
+static void
+benchBezClip(
+    BenchOptions const                                          &opts,
+    std::string const                                           &params,
+    std::vector<BernsteinPolynomial<deg, double, double>> const &v)
+{
+    std::vector<PolyAlg::RealInterval<double>> roots;
+
+    reportOps("bezclip_roots", params, opts.nreps, opts.nops / 100,
+        [&v, &roots] (uint32_t i)
+        {
+            roots.clear();
+            PolyAlg::BezClip_roots<deg, double>(v[i % npoly_inputs], 0.0, 1.0, 1E-6, roots);
+            poly_sink = roots.size();
+        });
+}
+
+template <uint32_t deg>
+static void
+benchBiLinClip(
+    BenchOptions const                                                  &opts,
+    std::string const                                                   &params,
+    std::vector<BiBernsteinPolynomial<deg, deg, double, double>> const  &p,
+    std::vector<BiBernsteinPolynomial<deg, deg, double, double>> const  &q)
+{
+    std::vector<PolyAlg::RealRectangle<double>> roots;
+
+    reportOps("bilinclip_roots", params, opts.nreps, opts.nops / 1000,
+        [&p, &q, &roots] (uint32_t i)
+        {
+            roots.clear();
+            try {
+                PolyAlg::BiLinClip_roots<deg, deg, double>(p[i % npoly_inputs], q[i % npoly_inputs], 0.0, 1.0, 0.0, 1.0, 1E-4, roots);
+            }
+            /* the analysis treats solver failures as intersections and carries on, so does the benchmark */
+            catch (const char *) {
+            }
+            poly_sink = roots.size();
+        });
+}
+
+static void
+benchPolyRoots(BenchOptions const &opts)
+{
+    PolyInputs in;
+    generatePolyInputs(in);
+
+    /* approximation data is precomputed by the analysis as well */
+    PolyAlg::BiLinClip_getApproximationData<5u, 5u, double>();
+    PolyAlg::BiLinClip_getApproximationData<7u, 7u, double>();
+
+    benchBezClip(opts, "deg=4 reg real",        in.reg);
+    benchBezClip(opts, "deg=4 random",          in.r4);
+    benchBezClip(opts, "deg=5 sons real",       in.sons);
+    benchBezClip(opts, "deg=5 random",          in.r5);
+    benchBezClip(opts, "deg=12 lsi real",       in.lsi);
+    benchBezClip(opts, "deg=12 random",         in.r12);
+
+    benchBiLinClip(opts, "deg=7x7 gsi real",    in.gsi_p_elev,  in.gsi_q_elev);
+    benchBiLinClip(opts, "deg=7x7 random",      in.r77p,        in.r77q);
+    benchBiLinClip(opts, "deg=5x5 nsns real",   in.nsns_p_elev, in.nsns_q_elev);
+    benchBiLinClip(opts, "deg=5x5 random",      in.r55p,        in.r55q);
+}
+
+struct Benchmark {
+    const char     *name;
+    void          (*run)(BenchOptions const &opts);
+};
+
+static Benchmark const benchmarks[] = {
+    { "mesh_copy",          benchMeshCopy },
+    { "mesh_copyappend",    benchMeshCopyAppend },
+    { "obj_read",           benchObjRead },
+    { "obj_write",          benchObjWrite },
+    { "swc_read",           benchSWCRead },
+    { "pipeline",           benchPipeline },
+    { "poly_arith",         benchPolyArith },
+    { "poly_roots",         benchPolyRoots },
+    { "reanalysis",         benchReanalysis }
+};
+
+int main(int argc, char *argv[])
+{
+    BenchOptions                opts    = { 10000000, 1000000, 3, 1, 1000000, { 1, 3, 6, 0.4, 1.2 } };
+    std::vector<std::string>    selected;
+    int                         i;
+
+    for (i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if ((   arg == "-faces" || arg == "-nodes" || arg == "-reps" || arg == "-somas" ||
+                arg == "-depth" || arg == "-segments" || arg == "-threads" || arg == "-ops") && i + 1 < argc)
+        {
+            uint32_t value = Aux::Alg::stou(argv[++i]);
+            if (arg == "-faces") {
+                opts.nfaces             = value;
+            }
+            else if (arg == "-nodes") {
+                opts.nnodes             = value;
+            }
+            else if (arg == "-reps") {
+                opts.nreps              = value;
+            }
+            else if (arg == "-somas") {
+                opts.morph.nsomas       = value;
+            }
+            else if (arg == "-depth") {
+                opts.morph.depth        = value;
+            }
+            else if (arg == "-segments") {
+                opts.morph.nsegments    = value;
+            }
+            else if (arg == "-ops") {
+                opts.nops               = value;
+            }
+            else {
+                opts.nthreads           = std::max<uint32_t>(value, 1);
+            }
+        }
+        else if (arg == "-radius" && i + 2 < argc) {
+            opts.morph.radius_min = std::stod(argv[++i]);
+            opts.morph.radius_max = std::stod(argv[++i]);
+        }
+        else if (arg[0] == '-') {
+            printf("%s", usage_text.c_str());
+            return EXIT_FAILURE;
+        }
+        else {
+            selected.push_back(arg);
+        }
+    }
+
+    try {
+        for (auto &sel : selected) {
+            bool found = false;
+            for (auto &b : benchmarks) {
+                found = found || (sel == b.name);
+            }
+            if (!found) {
+                printf("unknown benchmark \"%s\".\n\n%s", sel.c_str(), usage_text.c_str());
+                return EXIT_FAILURE;
+            }
+        }
+
+        for (auto &b : benchmarks) {
+            if (selected.empty() || std::find(selected.begin(), selected.end(), b.name) != selected.end()) {
+                b.run(opts);
+            }
+        }
+    }
+    catch (const char *err) {
+        printf("caught string err: \"%s\". shutting down..\n", err);
+        return EXIT_FAILURE;
+    }
+    catch (std::string& err) {
+        printf("caught string err: \"%s\". shutting down..\n", err.c_str());
+        return EXIT_FAILURE;
+    }
+    catch (MeshEx& ex) {
+        printf("caught MeshEx. error msg: \"%s\". shutting down..\n", ex.error_msg.c_str());
+        return EXIT_FAILURE;
+    }
+    catch (...) {
+        printf("caught unhandled exception. shutting down..\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
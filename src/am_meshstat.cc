@@ -104,7 +104,9 @@ std::string const usage_text =
 "\n"\
 "am_meshstat: generate mesh statistics.\n"\
 "\n"\
-"Usage: am_meshstat <OBJ_FILE>\n"\
+"Usage: am_meshstat <OBJ_FILE|AMB_FILE>\n"\
+"\n"\
+"files ending in \".amb\" are read as binary meshes.\n"\
 "\n";
 
 using namespace std;
@@ -126,7 +128,7 @@ int main(int argc, char *argv[])
         int         nvertices, nfaces, nedges, chi;
 
         Mesh<bool, bool, bool, double> M;
-        M.readFromObjFile(meshname.c_str());
+        M.readFromFile(meshname.c_str());
 
         /* statistics */
         area            = M.getTotalArea();
@@ -47,6 +47,12 @@
 #include "common.hh"
 
 #include <stdarg.h>
+#include <sstream>
+#include <cfloat>
+#ifndef __WIN32__
+    #include <dirent.h>
+    #include <sys/stat.h>
+#endif
 #include "debug.hh"
 #include "Vec3.hh"
 #include "aux.hh"
@@ -142,6 +148,105 @@ namespace Aux {
             return std::numeric_limits<long double>::infinity();
         }
 
+        bool
+        parseDoubleClassic(
+            char const *begin,
+            char const *end,
+            double     &x)
+        {
+            std::istringstream iss(std::string(begin, end));
+            iss.imbue(std::locale::classic());
+            iss >> x;
+            return (!iss.fail() && iss.peek() == std::char_traits<char>::eof());
+        }
+
+        uint32_t
+        formatExp10(
+            char   *out,
+            double  x)
+        {
+            /* all powers of ten up to 10^27 are exact in an 80-bit long double. if long double is
+             * just a double, only those up to 10^22 are. */
+            static const long double pow10[28] = {
+                    1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,  1e7L,  1e8L,  1e9L,
+                    1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+                    1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+                };
+            static const int32_t        kmax        = (LDBL_MANT_DIG >= 64) ? 27 : 22;
+
+            /* the scaled value below is < 1e11 and suffers from a single rounding, so its error is
+             * far below this margin. fractional parts that close to 1/2 are left to snprintf(). */
+            static const long double    tie_margin  = 1e11L * LDBL_EPSILON * 4;
+
+            long double a       = std::fabs((long double)x);
+            long double scaled  = 0;
+            uint64_t    digits  = 0;
+            int32_t     exp10   = 0;
+            char       *s       = out;
+
+            if (!std::isfinite(x)) {
+                return snprintf(out, 32, "%+.10e", x);
+            }
+
+            if (a != 0) {
+                /* estimate exp10 from the binary exponent, which may be off by one. correct it
+                 * until scaled has exactly 11 digits in front of the decimal point. */
+                int e2;
+                std::frexp(x, &e2);
+                exp10 = (int32_t)std::floor((e2 - 1) * 0.30102999566398120);
+                for (uint32_t attempt = 0; ; attempt++) {
+                    int32_t k = 10 - exp10;
+                    if (k < -kmax || k > kmax || attempt > 2) {
+                        return snprintf(out, 32, "%+.10e", x);
+                    }
+
+                    scaled = (k >= 0) ? a * pow10[k] : a / pow10[-k];
+                    if (scaled < 1e10L) {
+                        exp10--;
+                    }
+                    else if (scaled >= 1e11L) {
+                        exp10++;
+                    }
+                    else {
+                        break;
+                    }
+                }
+
+                long double r       = std::floor(scaled);
+                long double frac    = scaled - r;
+                if (std::fabs(frac - 0.5L) < tie_margin) {
+                    return snprintf(out, 32, "%+.10e", x);
+                }
+
+                digits = (uint64_t)r + (frac > 0.5L);
+                if (digits == 100000000000ull) {
+                    digits = 10000000000ull;
+                    exp10++;
+                }
+            }
+
+            /* d.dddddddddde[+-]dd[d] */
+            *s++ = std::signbit(x) ? '-' : '+';
+            s[0] = '0' + (char)(digits / 10000000000ull);
+            s[1] = '.';
+            for (uint32_t i = 11; i > 1; i--) {
+                s[i]    = '0' + (char)(digits % 10);
+                digits /= 10;
+            }
+            s += 12;
+
+            *s++ = 'e';
+            *s++ = (exp10 < 0) ? '-' : '+';
+            exp10 = std::abs(exp10);
+            if (exp10 >= 100) {
+                *s++ = '0' + (char)(exp10 / 100);
+            }
+            *s++ = '0' + (char)((exp10 / 10) % 10);
+            *s++ = '0' + (char)(exp10 % 10);
+
+            return (uint32_t)(s - out);
+        }
+
 
     }
 
@@ -158,6 +263,23 @@ namespace Aux {
             }
             return result;
         }
+
+        static uint32_t max_threads = 0;
+
+        void
+        setMaxThreads(uint32_t n)
+        {
+            max_threads = n;
+        }
+
+        uint32_t
+        maxThreads()
+        {
+            if (max_threads) {
+                return max_threads;
+            }
+            return std::max<unsigned int>(std::thread::hardware_concurrency(), 1);
+        }
     }
 
     namespace File {
@@ -175,6 +297,246 @@ namespace Aux {
                 return false;
             }
         }
+
+        bool
+        seek(
+            FILE       *f,
+            uint64_t    offset)
+        {
+#ifdef __WIN32__
+            return (_fseeki64(f, (__int64)offset, SEEK_SET) == 0);
+#else
+            return (fseeko(f, (off_t)offset, SEEK_SET) == 0);
+#endif
+        }
+
+        bool
+        listDirectory(
+            std::string const          &path,
+            std::string const          &suffix,
+            std::vector<std::string>   &names)
+        {
+            names.clear();
+#ifdef __WIN32__
+            return false;
+#else
+            DIR *dir = opendir(path.c_str());
+            if (!dir) {
+                return false;
+            }
+
+            struct dirent *entry;
+            while ((entry = readdir(dir))) {
+                std::string name(entry->d_name);
+                if (name.size() <= suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+                    continue;
+                }
+
+                /* regular files only. d_type is not filled in by all file systems and doesn't follow symlinks. */
+                bool regular = (entry->d_type == DT_REG);
+                if (entry->d_type == DT_UNKNOWN || entry->d_type == DT_LNK) {
+                    struct stat st;
+                    regular = (stat((path + "/" + name).c_str(), &st) == 0 && S_ISREG(st.st_mode));
+                }
+                if (regular) {
+                    names.push_back(name);
+                }
+            }
+            closedir(dir);
+
+            std::sort(names.begin(), names.end());
+            return true;
+#endif
+        }
+
+        MappedFile::MappedFile()
+        {
+            this->map_data  = NULL;
+            this->map_size  = 0;
+            this->mapped    = false;
+        }
+
+        MappedFile::~MappedFile()
+        {
+            this->close();
+        }
+
+        bool
+        MappedFile::open(
+            const char *filename,
+            bool        sequential)
+        {
+            this->close();
+
+#ifndef __WIN32__
+            struct stat st;
+            int         fd = ::open(filename, O_RDONLY);
+
+            if (fd < 0) {
+                return false;
+            }
+            if (fstat(fd, &st) != 0) {
+                ::close(fd);
+                return false;
+            }
+
+            /* empty files can't be mapped, they are represented by the empty buffer */
+            if (st.st_size > 0) {
+                void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (p == MAP_FAILED) {
+                    return false;
+                }
+                if (sequential) {
+                    madvise(p, st.st_size, MADV_SEQUENTIAL);
+                }
+                this->map_data  = static_cast<char const *>(p);
+                this->map_size  = st.st_size;
+                this->mapped    = true;
+            }
+            else {
+                ::close(fd);
+            }
+            return true;
+#else
+            std::ifstream f(filename, std::ifstream::in | std::ifstream::binary);
+            if (!f.is_open()) {
+                return false;
+            }
+            f.seekg(0, std::ios::end);
+            size_t n = f.tellg();
+            f.seekg(0, std::ios::beg);
+
+            this->buffer.resize((n + 7) / 8);
+            f.read(reinterpret_cast<char *>(this->buffer.data()), n);
+            if (!f) {
+                this->buffer.clear();
+                return false;
+            }
+            this->map_data  = reinterpret_cast<char const *>(this->buffer.data());
+            this->map_size  = n;
+            return true;
+#endif
+        }
+
+        void
+        MappedFile::close()
+        {
+#ifndef __WIN32__
+            if (this->mapped) {
+                munmap(const_cast<char *>(this->map_data), this->map_size);
+            }
+#endif
+            std::vector<uint64_t>().swap(this->buffer);
+            this->map_data  = NULL;
+            this->map_size  = 0;
+            this->mapped    = false;
+        }
+
+        char const *
+        MappedFile::data() const
+        {
+            return this->map_data;
+        }
+
+        size_t
+        MappedFile::size() const
+        {
+            return this->map_size;
+        }
+
+        ScratchArray::ScratchArray()
+        {
+            this->map_data      = NULL;
+            this->map_size      = 0;
+            this->array_size    = 0;
+            this->fd            = -1;
+        }
+
+        ScratchArray::~ScratchArray()
+        {
+            this->close();
+        }
+
+        bool
+        ScratchArray::open(
+            std::string const  &filename,
+            size_t              size)
+        {
+            this->close();
+
+#ifndef __WIN32__
+            this->fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+            if (this->fd < 0) {
+                return false;
+            }
+            this->filename = filename;
+#endif
+            return this->resize(size);
+        }
+
+        bool
+        ScratchArray::resize(size_t size)
+        {
+#ifndef __WIN32__
+            if (this->fd < 0) {
+                return false;
+            }
+            if (this->map_size > 0) {
+                munmap(this->map_data, this->map_size);
+                this->map_data  = NULL;
+                this->map_size  = 0;
+            }
+            /* the file grows with zeros. mmap() of an empty range fails, so map at least one byte. */
+            size_t map_size = std::max<size_t>(size, 1);
+            if (ftruncate(this->fd, map_size) != 0) {
+                return false;
+            }
+            void *p = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, this->fd, 0);
+            if (p == MAP_FAILED) {
+                return false;
+            }
+            this->map_data  = static_cast<char *>(p);
+            this->map_size  = map_size;
+#else
+            this->buffer.resize((size + 7) / 8, 0);
+            this->map_data  = reinterpret_cast<char *>(this->buffer.data());
+#endif
+            this->array_size = size;
+            return true;
+        }
+
+        void
+        ScratchArray::close()
+        {
+#ifndef __WIN32__
+            if (this->map_size > 0) {
+                munmap(this->map_data, this->map_size);
+            }
+            if (this->fd >= 0) {
+                ::close(this->fd);
+                remove(this->filename.c_str());
+            }
+#endif
+            std::vector<uint64_t>().swap(this->buffer);
+            this->map_data      = NULL;
+            this->map_size      = 0;
+            this->array_size    = 0;
+            this->fd            = -1;
+            this->filename.clear();
+        }
+
+        char *
+        ScratchArray::data()
+        {
+            return this->map_data;
+        }
+
+        size_t
+        ScratchArray::size() const
+        {
+            return this->array_size;
+        }
     }
 
     namespace Geometry {
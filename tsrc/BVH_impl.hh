@@ -0,0 +1,198 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+template <typename R>
+BVH<R>::BVH(
+    std::vector<BoundingBox<R>> const  &boxes,
+    uint32_t                            nthreads)
+    : boxes(boxes), order(boxes.size()), nodes(boxes.empty() ? 0 : 2 * boxes.size() - 1)
+{
+    if (boxes.size() >= 0x80000000u) {
+        throw("BVH::BVH(): number of boxes exceeds 32-bit node index range.");
+    }
+
+    std::iota(this->order.begin(), this->order.end(), 0);
+    if (!this->boxes.empty()) {
+        this->build(0, 0, this->boxes.size(), std::max(nthreads, 1u));
+    }
+}
+
+template <typename R>
+size_t
+BVH<R>::size() const
+{
+    return this->boxes.size();
+}
+
+template <typename R>
+bool
+BVH<R>::isLeaf(uint32_t k) const
+{
+    return (this->nodes[k].end - this->nodes[k].begin == 1);
+}
+
+template <typename R>
+uint32_t
+BVH<R>::leftChild(uint32_t k) const
+{
+    return k + 1;
+}
+
+template <typename R>
+uint32_t
+BVH<R>::rightChild(uint32_t k) const
+{
+    Node const &n = this->nodes[k];
+    return k + 2 * ( (n.end - n.begin) / 2 );
+}
+
+template <typename R>
+void
+BVH<R>::build(
+    uint32_t    k,
+    uint32_t    begin,
+    uint32_t    end,
+    uint32_t    nthreads)
+{
+    Node       &n = this->nodes[k];
+    uint32_t    i, axis, mid;
+
+    n.begin = begin;
+    n.end   = end;
+    n.bb    = BoundingBox<R>();
+    for (i = begin; i < end; i++) {
+        n.bb.update(this->boxes[this->order[i]]);
+    }
+
+    if (end - begin == 1) {
+        return;
+    }
+
+    /* split at the median of the box centres along the axis in which the centres are spread most */
+    Vec3<R> c_min(Aux::Numbers::inf<R>()), c_max(-Aux::Numbers::inf<R>());
+    for (i = begin; i < end; i++) {
+        Vec3<R> c = (this->boxes[this->order[i]].min() + this->boxes[this->order[i]].max()) * 0.5;
+        Aux::VecMat::minVec3<R>(c_min, c_min, c);
+        Aux::VecMat::maxVec3<R>(c_max, c_max, c);
+    }
+    Vec3<R> ext = c_max - c_min;
+    axis        = (ext[0] >= ext[1] && ext[0] >= ext[2]) ? 0 : ( (ext[1] >= ext[2]) ? 1 : 2);
+
+    /* the left child covers (end - begin) / 2 boxes, which is what rightChild() relies on */
+    mid = begin + (end - begin) / 2;
+    std::nth_element(this->order.begin() + begin, this->order.begin() + mid, this->order.begin() + end,
+        [&] (uint32_t x, uint32_t y) -> bool
+        {
+            R cx = this->boxes[x].min()[axis] + this->boxes[x].max()[axis];
+            R cy = this->boxes[y].min()[axis] + this->boxes[y].max()[axis];
+            return (cx < cy || (cx == cy && x < y));
+        });
+
+    /* the subtrees occupy disjoint node and order ranges and can be built independently */
+    if (nthreads > 1) {
+        std::thread left(&BVH<R>::build, this, this->leftChild(k), begin, mid, nthreads / 2);
+        this->build(this->rightChild(k), mid, end, nthreads - nthreads / 2);
+        left.join();
+    }
+    else {
+        this->build(this->leftChild(k), begin, mid, 1);
+        this->build(this->rightChild(k), mid, end, 1);
+    }
+}
+
+template <typename R>
+template <typename F>
+void
+BVH<R>::overlappingPairs(F const &f) const
+{
+    if (!this->nodes.empty()) {
+        this->selfPairs(0, f);
+    }
+}
+
+template <typename R>
+template <typename F>
+void
+BVH<R>::selfPairs(
+    uint32_t    k,
+    F const    &f) const
+{
+    if (!this->isLeaf(k)) {
+        this->selfPairs(this->leftChild(k), f);
+        this->selfPairs(this->rightChild(k), f);
+        this->crossPairs(this->leftChild(k), this->rightChild(k), f);
+    }
+}
+
+template <typename R>
+template <typename F>
+void
+BVH<R>::crossPairs(
+    uint32_t    a,
+    uint32_t    b,
+    F const    &f) const
+{
+    if (!(this->nodes[a].bb && this->nodes[b].bb)) {
+        return;
+    }
+
+    if (this->isLeaf(a) && this->isLeaf(b)) {
+        uint32_t i = this->order[this->nodes[a].begin];
+        uint32_t j = this->order[this->nodes[b].begin];
+        f(std::min(i, j), std::max(i, j));
+    }
+    /* descend into the larger subtree */
+    else if (this->isLeaf(a) ||
+        (!this->isLeaf(b) && this->nodes[b].end - this->nodes[b].begin > this->nodes[a].end - this->nodes[a].begin))
+    {
+        this->crossPairs(a, this->leftChild(b), f);
+        this->crossPairs(a, this->rightChild(b), f);
+    }
+    else {
+        this->crossPairs(this->leftChild(a), b, f);
+        this->crossPairs(this->rightChild(a), b, f);
+    }
+}
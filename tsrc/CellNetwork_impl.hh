@@ -3471,7 +3471,7 @@ NeuronVertexAccessor::NeuronVertexAccessor(CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax
         NeuronVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
         NeuronVertexPred,
         neuron_iterator,
         neuron_const_iterator,
@@ -3532,7 +3532,7 @@ NeuriteVertexAccessor::NeuriteVertexAccessor(CellNetwork &C)
         NeuriteVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
         NeuriteVertexPred,
         neurite_iterator,
         neurite_const_iterator,
@@ -3580,7 +3580,7 @@ CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>
         SomaVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
         SomaVertexPred,
         soma_iterator,
         soma_const_iterator,
@@ -3653,7 +3653,7 @@ AxonAccessor::AxonAccessor(CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas,
         AxonVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
         AxonVertexPred,
         axon_iterator,
         axon_const_iterator,
@@ -3727,7 +3727,7 @@ DendriteAccessor::DendriteAccessor(CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, T
         DendriteVertex,
         typename Graph<Tn, Tv, Te>::Vertex,
         NeuronVertex,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::VertexPointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::VertexPointerType>,
         DendriteVertexPred,
         dendrite_iterator,
         dendrite_const_iterator,
@@ -3802,7 +3802,7 @@ NeuronEdgeAccessor::NeuronEdgeAccessor(CellNetwork &C)
         NeuronEdge,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
         NeuronEdgePred,
         neuron_edge_iterator,
         neuron_edge_const_iterator,
@@ -3864,7 +3864,7 @@ NeuriteRootEdgeAccessor::NeuriteRootEdgeAccessor(CellNetwork &C)
         NeuriteRootEdge,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
         NeuriteRootEdgePred,
         neurite_rootedge_iterator,
         neurite_rootedge_const_iterator,
@@ -4092,7 +4092,7 @@ AxonRootEdgeAccessor::AxonRootEdgeAccessor(CellNetwork &C)
         AxonRootEdge,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
         AxonRootEdgePred,
         axon_rootedge_iterator,
         axon_rootedge_const_iterator,
@@ -4159,7 +4159,7 @@ DendriteRootEdgeAccessor::DendriteRootEdgeAccessor(CellNetwork &C)
         DendriteRootEdge,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
         DendriteRootEdgePred,
         dendrite_rootedge_iterator,
         dendrite_rootedge_const_iterator,
@@ -4226,7 +4226,7 @@ NeuriteSegmentAccessor::NeuriteSegmentAccessor(CellNetwork &C)
         NeuriteSegment,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
         NeuriteSegmentPred,
         neurite_segment_iterator,
         neurite_segment_const_iterator,
@@ -4471,7 +4471,7 @@ AxonSegmentAccessor::AxonSegmentAccessor(CellNetwork &C)
         AxonSegment,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
         AxonSegmentPred,
         axon_segment_iterator,
         axon_segment_const_iterator,
@@ -4538,7 +4538,7 @@ DendriteSegmentAccessor::DendriteSegmentAccessor(CellNetwork &C)
         DendriteSegment,
         typename Graph<Tn, Tv, Te>::Edge,
         NeuronEdge,
-        std::map<uint32_t, typename Graph<Tn, Tv, Te>::EdgePointerType>,
+        IdSlotMap<typename Graph<Tn, Tv, Te>::EdgePointerType>,
         DendriteSegmentPred,
         dendrite_segment_iterator,
         dendrite_segment_const_iterator,
@@ -4902,7 +4902,7 @@ traverseBreadthFirst(
     while (!Q.empty()) {
         /* extract info and dequeue front() tuple */
         v_it    = std::get<0>(Q.front());
-        v_path  = std::get<1>(Q.front());
+        v_path.swap(std::get<1>(Q.front()));
         v_dist  = std::get<2>(Q.front());
         Q.pop_front();
 
@@ -4972,9 +4972,12 @@ traverseBreadthFirst(
                     }
                 }
 
-                /* extent path to v to get path to neighbour */
-                std::list<NeuronVertex *> nb_path = v_path;
-                nb_path.push_back(&(*nb_it));
+                /* extent path to v to get path to neighbour. paths are only maintained if they are returned. */
+                std::list<NeuronVertex *> nb_path;
+                if (return_paths) {
+                    nb_path = v_path;
+                    nb_path.push_back(&(*nb_it));
+                }
 
                 /* calculate distance to neighbour */
                 nb_dist = v_dist + e->getLength();
@@ -5014,8 +5017,11 @@ traverseBreadthFirst(
                         }
                     }
 
-                    std::list<NeuronVertex *> nb_path = v_path;
-                    nb_path.push_back(&(*nb_it));
+                    std::list<NeuronVertex *> nb_path;
+                    if (return_paths) {
+                        nb_path = v_path;
+                        nb_path.push_back(&(*nb_it));
+                    }
                     nb_dist = v_dist + e->getLength();
                     if (nb_it->getTraversalState(tid) == this->TRAV_UNSEEN) {
                         Q.push_back(
@@ -5756,147 +5762,202 @@ getGlobalCoordinateDisplacement() const
 }
 
 
-/* initialize network from standardized SWC file as used by NeuroMorpho.org */
+/* the file is read in one block and parsed in a single pass into per-line records, which are then scattered into the
+ * flat arrays of swc by compartment id. ids must be a permutation of 1 .. n. lines the fast parser does not accept are
+ * handed to sscanf(), so the accepted syntax is the same as that of the former line-by-line reader. */
 template <
     typename Tn, typename Tv, typename Te, typename Tso, typename Tnv, typename Tax, typename Tde,
     typename Tns, typename Tas, typename Tds, typename Tnr, typename Tar, typename Tdr, typename R
 >
 void
 CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
-readFromNeuroMorphoSWCFile(
-        std::string     filename,
-        bool const     &check_coincident_positions)
+readSWCData(
+        std::string const  &filename,
+        SWCData            &swc)
 {
-    using Common::UnitType;
-    using Aux::Alg::listContains;
-
-    debugl(1, "CellNetwork::readFromNeuroMorphoSWCFile():\n");
-    debugTabInc();
+    using Aux::Numbers::parseDouble;
+    using Aux::Numbers::parseUInt32;
 
-    /* define sorting function as lambda */
-    auto sort_id = [] (SWCNode const &a, SWCNode const &b) -> bool {
-        return (a.compartment_id < b.compartment_id);
-    };
-
-    /* try to open input file */
-    std::ifstream           f;
-    std::string             line_string;
-    char                   *line;
-    char                   *linestart;
-    std::vector<SWCNode>    swc_nodes;
-    std::vector<bool>       node_traversed;
-    Vec3<R>                 p;
-    R                       r;
-    uint32_t                compartment_id, compartment_type;
-    int32_t                 parent_id;
-    uint32_t                nmatch;
-
-    debugl(2, "trying to open input file \"%s\". \n", filename.c_str() );
+    debugl(2, "CellNetwork::readSWCData(): trying to read input file \"%s\". \n", filename.c_str() );
 
-    f.open(filename, std::ifstream::in);
-    if ( !f.is_open() ) {
-        //printf("CellNetwork::readFromNeuroMorphoSWCFile(): cannot open SWC file \"%s\" for reading.\n", filename.c_str() );
+    Aux::File::MappedFile   file;
+    if (!file.open(filename.c_str())) {
         throw("CellNetwork::readFromNeuroMorphoSWCFile(): unable to open SWC file for reading.");
     }
-    debugl(2, "successfully opened. parsing input file one line at a time..\n");
 
-    debugTabInc();
-    while ( f.good() ) {
-        std::getline(f, line_string);
-        if (line_string.size() == 0) {
-            debugl(4, "empty line..\n");
-            continue;
-        }
+    struct SWCRecord {
+        uint32_t    compartment_id;
+        uint32_t    compartment_type;
+        int32_t     parent_id;
+        double      x[4];
+    };
+
+    char const                 *p       = file.data();
+    char const                 *end     = p + file.size();
+    std::vector<SWCRecord>      records;
+    std::string                 line_string;
+    uint32_t                    i, n;
 
-        line        = new char [ line_string.size() + 1];
-        linestart   = line;
-        std::strcpy(line, line_string.c_str() );
+    auto is_blank = [] (char c) -> bool { return (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f'); };
 
-        while (isspace(*linestart)) {
-            ++linestart;
+    while (p < end) {
+        char const *eol = static_cast<char const *>(memchr(p, '\n', end - p));
+        if (!eol) {
+            eol = end;
         }
 
-        /* skip comments */
-        if (*linestart == '#') {
-            debugl(4, "comment found.. ignoring.\n");
-            delete[] line;
-            continue;
+        /* skip leading whitespace, empty lines and comments */
+        char const *s = p;
+        while (s < eol && is_blank(*s)) {
+            ++s;
         }
-        else {
-            debugl(4, "line: \"%s\".\n", line);
+        if (s == eol || *s == '#') {
+            p = (eol < end) ? eol + 1 : end;
+            continue;
         }
 
-        if (std::is_same<double, R>::value) {
-            nmatch = sscanf(linestart, "%u %u %lf %lf %lf %lf %d\n", &compartment_id, &compartment_type, &p[0], &p[1], &p[2], &r, &parent_id);
+        SWCRecord   rec;
+        uint32_t    parent;
+        bool        parent_neg;
+        bool        ok = parseUInt32(s, eol, rec.compartment_id);
+        if (ok) {
+            while (s < eol && is_blank(*s)) ++s;
+            ok = parseUInt32(s, eol, rec.compartment_type);
         }
-        if (std::is_same<float, R>::value) {
-            nmatch = sscanf(linestart, "%u %u %f %f %f %f %d\n", &compartment_id, &compartment_type, &p[0], &p[1], &p[2], &r, &parent_id);
+        for (i = 0; ok && i < 4; i++) {
+            while (s < eol && is_blank(*s)) ++s;
+            ok = parseDouble(s, eol, rec.x[i]);
         }
-        else {
-            nmatch = sscanf(linestart, "%u %u %lf %lf %lf %lf %d\n", &compartment_id, &compartment_type, &p[0], &p[1], &p[2], &r, &parent_id);
+        if (ok) {
+            while (s < eol && is_blank(*s)) ++s;
+            parent_neg = (s < eol && *s == '-');
+            s         += parent_neg;
+            ok         = parseUInt32(s, eol, parent) && parent <= (uint32_t)INT32_MAX;
+            if (ok) {
+                rec.parent_id = parent_neg ? -(int32_t)parent : (int32_t)parent;
+            }
         }
 
-        if (nmatch != 7) {
-            throw("CellNetwork::readFromNeuroMorphoSWCFile(): line is not a comment, yet necessary information could not be matched. syntax error..");
+        /* rare syntax (explicit '+' signs, hexadecimal floats, ..): same conversion as the former reader */
+        if (!ok) {
+            R           xr[4];
+            uint32_t    nmatch;
+
+            line_string.assign(p, eol);
+            if (std::is_same<float, R>::value) {
+                nmatch = sscanf(line_string.c_str(), "%u %u %f %f %f %f %d\n", &rec.compartment_id,
+                    &rec.compartment_type, &xr[0], &xr[1], &xr[2], &xr[3], &rec.parent_id);
+            }
+            else {
+                nmatch = sscanf(line_string.c_str(), "%u %u %lf %lf %lf %lf %d\n", &rec.compartment_id,
+                    &rec.compartment_type, &xr[0], &xr[1], &xr[2], &xr[3], &rec.parent_id);
+            }
+            if (nmatch != 7) {
+                throw("CellNetwork::readFromNeuroMorphoSWCFile(): line is not a comment, yet necessary information could not be matched. syntax error..");
+            }
+            for (i = 0; i < 4; i++) {
+                rec.x[i] = xr[i];
+            }
         }
 
-        /* decrement indices, we count fromt 0 */
-        compartment_id--;
-        /* if parent_id is not -1 (soma), decrement as well */
-        if (parent_id != -1) {
-            parent_id--;
+        /* decrement indices, we count from 0. if parent_id is not -1 (soma), decrement as well */
+        rec.compartment_id--;
+        if (rec.parent_id != -1) {
+            rec.parent_id--;
         }
-        //printf("(%u,%u,%f,%f,%f,%f,%d)\n", section_idx, section_type, x, y, z, r, parent_idx);
-
-        swc_nodes.push_back(
-                SWCNode(
-                    compartment_id,
-                    compartment_type,
-                    parent_id,
-                    { { compartment_id, p, r } }
-                )
-            );
+        records.push_back(rec);
 
-        delete [] line;
+        p = (eol < end) ? eol + 1 : end;
     }
-    debugTabDec();
-    debugl(2, "input file parsed into SWCNode array.\n");
-    
-    /* sort nodes by compartment id. */
-    std::sort(swc_nodes.begin(), swc_nodes.end(), sort_id);
+    debugl(2, "input file parsed: %zu compartments.\n", records.size());
 
-    /* resize and init traversal flag array */
-    node_traversed.assign(swc_nodes.size(), false);
+    /* scatter records into flat arrays indexed by compartment id. all ids are consecutive (and hence pairwise
+     * distinct) iff every id is smaller than the number of records and no id occurs twice. */
+    n = records.size();
+    swc.compartment_type.assign(n, 0);
+    swc.parent_id.assign(n, -1);
+    swc.pos.assign(n, Vec3<R>(0, 0, 0));
+    swc.radius.assign(n, 0);
 
-    debugl(2, "checking for consecutive ids.\n");
-    /* check whether all ids are consecutive and hence also pairwise distinct */
-    for (uint32_t i = 0; i < swc_nodes.size(); i++) {
-        if (swc_nodes[i].compartment_id != i) {
+    std::vector<bool> id_seen(n, false);
+    for (auto &rec : records) {
+        if (rec.compartment_id >= n || id_seen[rec.compartment_id]) {
             throw("CellNetwork::readFromNeuroMorphoSWCFile(): compartment ids not consecutive. semantic error.\n");
         }
-    }
-
-    debugl(2, "computing preliminary tree structure.\n");
-    /* compute tree structure among nodes and get all soma nodes, that is: all nodes with parent_id -1. other nodes may
-     * refer encode information for the same soma and will be merged below */
-    // FIXME: The assertion "soma nodes are nodes with parent_id -1" is not true in general.
-    //        Root nodes (parent_id == -1) are not required to be soma nodes (and vice-versa).
-    //        I get a hard-to-track RTE for a geometry where this is the root node is a dendritic node.
-    std::list<uint32_t> soma_root_node_ids;
-    for (auto &node : swc_nodes) {
-        /* get parent of node, add node as child of parent */
-        if (node.parent_id == -1) {
-            soma_root_node_ids.push_back( node.compartment_id );
+        id_seen[rec.compartment_id]                 = true;
+        swc.compartment_type[rec.compartment_id]    = rec.compartment_type;
+        swc.parent_id[rec.compartment_id]           = rec.parent_id;
+        swc.pos[rec.compartment_id]                 = Vec3<R>(rec.x[0], rec.x[1], rec.x[2]);
+        swc.radius[rec.compartment_id]              = rec.x[3];
+    }
+    std::vector<SWCRecord>().swap(records);
+
+    /* counting sort of all nodes by parent id. nodes are visited in ascending order of id, hence every child list
+     * comes out sorted. */
+    swc.child_offsets.assign(n + 1, 0);
+    swc.root_ids.clear();
+    for (i = 0; i < n; i++) {
+        int32_t parent = swc.parent_id[i];
+        if (parent == -1) {
+            swc.root_ids.push_back(i);
+        }
+        else if (parent < 0 || (uint32_t)parent >= n) {
+            throw("CellNetwork::readFromNeuroMorphoSWCFile(): parent id refers to non-existing compartment. semantic error.\n");
         }
         else {
-            swc_nodes[node.parent_id].child_ids.push_back(node.compartment_id);
+            swc.child_offsets[parent + 1]++;
         }
     }
+    for (i = 0; i < n; i++) {
+        swc.child_offsets[i + 1] += swc.child_offsets[i];
+    }
 
-    /* sort all child_id lists. */
-    for (auto &node : swc_nodes) {
-        node.child_ids.sort();
+    std::vector<uint32_t> fill(swc.child_offsets.begin(), swc.child_offsets.end() - 1);
+    swc.child_ids.resize(n - swc.root_ids.size());
+    for (i = 0; i < n; i++) {
+        if (swc.parent_id[i] != -1) {
+            swc.child_ids[fill[swc.parent_id[i]]++] = i;
+        }
     }
+}
+
+/* initialize network from standardized SWC file as used by NeuroMorpho.org */
+template <
+    typename Tn, typename Tv, typename Te, typename Tso, typename Tnv, typename Tax, typename Tde,
+    typename Tns, typename Tas, typename Tds, typename Tnr, typename Tar, typename Tdr, typename R
+>
+void
+CellNetwork<Tn, Tv, Te, Tso, Tnv, Tax, Tde, Tns, Tas, Tds, Tnr, Tar, Tdr, R>::
+readFromNeuroMorphoSWCFile(
+        std::string     filename,
+        bool const     &check_coincident_positions)
+{
+    using Common::UnitType;
+    using Aux::Alg::listContains;
+
+    debugl(1, "CellNetwork::readFromNeuroMorphoSWCFile():\n");
+    debugTabInc();
+
+    SWCData                 swc;
+    std::vector<bool>       node_traversed;
+    uint32_t                i;
+
+    /* read file into flat arrays with the preliminary tree structure among nodes */
+    CellNetwork::readSWCData(filename, swc);
+
+    /* resize and init traversal flag array */
+    node_traversed.assign(swc.size(), false);
+
+    /* all soma nodes, that is: all nodes with parent_id -1. other nodes may refer encode information for the same soma
+     * and will be merged below */
+    // FIXME: The assertion "soma nodes are nodes with parent_id -1" is not true in general.
+    //        Root nodes (parent_id == -1) are not required to be soma nodes (and vice-versa).
+    //        I get a hard-to-track RTE for a geometry where this is the root node is a dendritic node.
+    std::vector<uint32_t> const &soma_root_node_ids = swc.root_ids;
+
+    auto section = [&swc] (uint32_t id) -> CellSection {
+        return CellSection(id, swc.pos[id], swc.radius[id]);
+    };
 
     debugl(2, "gathering soma information from sub-graphs of soma info nodes.\n");
 
@@ -5906,9 +5967,11 @@ readFromNeuroMorphoSWCFile(
      * graph (soma_sectiongraph), which is then stored in the SomaVertex in (this) CellNetwork. this graph exactly
      * mirrors the data contained in the SWC file, ambiguous and ill-formed as it may be in many cases.
      *
-     * remember ids of all soma info nodes excluding the root soma node, mark all of them as traversed and disconnect
-     * them from the soma root node by erasing the respective ids from the soma root node's children list. */
-    std::list<uint32_t>                             soma_info_node_ids;
+     * remember ids of all soma info nodes excluding the root soma node and mark all of them as traversed. the children
+     * of the soma root node used below are its non-soma children followed by all non-soma children of soma info nodes,
+     * which are redirected to the root. */
+    std::vector<uint32_t>                           soma_info_node_ids;
+    std::vector<std::vector<uint32_t>>              soma_root_children(soma_root_node_ids.size());
 
     /* map associating soma root node ids to soma graphs and a matching iterator */
     std::map<
@@ -5920,9 +5983,9 @@ readFromNeuroMorphoSWCFile(
         Graph<uint32_t, CellSection, UnitType>
     >::iterator                                     sgm_it;
 
-    /* stack containing pairs (id, Graph::vertex_iterator) where the id refers to swc_nodes array and graph_iterator is
+    /* stack containing pairs (id, Graph::vertex_iterator) where the id refers to the swc arrays and graph_iterator is
      * the iterator to the respective vertex in soma_sectiongraph */
-    std::list<
+    std::vector<
             std::pair<
                 uint32_t,
                 typename Graph<uint32_t, CellSection, UnitType>::vertex_iterator
@@ -5931,14 +5994,16 @@ readFromNeuroMorphoSWCFile(
 
     /* traverse connected components of all soma root nodes */
     debugTabInc();
-    for (auto &sid : soma_root_node_ids) {
+    for (uint32_t k = 0; k < soma_root_node_ids.size(); k++) {
+        const uint32_t          sid             = soma_root_node_ids[k];
+        std::vector<uint32_t>  &root_children   = soma_root_children[k];
+
         debugl(3, "processing soma root node %2d.\n", sid);
-        SWCNode &soma_root_node = swc_nodes[sid];
 
         /* reset data */
         soma_info_node_ids.clear();
         
-        /* create new soma graph for soma_root_node with id sid */
+        /* create new soma graph for soma root node with id sid */
         auto sgmpair = soma_sectiongraph_map.insert({ sid, Graph<uint32_t, CellSection, UnitType>() });
 
         if (!sgmpair.second) {
@@ -5950,85 +6015,87 @@ readFromNeuroMorphoSWCFile(
         Graph<uint32_t, CellSection, UnitType> &soma_sectiongraph = (sgmpair.first)->second;
         
         /* insert soma vertex into fresh soma section graph */
-        auto somagraph_sit = soma_sectiongraph.vertices.insert(soma_root_node.sections.front());
+        auto somagraph_sit = soma_sectiongraph.vertices.insert(section(sid));
 
         /* store id of inserted vertex representing soma root node in the graph's data. this is used to quickly identify
          * the root (or source) in soma_sectiongraph */
         soma_sectiongraph.data() = somagraph_sit->id();
 
-        debugl(3, "initializing traversal stack with all direct soma info node children of current soma root node %d.\n", soma_root_node.compartment_id);
+        debugl(3, "initializing traversal stack with all direct soma info node children of current soma root node %d.\n", sid);
         /* init stack to contain pairs (id, soma_sectiongraph iterator) for all non-root soma info nodes directly
-         * connected to the root soma node. */
+         * connected to the root soma node. the first child has to end up on top of the stack, so the soma info
+         * children are pushed in reverse order after their vertices have been inserted in ascending order. */
         S.clear();
         debugTabInc();
-        for (auto &child_id : soma_root_node.child_ids) {
-            SWCNode &c = swc_nodes[child_id];
-            if (c.compartment_type == SOMA_COMPARTMENT) {
+        for (i = swc.child_offsets[sid]; i < swc.child_offsets[sid + 1]; i++) {
+            const uint32_t c_id = swc.child_ids[i];
+            if (swc.compartment_type[c_id] == SOMA_COMPARTMENT) {
                 /* insert vertex for c and edge (soma_root_node, c) into soma_sectiongraph */
-                auto somagraph_c_it = soma_sectiongraph.vertices.insert(c.sections.front());
+                auto somagraph_c_it = soma_sectiongraph.vertices.insert(section(c_id));
                 auto rpair          = soma_sectiongraph.edges.insert(somagraph_sit, somagraph_c_it);
                 if (rpair.second) {
-                    debugl(3, "adding soma info node %d to _bottom_ of stack.\n", c.compartment_id);
-                    S.push_front( { c.compartment_id, somagraph_c_it } );
-                    soma_info_node_ids.push_back(c.compartment_id);
+                    debugl(3, "adding soma info node %d to _bottom_ of stack.\n", c_id);
+                    S.push_back( { c_id, somagraph_c_it } );
+                    soma_info_node_ids.push_back(c_id);
                 }
                 else {
                     throw("CellNetwork::readFromNeuroMorphoSWCFile(): failed to add edge (r, c) into soma info "\
                         "graph for soma root node r and its child c. duplicate edge in SWC file?");
                 }
             }
+            else {
+                root_children.push_back(c_id);
+            }
         }
+        std::reverse(S.begin(), S.end());
         debugTabDec();
         debugl(3, "traversal stack initialized. starting depth-first traversal..\n");
 
         /* stack has been initialized => depth-first traversal of all soma info node sub-trees for current
-         * soma_root_node. */
+         * soma root node. */
         debugTabInc();
         while ( !S.empty()) {
             /* get top() soma info node id / soma section graph iterator */
-            SWCNode &v          = swc_nodes[S.back().first];
+            const uint32_t v_id = S.back().first;
             auto somagraph_v_it = S.back().second;
 
             S.pop_back();
 
-            debugl(3, "stack top() current soma info node v: %2d. processing children..\n", v.compartment_id);
+            debugl(3, "stack top() current soma info node v: %2d. processing children..\n", v_id);
 
             /* scan through children of v */
             debugTabInc();
-            for (auto child_it = v.child_ids.begin(); child_it != v.child_ids.end(); ) {
-                SWCNode c = swc_nodes[*child_it];
+            for (i = swc.child_offsets[v_id]; i < swc.child_offsets[v_id + 1]; i++) {
+                const uint32_t c_id = swc.child_ids[i];
 
-                debugl(3, "current child c = %2d of v = %2d.\n", c.compartment_id, v.compartment_id);
+                debugl(3, "current child c = %2d of v = %2d.\n", c_id, v_id);
 
                 /* if child is a soma info node, handle it */
                 debugTabInc();
-                if (c.compartment_type == SOMA_COMPARTMENT) {
+                if (swc.compartment_type[c_id] == SOMA_COMPARTMENT) {
                     debugl(3, "child is SOMA compartment => adding child c and edge (v,c) to soma graph.\n");
 
                     /* add vertex c and edge (v, c) to soma section graph */
-                    auto somagraph_c_it     = soma_sectiongraph.vertices.insert(c.sections.front());
-                    auto somagraph_vc_eit   = soma_sectiongraph.edges.insert(somagraph_v_it, somagraph_c_it);
+                    auto somagraph_c_it     = soma_sectiongraph.vertices.insert(section(c_id));
+                    soma_sectiongraph.edges.insert(somagraph_v_it, somagraph_c_it);
 
                     /* although it might be reasonable to assume that the soma info data is a tree, there seems to be
                      * little regularity in the data from NeuroMorpho.org. therefore check if child has already been
                      * traversed before pushing onto stack. */
-                    if (!node_traversed[c.compartment_id]) {
+                    if (!node_traversed[c_id]) {
                         debugl(3, "child c not yet traversed. pushing onto stack..\n");
-                        S.push_back( { c.compartment_id, somagraph_c_it } );
+                        S.push_back( { c_id, somagraph_c_it } );
 
                         /* append child node to soma info node list */
-                        soma_info_node_ids.push_back(c.compartment_id);
+                        soma_info_node_ids.push_back(c_id);
                     }
-
-                    ++child_it;
                 }
                 /* redirect all children with compartment type other than soma to the soma root node. */
                 else {
                     debugl(3, "child is non-SOMA compartment => redirecting edge (v = %d, c = %d) to soma root node %d as edge (%d, c = %d).\n",
-                        v.compartment_id, c.compartment_id, soma_root_node.compartment_id, soma_root_node.compartment_id, c.compartment_id);
+                        v_id, c_id, sid, sid, c_id);
 
-                    soma_root_node.child_ids.push_back(*child_it); 
-                    child_it = v.child_ids.erase(child_it);
+                    root_children.push_back(c_id);
                 }
                 debugTabDec();
             }
@@ -6036,7 +6103,7 @@ readFromNeuroMorphoSWCFile(
 
             /* all v's children have been processed (redirected to root soma node, skipped or pushed onto the stack in
              * case of soma info nodes). mark v as traversed. */
-            node_traversed[v.compartment_id] = true;
+            node_traversed[v_id] = true;
         }
         debugTabDec();
 
@@ -6046,18 +6113,6 @@ readFromNeuroMorphoSWCFile(
         for (auto &vid : soma_info_node_ids) {
             node_traversed[vid] = true;
         }
-
-        /* disconnect all non-root soma info nodes from root soma node */
-        debugl(3, "removing all (non-root) soma info node children of soma root node.\n");
-        debugTabInc();
-        for (auto child_it = soma_root_node.child_ids.begin(); child_it != soma_root_node.child_ids.end(); ) {
-            if (swc_nodes[*child_it].compartment_type == SOMA_COMPARTMENT) {
-                debugl(3,"removing child node %2d of soma root node %2d\n", *child_it, soma_root_node.compartment_id);
-                child_it = soma_root_node.child_ids.erase(child_it);
-            }
-            else ++child_it;
-        }
-        debugTabDec();
     }
     debugTabDec();
 
@@ -6065,14 +6120,15 @@ readFromNeuroMorphoSWCFile(
 
     /* traverse the preliminary swc "tree" breadth first and insert all vertices / edges into (this) CellNetwork */
 
-    /* queue containing pairs (id, CellNetwork::neuron_iterator) where the id refers to swc_nodes array and
-     * neuron_iterator is the iterator to the respective NeuronVertex in (this) CellNetwork */
-    std::list<
+    /* queue containing pairs (id, CellNetwork::neuron_iterator) where the id refers to the swc arrays and
+     * neuron_iterator is the iterator to the respective NeuronVertex in (this) CellNetwork. front is Q[qhead]. */
+    std::vector<
             std::pair<
                 uint32_t,
                 neuron_iterator
             >
         >                       Q;
+    size_t                      qhead;
 
     /* iterators for all possible situations.. */
     neuron_iterator             nit;
@@ -6090,13 +6146,18 @@ readFromNeuroMorphoSWCFile(
     axon_segment_iterator       asit;
     dendrite_segment_iterator   dsit;
 
+    Q.reserve(swc.size());
+
     debugl(2, "traversing preliminary forest breadth-first and constructing CellNetwork..\n");
     debugTabInc();
-    for (auto &sid : soma_root_node_ids) {
+    for (uint32_t k = 0; k < soma_root_node_ids.size(); k++) {
+        const uint32_t sid = soma_root_node_ids[k];
+
         debugl(3, "traversing connected component of soma %2d.\n", sid);
 
         /* clear Q */
         Q.clear();
+        qhead = 0;
 
         /* insert soma root node with section graph retrieved from soma_sectiongraph_map, implicitly convert returned
          * soma_iterator to neuron_iterator when enqueueing pair (sid, soma_iterator) into Q. */
@@ -6112,24 +6173,37 @@ readFromNeuroMorphoSWCFile(
 
         /* breadth-first traversal. while queue non-empty, keep going */
         debugTabInc();
-        while (!Q.empty()) {
+        while (qhead < Q.size()) {
             /* get current front() node */
-            SWCNode &n  = swc_nodes[Q.front().first];
-            nit         = Q.front().second;
-            Q.pop_front();
+            const uint32_t n_id     = Q[qhead].first;
+            const uint32_t n_type   = swc.compartment_type[n_id];
+            nit                     = Q[qhead].second;
+            qhead++;
 
-            debugl(3, "current node n: %d.\n", n.compartment_id);
+            debugl(3, "current node n: %d.\n", n_id);
 
             /* mark node as traversed */
-            node_traversed[n.compartment_id] = true;
+            node_traversed[n_id] = true;
+
+            /* children of n: the soma root node gets its redirected child list computed above */
+            uint32_t const *children_begin, *children_end;
+            if (n_id == sid) {
+                children_begin  = soma_root_children[k].data();
+                children_end    = children_begin + soma_root_children[k].size();
+            }
+            else {
+                children_begin  = swc.child_ids.data() + swc.child_offsets[n_id];
+                children_end    = swc.child_ids.data() + swc.child_offsets[n_id + 1];
+            }
 
             debugl(3, "inspecting all of n's neighbours and adding corresponding edges to CellNetwork..\n");
             /* examine all children of n, that is to say all out-going edge (n, c) */
             debugTabInc();
-            for (auto &child_id : n.child_ids) {
-                SWCNode &c = swc_nodes[child_id];
+            for (uint32_t const *child_it = children_begin; child_it != children_end; ++child_it) {
+                const uint32_t child_id = *child_it;
+                const uint32_t c_type   = swc.compartment_type[child_id];
                 debugl(3, "current neighbour c = %2d of n = %2d. adding c as vertex in CellNetwork..\n",
-                    c.compartment_id, n.compartment_id);
+                    child_id, n_id);
 
                 debugTabInc();
 
@@ -6140,7 +6214,7 @@ readFromNeuroMorphoSWCFile(
 
                 debugTabInc();
                 /* add child node node c as vertex */
-                switch (c.compartment_type) {
+                switch (c_type) {
                     case SOMA_COMPARTMENT:
                         debugl(3, "c is soma vertex => inserting..\n");
                         /* insert soma vertex, use default values for Tv and Ts, since SWC files do not provide any such
@@ -6150,7 +6224,7 @@ readFromNeuroMorphoSWCFile(
                          * for the special case of the soma, we need the section graph computed from all soma info nodes
                          * above. it has been inserted into soma_sectiongraph_map with the root soma node's compartment id
                          * as key => find graph in map and insert soma vertex. */
-                        sgm_it = soma_sectiongraph_map.find(c.compartment_id);
+                        sgm_it = soma_sectiongraph_map.find(child_id);
                         if (sgm_it != soma_sectiongraph_map.end()) {
                             /* insert soma with graph extracted from soma graph map iterator */
                             c_sit = this->soma_vertices.insert(sgm_it->second);
@@ -6164,44 +6238,26 @@ readFromNeuroMorphoSWCFile(
                     /* axon node */
                     case AXON_COMPARTMENT:
                         debugl(3, "c is axon => inserting..\n");
-                        if (c.sections.size() == 1) {
-                            c_ait = this->axon_vertices.insert(c.sections.front());
-                        }
-                        else {
-                            throw("CellNetwork::readFromNeuroMorphoSWCFile(): discovered axon SWC node containing not "\
-                                "exactly one CellSection. internal logic error.");
-                        }
+                        c_ait = this->axon_vertices.insert(section(child_id));
                         break;
 
                     /* apical dendrite node */
                     case APICAL_DENDRITE_COMPARTMENT:
                         debugl(3, "c is apical dendrite => inserting..\n");
-                        if (c.sections.size() == 1) {
-                            c_dit = this->dendrite_vertices.insert(c.sections.front(), true);
-                        }
-                        else {
-                            throw("CellNetwork::readFromNeuroMorphoSWCFile(): discovered basal dendrite SWC node "\
-                                "containing not exactly one CellSection. internal logic error.");
-                        }
+                        c_dit = this->dendrite_vertices.insert(section(child_id), true);
                         break;
 
                     /* basal dendrite node */
                     case BASAL_DENDRITE_COMPARTMENT:
                         debugl(3, "c is basal dendrite => inserting..\n");
-                        if (c.sections.size() == 1) {
-                            c_dit = this->dendrite_vertices.insert(c.sections.front(), false);
-                        }
-                        else {
-                            throw("CellNetwork::readFromNeuroMorphoSWCFile(): discovered apical dendrite SWC node "\
-                                "containing not exactly one CellSection. internal logic error.");
-                        }
+                        c_dit = this->dendrite_vertices.insert(section(child_id), false);
                         break;
 
                     default:
                         debugl(3, "c has unsupported section type. skipping n and its sub-tree.\n");
                         /* unsupported compartment type. skip node with continue, i.e. don't examine out-going edges */
                         printf("CellNetwork::readFromNeuroMorphoSWCFile(): WARNING: SWC node with unsupported compartment"\
-                               " type %2u: skipping node's sub-tree.\n", c.compartment_type);
+                               " type %2u: skipping node's sub-tree.\n", c_type);
                         continue;
                 }
                 debugTabDec();
@@ -6212,8 +6268,8 @@ readFromNeuroMorphoSWCFile(
 
                 debugTabInc();
                 /* axon root edge */
-                if      (n.compartment_type == SOMA_COMPARTMENT &&
-                        c.compartment_type == AXON_COMPARTMENT)
+                if      (n_type == SOMA_COMPARTMENT &&
+                        c_type == AXON_COMPARTMENT)
                 {
                     debugl(3, "edge (n, c) is axon root edge => adding..\n");
 
@@ -6223,8 +6279,8 @@ readFromNeuroMorphoSWCFile(
                     this->axon_root_edges.insert(n_sit, c_ait);
                 }
                 /* apical dendrite root edge */
-                else if (n.compartment_type == SOMA_COMPARTMENT &&
-                        c.compartment_type == APICAL_DENDRITE_COMPARTMENT)
+                else if (n_type == SOMA_COMPARTMENT &&
+                        c_type == APICAL_DENDRITE_COMPARTMENT)
                 {
                     debugl(3, "edge (n, c) is apical dendrite root edge => adding..\n");
 
@@ -6232,8 +6288,8 @@ readFromNeuroMorphoSWCFile(
                     this->dendrite_root_edges.insert(n_sit, c_dit);
                 }
                 /* basal dendrite root edge */
-                else if (n.compartment_type == SOMA_COMPARTMENT &&
-                        c.compartment_type == BASAL_DENDRITE_COMPARTMENT)
+                else if (n_type == SOMA_COMPARTMENT &&
+                        c_type == BASAL_DENDRITE_COMPARTMENT)
                 {
                     debugl(3, "edge (n, c) is basal dendrite root edge => adding..\n");
 
@@ -6241,8 +6297,8 @@ readFromNeuroMorphoSWCFile(
                     this->dendrite_root_edges.insert(n_sit, c_dit);
                 }
                 /* axon segment */
-                else if (n.compartment_type == AXON_COMPARTMENT &&
-                        c.compartment_type == AXON_COMPARTMENT)
+                else if (n_type == AXON_COMPARTMENT &&
+                        c_type == AXON_COMPARTMENT)
                 {
                     debugl(3, "edge (n, c) is axon segment => adding..\n");
 
@@ -6250,8 +6306,8 @@ readFromNeuroMorphoSWCFile(
                     this->axon_segments.insert(n_ait, c_ait);
                 }
                 /* apical dendrite segment */
-                else if (n.compartment_type == APICAL_DENDRITE_COMPARTMENT &&
-                        c.compartment_type == APICAL_DENDRITE_COMPARTMENT)
+                else if (n_type == APICAL_DENDRITE_COMPARTMENT &&
+                        c_type == APICAL_DENDRITE_COMPARTMENT)
                 {
                     debugl(3, "edge (n, c) is apical dendrite segment => adding..\n");
 
@@ -6259,8 +6315,8 @@ readFromNeuroMorphoSWCFile(
                     this->dendrite_segments.insert(n_dit, c_dit);
                 }
                 /* basal dendrite segment */
-                else if (n.compartment_type == BASAL_DENDRITE_COMPARTMENT &&
-                        c.compartment_type == BASAL_DENDRITE_COMPARTMENT)
+                else if (n_type == BASAL_DENDRITE_COMPARTMENT &&
+                        c_type == BASAL_DENDRITE_COMPARTMENT)
                 {
                     debugl(3, "edge (n, c) is basal dendrite segment => adding..\n");
 
@@ -6278,11 +6334,11 @@ readFromNeuroMorphoSWCFile(
                  * should never be found here. for file types containing synapses, this is not necessarily true.
                  * following the general scheme: enqueue child only if it has not been traversed yet. issue warning: */
                 if (!node_traversed[child_id]) {
-                    debugl(3, "current neighbour c = %2d of n = %2d. enqueueing c.. \n", c.compartment_id, n.compartment_id);
+                    debugl(3, "current neighbour c = %2d of n = %2d. enqueueing c.. \n", child_id, n_id);
 
-                    /* enqueue pair (c.compartment_id, "up"-converted neuron_iterator) in Q. the iterator to be used
+                    /* enqueue pair (child_id, "up"-converted neuron_iterator) in Q. the iterator to be used
                      * depends on the compartment type of c, as above when n was "down"-converted */
-                    switch (c.compartment_type) {
+                    switch (c_type) {
                         case SOMA_COMPARTMENT:
                             Q.push_back( { child_id, c_sit } );
                             break;
@@ -6327,8 +6383,8 @@ readFromNeuroMorphoSWCFile(
         };
 
     /* check if all nodes of supported compartment type have been traversed. */
-    for (uint32_t i = 0; i < swc_nodes.size(); i++) {
-        if (listContains<uint32_t>(supported_compartment_types, swc_nodes[i].compartment_type)) {
+    for (uint32_t i = 0; i < swc.size(); i++) {
+        if (listContains<uint32_t>(supported_compartment_types, swc.compartment_type[i])) {
             if (node_traversed[i] == false) {
                 throw("CellNetwork::readFromNeuroMorphoSWCFile(): discovered un-traversed ndoe with supported "\
                     " compartment type after CellNetwork construction.\n");
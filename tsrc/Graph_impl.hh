@@ -70,7 +70,7 @@ Graph<Tg, Tv, Te>::resetTraversalStates()
 }
 
 template <typename Tg, typename Tv, typename Te>
-std::pair<typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::VertexPointerType>::iterator, bool>
+std::pair<typename IdSlotMap<typename Graph<Tg, Tv, Te>::VertexPointerType>::iterator, bool>
 Graph<Tg, Tv, Te>::protectedVertexInsert(Vertex *v)
 {
     debugl(3, "Graph::protectedVertexInsert()\n");
@@ -87,7 +87,7 @@ Graph<Tg, Tv, Te>::protectedVertexInsert(Vertex *v)
     v->blocked              = false;
 
     /* insert vertex just as in VertexAccessor::insert().. */
-    std::pair<typename std::map<uint32_t, VertexPointerType >::iterator, bool> pair, ret;
+    std::pair<typename IdSlotMap<VertexPointerType>::iterator, bool> pair, ret;
 
     /* get fresh id for new vertex, allocate new vertex, insert pair (id, vertex) into map */
     uint32_t v_id   = this->V_idq.getId();
@@ -113,7 +113,7 @@ Graph<Tg, Tv, Te>::protectedVertexInsert(Vertex *v)
 }
 
 template <typename Tg, typename Tv, typename Te>
-std::pair<typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::EdgePointerType>::iterator, bool>
+std::pair<typename IdSlotMap<typename Graph<Tg, Tv, Te>::EdgePointerType>::iterator, bool>
 Graph<Tg, Tv, Te>::protectedEdgeInsert(
     Edge       *e,
     uint32_t    v_src_id,
@@ -132,7 +132,7 @@ Graph<Tg, Tv, Te>::protectedEdgeInsert(
         /* compare pointers */
         if ( v_src_it == e->getSourceVertex() && v_dst_it == e->getDestinationVertex() ) {
             /* pointers match, check if edge already exists via iterators */
-            std::pair<typename std::map<uint32_t, EdgePointerType >::iterator, bool> ret;
+            std::pair<typename IdSlotMap<EdgePointerType>::iterator, bool> ret;
 
             if (this->edges.exists(v_src_it, v_dst_it)) {
                 ret.first = this->E.end();
@@ -155,8 +155,8 @@ Graph<Tg, Tv, Te>::protectedEdgeInsert(
 
                 /* topology information update */
                 bool all_inserted = 
-                    Aux::Alg::listSortedInsert(v_src_it->out_edges, e, false) &&
-                    Aux::Alg::listSortedInsert(v_dst_it->in_edges, e, false);
+                    Graph::incidenceInsert(v_src_it->out_edges, e) &&
+                    Graph::incidenceInsert(v_dst_it->in_edges, e);
 
                 if (all_inserted) {
                     ret.first   = e->g_eit;
@@ -184,30 +184,70 @@ Graph<Tg, Tv, Te>::protectedEdgeInsert(
     }
 }
 
+/* sorted insertion of e into incidence list l by edge id. returns false if an edge with the same id is already
+ * contained, as Aux::Alg::listSortedInsert() without duplicates. */
+template <typename Tg, typename Tv, typename Te>
+bool
+Graph<Tg, Tv, Te>::incidenceInsert(
+    IncidenceList  &l,
+    Edge           *e)
+{
+    auto lit = std::lower_bound(l.begin(), l.end(), e,
+        [] (Edge const *x, Edge const *y) -> bool
+        {
+            return (x->id() < y->id());
+        });
+
+    if (lit != l.end() && (*lit)->id() == e->id()) {
+        return false;
+    }
+    else {
+        l.insert(lit, e);
+        return true;
+    }
+}
+
+/* remove first occurrence of e from incidence list l, returns false if e is not contained */
+template <typename Tg, typename Tv, typename Te>
+bool
+Graph<Tg, Tv, Te>::incidenceRemove(
+    IncidenceList  &l,
+    Edge           *e)
+{
+    auto lit = std::find(l.begin(), l.end(), e);
+    if (lit != l.end()) {
+        l.erase(lit);
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
 /* protected (static) methods to extract internal iterators from Graph::{vertex,edge}_iterators */
 template <typename Tg, typename Tv, typename Te>
-typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::VertexPointerType>::const_iterator
+typename IdSlotMap<typename Graph<Tg, Tv, Te>::VertexPointerType>::const_iterator
 Graph<Tg, Tv, Te>::getInternalIterator(vertex_const_iterator const &it)
 {
     return it.int_it;
 }
 
 template <typename Tg, typename Tv, typename Te>
-typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::VertexPointerType>::iterator
+typename IdSlotMap<typename Graph<Tg, Tv, Te>::VertexPointerType>::iterator
 Graph<Tg, Tv, Te>::getInternalIterator(vertex_iterator const &it)
 {
     return it.int_it;
 }
 
 template <typename Tg, typename Tv, typename Te>
-typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::EdgePointerType>::const_iterator
+typename IdSlotMap<typename Graph<Tg, Tv, Te>::EdgePointerType>::const_iterator
 Graph<Tg, Tv, Te>::getInternalIterator(edge_const_iterator const &it)
 {
     return it.int_it;
 }
 
 template <typename Tg, typename Tv, typename Te>
-typename std::map<uint32_t, typename Graph<Tg, Tv, Te>::EdgePointerType>::iterator
+typename IdSlotMap<typename Graph<Tg, Tv, Te>::EdgePointerType>::iterator
 Graph<Tg, Tv, Te>::getInternalIterator(edge_iterator const &it)
 {
     return it.int_it;
@@ -317,7 +357,7 @@ Graph<Tg, Tv, Te>::Vertex::replaceAdjacentVertices(const std::map<Vertex *, Vert
 
 template <typename Tg, typename Tv, typename Te>
 typename Graph<Tg, Tv, Te>::Vertex *
-Graph<Tg, Tv, Te>::Vertex::getPtr(typename std::map<uint32_t, VertexPointerType >::const_iterator const &it)
+Graph<Tg, Tv, Te>::Vertex::getPtr(typename IdSlotMap<VertexPointerType>::const_iterator const &it)
 {
     return (it->second);
 }
@@ -577,7 +617,7 @@ Graph<Tg, Tv, Te>::Edge::~Edge()
 
 template <typename Tg, typename Tv, typename Te>
 typename Graph<Tg, Tv, Te>::Edge *
-Graph<Tg, Tv, Te>::Edge::getPtr(typename std::map<uint32_t, EdgePointerType >::const_iterator const &it)
+Graph<Tg, Tv, Te>::Edge::getPtr(typename IdSlotMap<EdgePointerType>::const_iterator const &it)
 {
     return (it->second);
 }
@@ -830,7 +870,7 @@ Graph<Tg, Tv, Te>::operator=(const Graph<Tg, Tv, Te>&X)
 
     /* deep copy */
     Vertex *v_new;
-    typename std::map<uint32_t, VertexPointerType >::iterator vit;
+    typename IdSlotMap<VertexPointerType>::iterator vit;
     for (vit = this->V.begin(); vit != this->V.end(); ++vit) {
         /* make a copy of the Vertex object currently pointed to by vit, which is a Vertex object
          * allocated by X, with the private copy ctor of Vertex */
@@ -969,8 +1009,8 @@ Graph<Tg, Tv, Te>::renumberConsecutively(
      * entire graph back to a consistent state.
      *
      * in general, all iterators are invalidated by this method */
-    std::map<uint32_t, VertexPointerType >    vertices_swap; 
-    std::map<uint32_t, EdgePointerType >      edges_swap;
+    IdSlotMap<VertexPointerType>    vertices_swap; 
+    IdSlotMap<EdgePointerType>      edges_swap;
     
     /* swap vertices and edges with vertices_swap / edges_swap in-place */
     this->V.swap(vertices_swap);
@@ -982,7 +1022,7 @@ Graph<Tg, Tv, Te>::renumberConsecutively(
 
     /* iterate through swap arrays and insert Vertex and Edge shared pointers into now empty 
      * maps this->V and this->E with correct ids */
-    typename std::map<uint32_t, VertexPointerType >::iterator vit;
+    typename IdSlotMap<VertexPointerType>::iterator vit;
     Vertex *v;
     for (uint32_t current_vertex_id = vertex_start_id; !vertices_swap.empty(); current_vertex_id++) {
         vit         = vertices_swap.begin();
@@ -1009,7 +1049,7 @@ Graph<Tg, Tv, Te>::renumberConsecutively(
     }
 
     /* same for all edges */
-    typename std::map<uint32_t, EdgePointerType >::iterator eit;
+    typename IdSlotMap<EdgePointerType>::iterator eit;
     Edge *e;
 
     for (uint32_t current_edge_id = edge_start_id; !edges_swap.empty(); current_edge_id++) {
@@ -1108,16 +1148,10 @@ Graph<Tg, Tv, Te>::moveAppend(
 
     uint32_t                            new_id;
     Vertex                             *v;
-    typename std::map<
-            uint32_t,
-            VertexPointerType
-        >::iterator                     v_newit;
+    typename IdSlotMap<VertexPointerType>::iterator                     v_newit;
 
     Edge                               *e;
-    typename std::map<
-            uint32_t,
-            EdgePointerType
-        >::iterator                     e_newit;
+    typename IdSlotMap<EdgePointerType>::iterator                     e_newit;
     bool                                inserted;
         
     /* if update_vits != NULL, generate the list of vertex pointers from the given iterators.
@@ -1453,7 +1487,7 @@ Graph<Tg, Tv, Te>::VertexAccessor::insert(Tv const &data)
     debugl(3, "Graph::VertexAccessor::insert().\n");
     debugTabInc();
 
-    std::pair<typename std::map<uint32_t, VertexPointerType >::iterator, bool> pair;
+    std::pair<typename IdSlotMap<VertexPointerType>::iterator, bool> pair;
 
     /* get fresh id for new vertex, allocate new vertex, insert pair (id, vertex) into map */
     uint32_t v_id   = this->graph.V_idq.getId();
@@ -1722,8 +1756,8 @@ Graph<Tg, Tv, Te>::EdgeAccessor::insert(
 
         /* topology information update */
         bool all_inserted = 
-            Aux::Alg::listSortedInsert(v_src_it->out_edges, e, false) &&
-            Aux::Alg::listSortedInsert(v_dst_it->in_edges, e, false);
+            Graph::incidenceInsert(v_src_it->out_edges, e) &&
+            Graph::incidenceInsert(v_dst_it->in_edges, e);
 
         if (all_inserted) {
             ret.first   = e->iterator();
@@ -1786,16 +1820,16 @@ Graph<Tg, Tv, Te>::EdgeAccessor::erase(edge_iterator it)
 
     /* remove edge from {out, in}-edge lists of {src, dst} vertex */
     bool all_erased = 
-        Aux::Alg::removeFirstOccurrenceFromList(e->v_src->out_edges, e) &&
-        Aux::Alg::removeFirstOccurrenceFromList(e->v_dst->in_edges, e);
+        Graph::incidenceRemove(e->v_src->out_edges, e) &&
+        Graph::incidenceRemove(e->v_dst->in_edges, e);
 
     if (!all_erased) {
         throw GraphEx(GRAPH_LOGIC_ERROR, "Graph::EdgeAccessor::erase(): source or destination vertex does not contain given edge in its incidence lists. invalid input iterator?");
     }
 
     if (
-        Aux::Alg::listContains(e->v_src->out_edges, e) ||
-        Aux::Alg::listContains(e->v_dst->in_edges, e)
+        std::find(e->v_src->out_edges.begin(), e->v_src->out_edges.end(), e) != e->v_src->out_edges.end() ||
+        std::find(e->v_dst->in_edges.begin(), e->v_dst->in_edges.end(), e) != e->v_dst->in_edges.end()
        )
     {
         throw GraphEx(GRAPH_LOGIC_ERROR, "Graph::EdgeAccessor::erase(): {src,dst} vertex {out,in} edge lists still contains edge to be deleted after removing first occurrence => edge has been in list multiple times. internal logic error.");
@@ -1902,8 +1936,8 @@ Graph<Tg, Tv, Te>::EdgeAccessor::collapse(edge_iterator it)
 
     /* sort edges of u */
     auto sort_fct = [] (const Edge* x, const Edge* y) -> bool {return (x->id() < y->id());};
-    u_it->in_edges.sort(sort_fct);
-    u_it->out_edges.sort(sort_fct);
+    std::sort(u_it->in_edges.begin(), u_it->in_edges.end(), sort_fct);
+    std::sort(u_it->out_edges.begin(), u_it->out_edges.end(), sort_fct);
 
     debugl(1, "neighbours of collapsed vertex: \n");
     debugTabInc();
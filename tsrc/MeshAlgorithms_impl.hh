@@ -363,6 +363,18 @@ MeshAlg::appendHalfSphereToCanalSurfaceMesh(
 /*    Computation of potentially intersecting edge / face pairs with implicit Octree traversal    */
 /*                                                                                                */
 /* ---------------------------------------------------------------------------------------------- */
+/* forward declaration of static function used in MeshAlg::getPotentiallyIntersectingEdgeFacePairs */
+template <typename Tm, typename Tv, typename Tf, typename R>
+inline void
+EFP_getEdgeFacePairsFromEdgeIndex(
+    std::vector<
+            std::pair<
+                typename Mesh<Tm, Tv, Tf, R>::Face *,
+                typename Mesh<Tm, Tv, Tf, R>::Face *
+            >
+        > const                                                &XY_face_pairs,
+    std::vector<MeshAlg::EdgeFacePair<Mesh<Tm, Tv, Tf, R> > >  &X_edges_Y_faces_candidates);
+
 template <typename Tm, typename Tv, typename Tf, typename R>
 void 
 MeshAlg::getPotentiallyIntersectingEdgeFacePairs(
@@ -435,6 +447,21 @@ MeshAlg::getPotentiallyIntersectingEdgeFacePairs(
 
     debugl(2, "returned candidate pairs: %d\n", candidate_pairs.size());
 
+    /* if both meshes maintain an edge index, read the (edge, face) pairs off the edges directly */
+    if (X.hasEdgeIndex() && Y.hasEdgeIndex()) {
+        EFP_getEdgeFacePairsFromEdgeIndex<Tm, Tv, Tf, R>(candidate_pairs, X_edges_Y_faces_candidates);
+
+        for (auto &pair : candidate_pairs) {
+            std::swap(pair.first, pair.second);
+        }
+        std::sort(candidate_pairs.begin(), candidate_pairs.end(), face_ptr_pair_cmp);
+        EFP_getEdgeFacePairsFromEdgeIndex<Tm, Tv, Tf, R>(candidate_pairs, Y_edges_X_faces_candidates);
+
+        debugTabDec();
+        debugl(2, "Mesh::getPotentialEdgeFacePairs(): time: %5.4f\n", tack(12));
+        return;
+    }
+
     /* compute result from all pairs of potentially intersecting faces from X and Y */
     typename Mesh<Tm, Tv, Tf, R>::Face     *X_face, *Y_face;
     typename Mesh<Tm, Tv, Tf, R>::Vertex   *e_u, *e_v;
@@ -493,6 +520,98 @@ MeshAlg::getPotentiallyIntersectingEdgeFacePairs(
 }
 
 
+/* for a list of face pairs (X face, Y face), sorted by X face ids and then by Y face ids without
+ * duplicates, generate the list of pairs (X edge, Y face) in the order established by
+ * EdgeFacePair::operator<(). the edges of the involved X faces are taken from X's edge index, so
+ * that every edge is handled once and its Y faces are obtained by merging the already sorted Y
+ * face runs of its incident X faces. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+inline void
+EFP_getEdgeFacePairsFromEdgeIndex(
+    std::vector<
+            std::pair<
+                typename Mesh<Tm, Tv, Tf, R>::Face *,
+                typename Mesh<Tm, Tv, Tf, R>::Face *
+            >
+        > const                                                &XY_face_pairs,
+    std::vector<MeshAlg::EdgeFacePair<Mesh<Tm, Tv, Tf, R> > >  &X_edges_Y_faces_candidates)
+{
+    typedef typename Mesh<Tm, Tv, Tf, R>::Face      FaceType;
+    typedef typename Mesh<Tm, Tv, Tf, R>::Edge      EdgeType;
+    typedef typename Mesh<Tm, Tv, Tf, R>::Vertex    VertexType;
+
+    auto face_id_less =
+        [] (const FaceType *x, const FaceType *y) -> bool
+        {
+            return (x->id() < y->id());
+        };
+
+    /* get the run of Y faces for a given X face via binary search */
+    auto get_run =
+        [&XY_face_pairs] (const FaceType *x, size_t &begin, size_t &end) -> void
+        {
+            auto range = std::equal_range(XY_face_pairs.begin(), XY_face_pairs.end(), std::make_pair(const_cast<FaceType *>(x), (FaceType *)NULL),
+                [] (const std::pair<FaceType *, FaceType *> &p, const std::pair<FaceType *, FaceType *> &q) -> bool
+                {
+                    return (p.first->id() < q.first->id());
+                });
+            begin   = range.first - XY_face_pairs.begin();
+            end     = range.second - XY_face_pairs.begin();
+        };
+
+    /* collect the edges of all X faces appearing in the list and sort them by vertex ids as
+     * EdgeFacePair::operator<() does. edges shared by two such faces appear twice => unique() */
+    typedef std::pair<std::pair<uint32_t, uint32_t>, EdgeType *>    EdgeKeyType;
+
+    std::vector<EdgeKeyType>    X_edges;
+    std::vector<EdgeType *>     f_edges;
+    uint32_t                    u_id, v_id;
+
+    for (size_t i = 0; i < XY_face_pairs.size(); i++) {
+        if (i == 0 || XY_face_pairs[i].first != XY_face_pairs[i - 1].first) {
+            XY_face_pairs[i].first->getEdges(f_edges);
+            for (auto e : f_edges) {
+                e->getIndices(u_id, v_id);
+                X_edges.push_back({ {u_id, v_id}, e });
+            }
+        }
+    }
+    std::sort(X_edges.begin(), X_edges.end(),
+        [] (const EdgeKeyType &x, const EdgeKeyType &y) -> bool { return (x.first < y.first); });
+    X_edges.erase(
+        std::unique(X_edges.begin(), X_edges.end(),
+            [] (const EdgeKeyType &x, const EdgeKeyType &y) -> bool { return (x.second == y.second); }),
+        X_edges.end());
+
+    /* for each edge, merge the Y face runs of all its incident X faces */
+    std::vector<FaceType *>     e_X_faces, e_Y_faces;
+    VertexType                 *u, *v;
+    size_t                      begin, end, mid;
+
+    X_edges_Y_faces_candidates.clear();
+    for (auto &ek : X_edges) {
+        EdgeType *e = ek.second;
+        e->getVertices(u, v);
+        e->getFaces(e_X_faces);
+
+        e_Y_faces.clear();
+        for (auto x : e_X_faces) {
+            get_run(x, begin, end);
+            mid = e_Y_faces.size();
+            for (size_t i = begin; i < end; i++) {
+                e_Y_faces.push_back(XY_face_pairs[i].second);
+            }
+            std::inplace_merge(e_Y_faces.begin(), e_Y_faces.begin() + mid, e_Y_faces.end(), face_id_less);
+        }
+        e_Y_faces.erase(std::unique(e_Y_faces.begin(), e_Y_faces.end()), e_Y_faces.end());
+
+        for (auto y : e_Y_faces) {
+            X_edges_Y_faces_candidates.push_back(MeshAlg::EdgeFacePair<Mesh<Tm, Tv, Tf, R> >(u, v, y));
+        }
+    }
+}
+
+
 /* ---------------------------------------------------------------------------------------------- */
 /*                                                                                                */
 /*                                Red-Blue-Union algorithm                                        */
@@ -649,7 +768,10 @@ MeshAlg::RedBlueAlgorithm(
     Aux::Timing::tick(15);
     debugl(1, "RedBlueAlgorithm(): getting pairs of potentially intersecting edges / faces.\n");
 
-    MeshAlg::getPotentiallyIntersectingEdgeFacePairs(R, B, R_edges_B_faces_candidates, B_edges_R_faces_candidates, 32, 8);
+    {
+        Profiler::Scope prof_pairs("candidate_pairs");
+        MeshAlg::getPotentiallyIntersectingEdgeFacePairs(R, B, R_edges_B_faces_candidates, B_edges_R_faces_candidates, 32, 8);
+    }
 
     debugl(1, "RedBlueAlgorithm(): done getting pairs of potentially intersecting edges / faces. time: %5.4f\n\n", Aux::Timing::tack(15));
 
@@ -2013,9 +2135,10 @@ RedBlue_cutHole(
 template <typename Tm, typename Tv, typename Tf, typename R>
 inline R
 GEC_getAvgAreaOfPermissibleSurroundingTriangles(
-    typename Mesh<Tm, Tv, Tf, R>::face_iterator     tri_it,
+    typename Mesh<Tm, Tv, Tf, R>::Face             *tri,
     R const                                        &max_ar,
-    uint32_t                                        depth);
+    uint32_t                                        depth,
+    typename Mesh<Tm, Tv, Tf, R>::TraversalStates  &states);
 
 /* greedy edge collapsing of shortest edge of triangles sorted by aspect ratio.  additionally,
  * before reinserting affected triangles, check if their size is within the average of the
@@ -2026,11 +2149,12 @@ GEC_getAvgAreaOfPermissibleSurroundingTriangles(
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
 MeshAlg::greedyEdgeCollapsePostProcessing(
-    Mesh<Tm, Tv, Tf, R>    &M,
-    R const                &alpha,
-    R const                &lambda,
-    R const                &mu,
-    uint32_t                d)
+    Mesh<Tm, Tv, Tf, R>        &M,
+    R const                    &alpha,
+    R const                    &lambda,
+    R const                    &mu,
+    uint32_t                    d,
+    std::vector<bool> const    *locked)
 {
     using namespace Aux::Timing;
     using Aux::Numbers::inf;
@@ -2041,6 +2165,11 @@ MeshAlg::greedyEdgeCollapsePostProcessing(
     /* triangulate quads, if there are any.. */
     M.triangulateQuads();
 
+    /* every collapse candidate below issues edge queries: maintain an edge index on M for the
+     * duration of the post-processing, unless the caller keeps one anyway. */
+    const bool M_had_edge_index = M.hasEdgeIndex();
+    M.enableEdgeIndex();
+
     tick(15);
 
     PriorityQueue<R, uint32_t>                  Q;
@@ -2062,16 +2191,46 @@ MeshAlg::greedyEdgeCollapsePostProcessing(
     debugl(2, "searching for \"poor\" triangles / computing average neighbourhood triangle areas. this may take some time..\n");
 
     /* define processing predicate for convenience */
+    auto is_locked = [locked] (uint32_t id) -> bool
+        {
+            return (locked && id < locked->size() && (*locked)[id]);
+        };
     #define proc(ar, area, avg_nbhd_area, alpha, lambda, mu) (area < mu * avg_nbhd_area && (ar >= alpha || area < lambda * avg_nbhd_area) )
 
+    /* get every triangle's aspect ratio, area and average over permissible triangles in its
+     * d-neighbourhood. M is not modified here, so this is done in parallel, each chunk with
+     * traversal states of its own. */
+    std::vector<typename Mesh<Tm, Tv, Tf, R>::Face *>   tris;
+    tris.reserve(M.numFaces());
+    for (auto &tri : M.faces) {
+        tris.push_back(&tri);
+    }
+
+    std::vector<R>  tris_ar(tris.size()), tris_area(tris.size()), tris_avg_surrounding_area(tris.size());
+#ifdef __DEBUG__
+    /* debug output is not thread-safe */
+    const uint32_t  nchunks = 1;
+#else
+    const uint32_t  nchunks = Aux::Alg::parallelChunks(tris.size(), 1u << 12);
+#endif
+    Aux::Alg::parallelFor(tris.size(), nchunks,
+        [&] (size_t begin, size_t end, uint32_t chunk) -> void
+        {
+            typename Mesh<Tm, Tv, Tf, R>::TraversalStates states(M);
+            for (size_t i = begin; i < end; i++) {
+                tris_ar[i]                      = tris[i]->getTriAspectRatio();
+                tris_area[i]                    = tris[i]->getTriArea();
+                tris_avg_surrounding_area[i]    = GEC_getAvgAreaOfPermissibleSurroundingTriangles<Tm, Tv, Tf>(tris[i], alpha, d, states);
+            }
+        });
+
     /* insert all "poor" triangles into Q, i.e. fill Q with the triangles that need processing */
     debugTabInc();
-    for (auto &tri : M.faces) {
-        /* get triangle's aspect ratio, area and average over permissible triangles in the
-         * d-neighbourhood of currently processed triangle */
-        tri_ar                      = tri.getTriAspectRatio();
-        tri_area                    = tri.getTriArea();
-        tri_avg_surrounding_area    = GEC_getAvgAreaOfPermissibleSurroundingTriangles<Tm, Tv, Tf>(tri.iterator(), alpha, d);
+    for (size_t i = 0; i < tris.size(); i++) {
+        auto &tri                   = *tris[i];
+        tri_ar                      = tris_ar[i];
+        tri_area                    = tris_area[i];
+        tri_avg_surrounding_area    = tris_avg_surrounding_area[i];
         avg_surrounding_area.insert( {tri.id(), tri_avg_surrounding_area} );
 
         debugl(4, "face %6d, ar: %10.5f, area: %10.5f, avg area in d-neighbourhood: %10.5f, d = %3d..\n", tri.id(), tri_ar, tri_area, tri_avg_surrounding_area, d);
@@ -2139,6 +2298,10 @@ MeshAlg::greedyEdgeCollapsePostProcessing(
 
                     /* get shortest edge e = {u, v} and the other face T' incident to the shortest edge {u, v} */
                     tri_it->getTriShortestEdge(u_it, v_it);
+                    if (is_locked(u_it->id()) || is_locked(v_it->id())) {
+                        debugl(3, "shortest edge is incident to locked vertex => skipping triangle %d.\n", tri_id);
+                        continue;
+                    }
                     uv_other_face_it = M.getOtherFaceIncidentToManifoldEdge(u_it, v_it, tri_it);
 
                     /* collapse if topologically safe. if not, push triangle onto unsafe_tris list and refetch from
@@ -2275,6 +2438,10 @@ MeshAlg::greedyEdgeCollapsePostProcessing(
     }
     debugl(3, "fixed point reached. returning...\n");
 
+    if (!M_had_edge_index) {
+        M.disableEdgeIndex();
+    }
+
     debugTabDec();
     debugl(1, "MeshAlg::greedyEdgeCollapsePostProcessing(): done.\n");
 }
@@ -2283,9 +2450,10 @@ MeshAlg::greedyEdgeCollapsePostProcessing(
 template <typename Tm, typename Tv, typename Tf, typename R>
 inline R
 GEC_getAvgAreaOfPermissibleSurroundingTriangles(
-    typename Mesh<Tm, Tv, Tf, R>::face_iterator     tri_it,
+    typename Mesh<Tm, Tv, Tf, R>::Face             *tri,
     R const                                        &max_ar,
-    uint32_t                                        depth)
+    uint32_t                                        depth,
+    typename Mesh<Tm, Tv, Tf, R>::TraversalStates  &states)
 {
     debugl(4, "GEC_getAvgAreaOfPermissibleSurroundingTriangles()\n");
     debugTabInc();
@@ -2293,12 +2461,12 @@ GEC_getAvgAreaOfPermissibleSurroundingTriangles(
     R           nbtri_ar, nbtri_area, avg_area;
     uint32_t    npermissible_triangles;
 
-    /* get face-neighbourhood of depth "depth" for triangle tri_it */
+    /* get face-neighbourhood of depth "depth" for triangle tri */
     std::vector<typename Mesh<Tm, Tv, Tf, R>::Face *> surrounding_tris;
-    tri_it->getFaceNeighbourhood(depth, surrounding_tris);
+    tri->getFaceNeighbourhood(depth, surrounding_tris, states);
 
     /* get average area of all permissible triangles in the depth-neighbourhood of the face
-     * tri_it */
+     * tri */
     avg_area                = 0.0;
     npermissible_triangles  = 0;
     for (auto &nbtri : surrounding_tris) {
@@ -2314,10 +2482,10 @@ GEC_getAvgAreaOfPermissibleSurroundingTriangles(
 
     if (npermissible_triangles == 0) {
         debugl(1, "MeshAlg::GEC_getAvgAreaOfPermissibleSurroundingTriangles(): WARNING: triangle %d: can't compute average, since no %5.4f-permissible triangle found in the %d-neighbour of %d. returning area %5.4f as \"average\"\n.",
-            tri_it->id(), max_ar, depth, tri_it->id(), tri_it->getTriArea());
+            tri->id(), max_ar, depth, tri->id(), tri->getTriArea());
 
         debugTabDec();
-        return (tri_it->getTriArea());
+        return (tri->getTriArea());
     }
     else {
         debugTabDec();
@@ -2379,7 +2547,7 @@ MeshAlg::simpleLaplacianSmoothing(
 
         /* displace all vertices with corresponding offsets */
         for (v_it = M.vertices.begin(), oit = offsets.begin(); v_it != M.vertices.end(); ++v_it, ++oit) {
-            v_it->pos() += oit->second;
+            v_it->setPos(v_it->pos() + oit->second);
         }
     }
 }
@@ -2387,10 +2555,11 @@ MeshAlg::simpleLaplacianSmoothing(
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
 MeshAlg::HCLaplacianSmoothing(
-    Mesh<Tm, Tv, Tf, R>    &M,
-    R const                &alpha,
-    R const                &beta,
-    uint32_t                maxiter)
+    Mesh<Tm, Tv, Tf, R>        &M,
+    R const                    &alpha,
+    R const                    &beta,
+    uint32_t                    maxiter,
+    std::vector<bool> const    *locked)
 {
     uint32_t                                iter, m;
 
@@ -2432,8 +2601,16 @@ MeshAlg::HCLaplacianSmoothing(
         i = 0;
         for (auto &vi : M.vertices)
         {
+            /* locked vertices stay where they are and don't push back their neighbours */
+            if (locked && vi.id() < locked->size() && (*locked)[vi.id()]) {
+                p[i] = vi.pos();
+                b[i] = Aux::VecMat::nullvec<R>();
+                ++i;
+                continue;
+            }
+
             /* get vertex id, vertex star and vertex star size */
-            const std::list<typename Mesh<Tm, Tv, Tf, R>::Vertex *>& vi_nbs = vi.getVertexStar();
+            const typename Mesh<Tm, Tv, Tf, R>::VertexList& vi_nbs = vi.getVertexStar();
             m = vi_nbs.size();
              
             /* throw exception here? isolated vertex .. */
@@ -2465,7 +2642,7 @@ MeshAlg::HCLaplacianSmoothing(
             m = vi_nbs_ids.size();
 
             /* throw exception here? isolated vertex .. */
-            if (m > 0) {
+            if (m > 0 && !(locked && vi.id() < locked->size() && (*locked)[vi.id()])) {
                 p_i_correction  = b[i] * beta;
                 nbfactor        = (1.0 - beta) / (R)m;
 
@@ -2473,7 +2650,7 @@ MeshAlg::HCLaplacianSmoothing(
                     p_i_correction += (b[indexMap[w_id]] * nbfactor);
                 }
 
-                vi.pos() = p[i] - p_i_correction;
+                vi.setPos(p[i] - p_i_correction);
             }
 
             ++i;
@@ -2505,7 +2682,8 @@ MeshAlg::partialFlushToObjFile(
                 uint32_t          
             >
         >                                                      &out_boundary_vertices,
-    uint32_t                                                   &out_last_flush_vertex_id)
+    uint32_t                                                   &out_last_flush_vertex_id,
+    MeshPageStore<R>                                           *page_store)
 {
     debugl(1, "MeshAlg::partialFlush().\n");
     debugTabInc();
@@ -2682,171 +2860,228 @@ MeshAlg::partialFlushToObjFile(
     }
     debugTabDec();
 
-    /* write new isolated vertices (with correct id) and all NEW boundary vertices to obj file. as part of the
-     * invariant, all old boundary vertices had already been written to the obj file when the call started. */
-
-    /* since vertices should be the first block and the face definition block (which use vertex indices) should be
-     * below, it is necessary to insert new vertex definition lines in the middle of obj_file, an operation that is
-     * generally unsupported by most file systems. instead, "merge" the file and the new information into a temporary
-     * file, rename to correct filename and adjust the file descriptor. 
-     *
-     * first, scan obj_file for the vertex block delimiter "# ____~V____". as long as it is not found, copy lines to
-     * swap file. after delimiter has been found, insert new vertex lines into swap file, followed by the rest of
-     * obj_file and finally the new faces. */
-    debugl(1, "writing new partial mesh to swap file..\n");
-
-    /* get "original" obj file */
-    FILE               *obj_file    = *(obj_file_info.first);
-
-    /* open swap file */
-    std::string const &filename     = obj_file_info.second;
-    std::string swap_filename       = filename + "_swap";
-    FILE *swap_file                 = fopen( (swap_filename + ".obj").c_str(), "w");
-    const char v_delim[]            = "# ____~V____";
-    char line[1024];
-
-    if (!swap_file) {
-        debugTabDec();
-        throw("MeshAlg::partialFlush(): can't open swap file for writing.");
+    /* positions of all new vertices in flush id order */
+    std::vector<Vec3<R>> new_vertex_pos;
+    new_vertex_pos.reserve(new_isolated_vertices.size() + new_boundary_vertices.size());
+    for (auto &vp : new_isolated_vertices) {
+        new_vertex_pos.push_back(vp.first->pos());
+    }
+    for (auto &vp : new_boundary_vertices) {
+        new_vertex_pos.push_back(vp.first->pos());
     }
 
-    /* if orig file is empty, write new vertices / faces directly */
-    if (Aux::File::isEmpty(obj_file)) {
-        debugl(1, "given obj file empty..\n");
+    /* with a page store, the flushed faces are handed over to it along with the positions of their vertices. flush
+     * ids are used as global vertex ids of the store, which is therefore not to be shared. */
+    if (page_store) {
+        debugl(1, "adding flushed faces to page store..\n");
 
-        fprintf(swap_file, "# %5zu flushed vertices\n", new_isolated_vertices.size() + new_boundary_vertices.size());
-        Vec3<R> vpos;
-        for (auto &vp : new_isolated_vertices) {
-            vpos = vp.first->pos();
-            fprintf(swap_file, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
+        /* NOTE: in_last_flush_vertex_id may alias out_last_flush_vertex_id, which has been updated already */
+        uint32_t const first_new_id = last_flush_vertex_id - new_vertex_pos.size();
+        if (page_store->newVertexIds(new_vertex_pos.size()) != first_new_id) {
+            debugTabDec();
+            throw("MeshAlg::partialFlush(): vertex ids of page store out of sync with flush ids. internal logic error.");
         }
-        for (auto &vp : new_boundary_vertices) {
-            vpos = vp.first->pos();
-            fprintf(swap_file, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
+
+        std::map<uint32_t, Vec3<R>> old_boundary_pos;
+        for (auto &vp : in_boundary_vertices) {
+            old_boundary_pos[vp.second] = vp.first->pos();
         }
 
-        /* and write delimiter again */
-        fprintf(swap_file, "%s\n", v_delim);
+        std::vector<typename MeshPageStore<R>::FaceRecord> records;
+        records.reserve(flush_face_list.size());
+        for (auto &f : flush_face_list) {
+            typename MeshPageStore<R>::FaceRecord rec;
+            rec.v[3] = UINT32_MAX;
+            std::fill(rec.pos[3], rec.pos[3] + 3, (R)0);
 
-        debugl(1, "done writing new vertices and delimiter.\n");
+            for (uint32_t j = 0; j < f.v_ids.size(); j++) {
+                uint32_t    id = f.v_ids[j];
+                Vec3<R>     x  = (id >= first_new_id) ? new_vertex_pos[id - first_new_id] : old_boundary_pos[id];
+
+                rec.v[j] = id;
+                for (uint32_t k = 0; k < 3; k++) {
+                    rec.pos[j][k] = x[k];
+                }
+            }
+            records.push_back(rec);
+        }
+        page_store->addFaces(records.data(), records.size());
     }
-    /* otherwise assemble swap_file from new information and obj_file */
     else {
-        debugl(1, "given obj file non-empty.. \"merging\" together old and new information into swap_file..\n");
-        rewind(obj_file);
-        debugTabInc();
-        while ( fgets(line, sizeof(line), obj_file) == line) {
-            if (line[strlen(line) - 1] == '\n') {
-                /* overwrite newline with zero-termination */
-                line[strlen(line) - 1] = '\0';
-                debugl(2, "line from original file: \"%s\".\n", line);
-                if (strncmp(line, v_delim, sizeof(v_delim)) == 0) {
-                    debugl(3, "writing new vertices and delimiter.\n");
-
-                    /* delimiter found. write new vertices */
-                    fprintf(swap_file, "# %5zu flushed vertices\n", new_isolated_vertices.size() + new_boundary_vertices.size());
-                    Vec3<R> vpos;
-                    for (auto &vp : new_isolated_vertices) {
-                        vpos = vp.first->pos();
-                        fprintf(swap_file, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
+        /* write new isolated vertices (with correct id) and all NEW boundary vertices to obj file. as part of the
+         * invariant, all old boundary vertices had already been written to the obj file when the call started. */
+
+        /* since vertices should be the first block and the face definition block (which use vertex indices) should be
+         * below, it is necessary to insert new vertex definition lines in the middle of obj_file, an operation that is
+         * generally unsupported by most file systems. instead, "merge" the file and the new information into a temporary
+         * file, rename to correct filename and adjust the file descriptor. 
+         *
+         * first, scan obj_file for the vertex block delimiter "# ____~V____". as long as it is not found, copy lines to
+         * swap file. after delimiter has been found, insert new vertex lines into swap file, followed by the rest of
+         * obj_file and finally the new faces. */
+        debugl(1, "writing new partial mesh to swap file..\n");
+
+        /* get "original" obj file */
+        FILE               *obj_file    = *(obj_file_info.first);
+
+        /* open swap file */
+        std::string const &filename     = obj_file_info.second;
+        std::string swap_filename       = filename + "_swap";
+        FILE *swap_file                 = fopen( (swap_filename + ".obj").c_str(), "w");
+        const char v_delim[]            = "# ____~V____";
+
+        if (!swap_file) {
+            debugTabDec();
+            throw("MeshAlg::partialFlush(): can't open swap file for writing.");
+        }
+
+        /* write new vertices "v %+.10e %+.10e %+.10e" and the delimiter to swap_file, formatted in
+         * parallel */
+        bool write_ok = true;
+        auto write_new_vertices =
+            [&] () -> void
+            {
+                fprintf(swap_file, "# %5zu flushed vertices\n", new_vertex_pos.size());
+                write_ok = write_ok && Aux::Alg::parallelWrite(swap_file, new_vertex_pos.size(), 128,
+                    [&] (size_t i, char *out) -> size_t
+                    {
+                        char *s = out;
+                        *s++ = 'v';
+                        for (uint32_t j = 0; j < 3; j++) {
+                            *s++ = ' ';
+                            s   += Aux::Numbers::formatExp10(s, new_vertex_pos[i][j]);
+                        }
+                        *s++ = '\n';
+                        return s - out;
+                    });
+
+                /* and write delimiter again */
+                fprintf(swap_file, "%s\n", v_delim);
+            };
+
+        /* if orig file is empty, write new vertices / faces directly */
+        if (Aux::File::isEmpty(obj_file)) {
+            debugl(1, "given obj file empty..\n");
+            write_new_vertices();
+            debugl(1, "done writing new vertices and delimiter.\n");
+        }
+        /* otherwise assemble swap_file from new information and obj_file. everything up to the
+         * delimiter line is copied in large blocks, then the new vertices are inserted and the rest
+         * of obj_file is copied. */
+        else {
+            debugl(1, "given obj file non-empty.. \"merging\" together old and new information into swap_file..\n");
+            rewind(obj_file);
+
+            std::vector<char>   buf;
+            size_t const        block_size  = 1 << 22;
+            size_t              scan_pos    = 0;
+            size_t              nread;
+            bool                found       = false;
+
+            do {
+                size_t old_size = buf.size();
+                buf.resize(old_size + block_size);
+                nread = fread(buf.data() + old_size, 1, block_size, obj_file);
+                buf.resize(old_size + nread);
+
+                /* scan all complete lines that haven't been scanned yet. the delimiter is the whole
+                 * line. */
+                char const *data = buf.data();
+                char const *nl;
+                while (!found && (nl = (char const *)memchr(data + scan_pos, '\n', buf.size() - scan_pos))) {
+                    size_t line_len = nl - (data + scan_pos);
+                    if (line_len == sizeof(v_delim) - 1 && memcmp(data + scan_pos, v_delim, line_len) == 0) {
+                        debugl(3, "writing new vertices and delimiter.\n");
+
+                        /* delimiter found: copy everything before it, write new vertices + delimiter */
+                        write_ok = write_ok && (fwrite(data, 1, scan_pos, swap_file) == scan_pos);
+                        write_new_vertices();
+                        buf.erase(buf.begin(), buf.begin() + (nl + 1 - data));
+                        found = true;
+
+                        debugl(3, "done writing new vertices and delimiter.\n");
                     }
-                    for (auto &vp : new_boundary_vertices) {
-                        vpos = vp.first->pos();
-                        fprintf(swap_file, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
+                    else {
+                        scan_pos += line_len + 1;
                     }
+                }
 
-                    /* and write delimiter again */
-                    fprintf(swap_file, "%s\n", v_delim);
+                /* flush everything that can't contain the delimiter anymore */
+                size_t flush_len = found ? buf.size() : scan_pos;
+                write_ok    = write_ok && (fwrite(buf.data(), 1, flush_len, swap_file) == flush_len);
+                buf.erase(buf.begin(), buf.begin() + flush_len);
+                scan_pos   -= found ? scan_pos : flush_len;
+            } while (nread == block_size);
 
-                    debugl(3, "done writing new vertices and delimiter.\n");
-                }
-                /* copy line to swap_file */
-                else {
-                    fprintf(swap_file, "%s\n", line);
-                }
-            }
-            else {
-                debugTabDec(); debugTabDec();
-                throw("MeshAlg::partialFlush(): obj line longer than 1024 characters. please limit comments to reasonable line width.");
-            }
+            /* trailing characters without newline */
+            write_ok = write_ok && (fwrite(buf.data(), 1, buf.size(), swap_file) == buf.size());
         }
-        debugTabDec();
-    }
 
-    /* append all faces to swap file */
-    fprintf(swap_file, "# %5zu flushed faces.\n", flush_face_list.size());
-    for (auto &f : flush_face_list) {
-        if (f.quad) {
-            /*
-            fprintf(swap_file, "f %d//%d %d//%d %d//%d %d//%d\n",
-                    f.v_ids[0] + 1, 
-                    f.v_ids[0] + 1, 
-                    f.v_ids[1] + 1,
-                    f.v_ids[1] + 1,
-                    f.v_ids[2] + 1,
-                    f.v_ids[2] + 1,
-                    f.v_ids[3] + 1,
-                    f.v_ids[3] + 1);
-             */
-            fprintf(swap_file, "f %d %d %d %d\n",
-                    f.v_ids[0] + 1,
-                    f.v_ids[1] + 1,
-                    f.v_ids[2] + 1,
-                    f.v_ids[3] + 1);
+        /* append all faces to swap file */
+        fprintf(swap_file, "# %5zu flushed faces.\n", flush_face_list.size());
 
+        /* "f %d %d %d[ %d]", one-based */
+        std::vector<IdFace const *> flush_faces;
+        flush_faces.reserve(flush_face_list.size());
+        for (auto &f : flush_face_list) {
+            flush_faces.push_back(&f);
         }
-        else {
-            /*
-            fprintf(swap_file, "f %d//%d %d//%d %d//%d\n",
-                    f.v_ids[0] + 1, 
-                    f.v_ids[0] + 1, 
-                    f.v_ids[1] + 1,
-                    f.v_ids[1] + 1,
-                    f.v_ids[2] + 1,
-                    f.v_ids[2] + 1);
-            */
-            fprintf(swap_file, "f %d %d %d\n",
-                    f.v_ids[0] + 1,
-                    f.v_ids[1] + 1,
-                    f.v_ids[2] + 1 );
+        write_ok = write_ok && Aux::Alg::parallelWrite(swap_file, flush_faces.size(), 64,
+            [&] (size_t i, char *out) -> size_t
+            {
+                char *s = out;
+                *s++ = 'f';
+                for (auto id : flush_faces[i]->v_ids) {
+                    *s++ = ' ';
+                    s   += Aux::Numbers::formatUInt32(s, id + 1);
+                }
+                *s++ = '\n';
+                return s - out;
+            });
+
+        if (!write_ok || ferror(swap_file)) {
+            fclose(swap_file);
+            debugTabDec();
+            throw("MeshAlg::partialFlush(): error while writing swap file.");
         }
-    }
 
-    debugl(2, "flushing / synching / closing obj_file\n");
+        debugl(2, "flushing / synching / closing obj_file\n");
 
-    /* flush internal buffers, kernel buffers, close original file */
-    fflush(obj_file);
-    fsync(fileno(obj_file));
-    fclose(obj_file);
+        /* flush internal buffers, kernel buffers, close original file */
+        fflush(obj_file);
+        fsync(fileno(obj_file));
+        fclose(obj_file);
 
-    fflush(swap_file);
-    fsync(fileno(swap_file));
-    fclose(swap_file);
+        fflush(swap_file);
+        fsync(fileno(swap_file));
+        fclose(swap_file);
 
-    debugl(2, "removing original file, rename swap file to original file.\n");
+        debugl(2, "removing original file, rename swap file to original file.\n");
 
-    /* remove original file, rename swap_file to original file, adjust FILE * reference in file_info */
-    if ( remove( (filename + ".obj").c_str() ) != 0) {
-        debugTabDec();
-        throw("MeshAlg::partialFlush(): can't remove old obj file before overwriting with swap file.");
-    }
-    if (rename( (swap_filename + ".obj").c_str(), (filename + ".obj").c_str() ) != 0) {
-        debugTabDec();
-        throw("MeshAlg::partialFlush(): can't rename swap file to filename of obj file.");
-    }
+        /* remove original file, rename swap_file to original file, adjust FILE * reference in file_info */
+        if ( remove( (filename + ".obj").c_str() ) != 0) {
+            debugTabDec();
+            throw("MeshAlg::partialFlush(): can't remove old obj file before overwriting with swap file.");
+        }
+        if (rename( (swap_filename + ".obj").c_str(), (filename + ".obj").c_str() ) != 0) {
+            debugTabDec();
+            throw("MeshAlg::partialFlush(): can't rename swap file to filename of obj file.");
+        }
 
-    debugl(2, "assigning new FILE * to obj_file_info pair by reopening filename, which now contains moved swap file...\n");
-    /* update file pointer in obj_file_info: reopen new obj file (moved swap file) in append mode and rewind() */
-    FILE *tmp = fopen( (filename + ".obj").c_str(), "r+");
-    if (!tmp) {
-        debugTabDec();
-        throw("MeshAlg::partialFlush(): can't re-open obj file after having removed and overwritten old one with swap file.");
-    }
-    else {
-        rewind(tmp);
-        *(obj_file_info).first = tmp;
-    }
+        debugl(2, "assigning new FILE * to obj_file_info pair by reopening filename, which now contains moved swap file...\n");
+        /* update file pointer in obj_file_info: reopen new obj file (moved swap file) in append mode and rewind() */
+        FILE *tmp = fopen( (filename + ".obj").c_str(), "r+");
+        if (!tmp) {
+            debugTabDec();
+            throw("MeshAlg::partialFlush(): can't re-open obj file after having removed and overwritten old one with swap file.");
+        }
+        else {
+            rewind(tmp);
+            *(obj_file_info).first = tmp;
+        }
     
+    }
+
     debugl(2, "finishing invariants ..\n");
 
     /* write out_boundary_vertices for the caller: out_boundary_vertices is the union of new_boundary_vertices and all
@@ -2897,7 +3132,7 @@ MeshAlg::partialFlushToObjFile(
     std::list<typename Mesh<Tm, Tv, Tf, R>::Face *>            &face_list)
 {
     /* check if info has been prepared */
-    if (!M_flush_info.obj_file) {
+    if (!M_flush_info.obj_file && !M_flush_info.page_store) {
         throw("MeshAlg::partialFlushToObjFile(): given obj flush info struct not properly initialized. file handle is NULL.");
     }
 
@@ -2909,5 +3144,148 @@ MeshAlg::partialFlushToObjFile(
         M_flush_info.last_boundary_vertices,
         M_flush_info.last_flush_vertex_id,
         M_flush_info.last_boundary_vertices,
-        M_flush_info.last_flush_vertex_id);
+        M_flush_info.last_flush_vertex_id,
+        M_flush_info.page_store);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::collectFlushedMesh(
+    Mesh<Tm, Tv, Tf, R>                                        &M,
+    MeshObjFlushInfo<Tm, Tv, Tf, R>                            &M_flush_info,
+    Mesh<Tm, Tv, Tf, R>                                        &M_out)
+{
+    debugl(1, "MeshAlg::collectFlushedMesh().\n");
+    debugTabInc();
+
+    std::vector<R>          pos;
+    std::vector<uint32_t>   idx;
+
+    /* flushed part. vertex i of the obj file is the vertex with flush id i. */
+    if (M_flush_info.obj_file && !Aux::File::isEmpty(M_flush_info.obj_file)) {
+        fflush(M_flush_info.obj_file);
+        try {Mesh<Tm, Tv, Tf, R>::readObjArrays((M_flush_info.filename + ".obj").c_str(), pos, idx);}
+        catch (...) {debugTabDec(); throw;}
+    }
+    if (pos.size() / 3 != M_flush_info.last_flush_vertex_id) {
+        debugTabDec();
+        throw("MeshAlg::collectFlushedMesh(): number of vertices in obj file does not match flush info. internal logic error.");
+    }
+
+    /* remaining part. boundary vertices are in the obj file already and keep their flush ids, all other vertices get
+     * the next flush ids in id order, which is what a final partialFlushToObjFile() would assign. */
+    std::vector<uint32_t>   flush_id;
+    uint32_t                next_flush_id = M_flush_info.last_flush_vertex_id;
+
+    for (auto &vp : M_flush_info.last_boundary_vertices) {
+        if (vp.first->id() >= flush_id.size()) {
+            flush_id.resize(vp.first->id() + 1, UINT32_MAX);
+        }
+        flush_id[vp.first->id()] = vp.second;
+    }
+
+    pos.reserve(pos.size() + 3 * M.numVertices());
+    for (auto &v : M.vertices) {
+        if (v.id() >= flush_id.size()) {
+            flush_id.resize(v.id() + 1, UINT32_MAX);
+        }
+        if (flush_id[v.id()] == UINT32_MAX) {
+            Vec3<R> const &p = v.pos();
+
+            flush_id[v.id()] = next_flush_id++;
+            pos.insert(pos.end(), { p[0], p[1], p[2] });
+        }
+    }
+
+    idx.reserve(idx.size() + 4 * M.numFaces());
+    for (auto &f : M.faces) {
+        std::vector<uint32_t> f_ids = f.getIndices();
+        if (f_ids.size() != 3 && f_ids.size() != 4) {
+            debugTabDec();
+            throw("MeshAlg::collectFlushedMesh(): discovered face that is neither quad nor triangle.");
+        }
+        for (auto id : f_ids) {
+            idx.push_back(flush_id[id]);
+        }
+        if (f_ids.size() == 3) {
+            idx.push_back(UINT32_MAX);
+        }
+    }
+
+    try {M_out.buildFromArrays(pos.size() / 3, pos.data(), idx.size() / 4, idx.data(), NULL, NULL);}
+    catch (...) {debugTabDec(); throw;}
+
+    debugTabDec();
+    debugl(1, "MeshAlg::collectFlushedMesh(): done. numVertices(): %d, numFaces(): %d\n", M_out.numVertices(), M_out.numFaces());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+MeshAlg::outOfCorePostProcessing(
+    MeshPageStore<R>       &store,
+    bool                    gec,
+    R const                &gec_alpha,
+    R const                &gec_lambda,
+    R const                &gec_mu,
+    uint32_t                gec_d,
+    bool                    hc,
+    R const                &hc_alpha,
+    R const                &hc_beta,
+    uint32_t                hc_maxiter)
+{
+    debugl(1, "MeshAlg::outOfCorePostProcessing(): %lu faces.\n", (unsigned long)store.numFaces());
+    debugTabInc();
+
+    for (uint32_t stage = 0; stage < 2; stage++) {
+        if ((stage == 0 && !gec) || (stage == 1 && !hc)) {
+            continue;
+        }
+
+        /* per global vertex id: smoothed already. smoothing a vertex in both passes would smooth it twice as often
+         * as the rest of the mesh, so these are locked in the second pass. */
+        std::vector<bool> done;
+
+        for (uint32_t pass = 0; pass < 2; pass++) {
+            store.partition(pass == 1);
+            debugl(1, "stage %d, pass %d: %d pages.\n", stage, pass, store.numPages());
+
+            for (uint32_t p = 0; p < store.numPages(); p++) {
+                Mesh<Tm, Tv, Tf, R>     M;
+                std::vector<uint32_t>   vertex_gid;
+                std::vector<bool>       locked;
+
+                store.loadPage(p, M, vertex_gid, locked);
+
+                bool all_locked = true;
+                for (uint32_t i = 0; i < vertex_gid.size(); i++) {
+                    if (vertex_gid[i] < done.size() && done[vertex_gid[i]]) {
+                        locked[i] = true;
+                    }
+                    all_locked = all_locked && locked[i];
+                }
+                if (all_locked) {
+                    continue;
+                }
+
+                if (stage == 0) {
+                    MeshAlg::greedyEdgeCollapsePostProcessing(M, gec_alpha, gec_lambda, gec_mu, gec_d, &locked);
+                }
+                else {
+                    MeshAlg::HCLaplacianSmoothing(M, hc_alpha, hc_beta, hc_maxiter, &locked);
+
+                    done.resize(store.numVertexIds(), false);
+                    for (uint32_t i = 0; i < vertex_gid.size(); i++) {
+                        if (!locked[i]) {
+                            done[vertex_gid[i]] = true;
+                        }
+                    }
+                }
+
+                store.storePage(p, M, vertex_gid);
+            }
+        }
+    }
+
+    debugTabDec();
+    debugl(1, "MeshAlg::outOfCorePostProcessing(): done. %lu faces.\n", (unsigned long)store.numFaces());
 }
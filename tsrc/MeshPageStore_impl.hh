@@ -0,0 +1,798 @@
+/*
+ * This file is part of
+ *
+ * AnaMorph: a framework for geometric modelling, consistency analysis and surface
+ * mesh generation of anatomically reconstructed neuron morphologies.
+ * 
+ * Copyright (c) 2013-2017: G-CSC, Goethe University Frankfurt - Queisser group
+ * Author: Konstantin Mörschel
+ * 
+ * AnaMorph is free software: Redistribution and use in source and binary forms,
+ * with or without modification, are permitted under the terms of the
+ * GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works:
+ * "Based on AnaMorph (https://github.com/NeuroBox3D/AnaMorph)."
+ *
+ * (3) Neither the name "AnaMorph" nor the names of its contributors may be
+ * used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * (4) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Mörschel K, Breit M, Queisser G. Generating neuron geometries for detailed
+ *   three-dimensional simulations using AnaMorph. Neuroinformatics (2017)"
+ * "Grein S, Stepniewski M, Reiter S, Knodel MM, Queisser G.
+ *   1D-3D hybrid modelling – from multi-compartment models to full resolution
+ *   models in space and time. Frontiers in Neuroinformatics 8, 68 (2014)"
+ * "Breit M, Stepniewski M, Grein S, Gottmann P, Reinhardt L, Queisser G.
+ *   Anatomically detailed and large-scale simulations studying synapse loss
+ *   and synchrony using NeuroBox. Frontiers in Neuroanatomy 10 (2016)"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU Lesser General Public License for more details.
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "aux.hh"
+
+/* interleave the lower 10 bits of x with two zero bits each */
+inline uint32_t
+MeshPageStore_spreadBits(uint32_t x)
+{
+    x &= 0x3ff;
+    x  = (x | (x << 16)) & 0x030000ff;
+    x  = (x | (x << 8))  & 0x0300f00f;
+    x  = (x | (x << 4))  & 0x030c30c3;
+    x  = (x | (x << 2))  & 0x09249249;
+    return x;
+}
+
+template <typename R>
+MeshPageStore<R>::MeshPageStore(
+    std::string const  &filename,
+    size_t              memory_budget)
+:
+    filename_base(filename), file_generation(0), file(NULL), file_end(0), memory_budget(memory_budget),
+    nfaces(0), next_vertex_id(0), nvertex_page(0), typical_leaf_depth(0)
+{
+    this->max_page_faces    = std::max<uint64_t>(memory_budget / mesh_bytes_per_face, 1024);
+    this->filename          = this->filename_base + ".0";
+    this->file              = fopen(this->filename.c_str(), "w+b");
+    if (!this->file) {
+        throw MeshEx(MESH_IO_ERROR, "MeshPageStore::MeshPageStore(): can't open scratch file.");
+    }
+    try {
+        this->openScratchArray(this->vertex_page, "vertex_page", 0);
+    }
+    catch (...) {
+        fclose(this->file);
+        remove(this->filename.c_str());
+        throw;
+    }
+    this->bb_min = Vec3<R>(std::numeric_limits<R>::max());
+    this->bb_max = Vec3<R>(-std::numeric_limits<R>::max());
+}
+
+template <typename R>
+MeshPageStore<R>::~MeshPageStore()
+{
+    if (this->file) {
+        fclose(this->file);
+        remove(this->filename.c_str());
+    }
+}
+
+template <typename R>
+void
+MeshPageStore<R>::appendChunk(
+    FILE               *f,
+    uint64_t           &f_end,
+    Page               &page,
+    FaceRecord const   *faces,
+    size_t              n)
+{
+    if (n == 0) {
+        return;
+    }
+    if (!Aux::File::seek(f, f_end) || fwrite(faces, sizeof(FaceRecord), n, f) != n) {
+        throw MeshEx(MESH_IO_ERROR, "MeshPageStore::appendChunk(): can't write to scratch file.");
+    }
+    page.push_back({ f_end, n });
+    f_end += n * sizeof(FaceRecord);
+}
+
+template <typename R>
+void
+MeshPageStore<R>::readFaces(
+    Chunk const    &chunk,
+    uint64_t        first,
+    size_t          n,
+    FaceRecord     *faces)
+{
+    if (!Aux::File::seek(this->file, chunk.offset + first * sizeof(FaceRecord)) ||
+            fread(faces, sizeof(FaceRecord), n, this->file) != n)
+    {
+        throw MeshEx(MESH_IO_ERROR, "MeshPageStore::readFaces(): can't read from scratch file.");
+    }
+}
+
+template <typename R>
+uint64_t
+MeshPageStore<R>::pageSize(Page const &page) const
+{
+    uint64_t n = 0;
+    for (auto &chunk : page) {
+        n += chunk.nfaces;
+    }
+    return n;
+}
+
+template <typename R>
+void
+MeshPageStore<R>::openScratchArray(
+    Aux::File::ScratchArray    &a,
+    char const                 *suffix,
+    size_t                      size)
+{
+    if (!a.open(this->filename_base + "." + suffix, size)) {
+        throw MeshEx(MESH_IO_ERROR, "MeshPageStore::openScratchArray(): can't create scratch array.");
+    }
+}
+
+template <typename R>
+void
+MeshPageStore<R>::setVertexPage(
+    uint32_t    id,
+    uint32_t    p)
+{
+    /* grow geometrically, new vertex ids are handed out one by one by storePage() */
+    if ((size_t)id >= this->vertex_page.size() / sizeof(uint32_t)) {
+        size_t n = std::max<size_t>((size_t)id + 1, 2 * (this->vertex_page.size() / sizeof(uint32_t)));
+        if (!this->vertex_page.resize(n * sizeof(uint32_t))) {
+            throw MeshEx(MESH_IO_ERROR, "MeshPageStore::setVertexPage(): can't resize scratch array.");
+        }
+    }
+    reinterpret_cast<uint32_t *>(this->vertex_page.data())[id] = p;
+    this->nvertex_page = std::max(this->nvertex_page, id + 1);
+}
+
+template <typename R>
+uint32_t
+MeshPageStore<R>::getVertexPage(uint32_t id)
+{
+    return (id < this->nvertex_page) ? reinterpret_cast<uint32_t const *>(this->vertex_page.data())[id] : vertex_unused;
+}
+
+template <typename R>
+template <typename F>
+void
+MeshPageStore<R>::forEachFace(
+    std::vector<Chunk> const   &chunks,
+    F const                    &f)
+{
+    const size_t            block_size = 1 << 16;
+    std::vector<FaceRecord> block;
+
+    for (auto &chunk : chunks) {
+        for (uint64_t first = 0; first < chunk.nfaces; first += block_size) {
+            size_t n = std::min<uint64_t>(block_size, chunk.nfaces - first);
+            block.resize(n);
+            this->readFaces(chunk, first, n, block.data());
+            for (auto &face : block) {
+                f(face);
+            }
+        }
+    }
+}
+
+template <typename R>
+uint32_t
+MeshPageStore<R>::newVertexIds(uint32_t n)
+{
+    if (n > UINT32_MAX - 2 - this->next_vertex_id) {
+        throw MeshEx(MESH_LOGIC_ERROR, "MeshPageStore::newVertexIds(): out of vertex ids.");
+    }
+    uint32_t first = this->next_vertex_id;
+    this->next_vertex_id += n;
+    return first;
+}
+
+template <typename R>
+uint32_t
+MeshPageStore<R>::numVertexIds() const
+{
+    return this->next_vertex_id;
+}
+
+template <typename R>
+uint64_t
+MeshPageStore<R>::numFaces() const
+{
+    return this->nfaces;
+}
+
+template <typename R>
+uint32_t
+MeshPageStore<R>::numPages() const
+{
+    return this->pages.size();
+}
+
+template <typename R>
+void
+MeshPageStore<R>::addFaces(
+    FaceRecord const   *faces,
+    size_t              n)
+{
+    for (size_t i = 0; i < n; i++) {
+        uint32_t nv = (faces[i].v[3] == UINT32_MAX) ? 3 : 4;
+        for (uint32_t j = 0; j < nv; j++) {
+            if (faces[i].v[j] >= this->next_vertex_id) {
+                throw MeshEx(MESH_LOGIC_ERROR, "MeshPageStore::addFaces(): face refers to vertex id that has not been handed out.");
+            }
+            for (uint32_t k = 0; k < 3; k++) {
+                this->bb_min[k] = std::min(this->bb_min[k], faces[i].pos[j][k]);
+                this->bb_max[k] = std::max(this->bb_max[k], faces[i].pos[j][k]);
+            }
+        }
+    }
+
+    this->appendChunk(this->file, this->file_end, this->staging, faces, n);
+    this->nfaces += n;
+}
+
+template <typename R>
+void
+MeshPageStore<R>::addArrays(
+    uint32_t        nvertices,
+    R const        *pos,
+    uint32_t        nfaces,
+    uint32_t const *idx)
+{
+    const size_t            block_size  = 1 << 16;
+    uint32_t                first_id    = this->newVertexIds(nvertices);
+    std::vector<FaceRecord> block;
+
+    for (uint32_t first = 0; first < nfaces; first += block_size) {
+        block.resize(std::min<size_t>(block_size, nfaces - first));
+        for (size_t i = 0; i < block.size(); i++) {
+            uint32_t const *f_idx = idx + 4 * (first + i);
+            for (uint32_t j = 0; j < 4; j++) {
+                if (j == 3 && f_idx[3] == UINT32_MAX) {
+                    block[i].v[3] = UINT32_MAX;
+                    std::fill(block[i].pos[3], block[i].pos[3] + 3, (R)0);
+                }
+                else if (f_idx[j] >= nvertices) {
+                    throw MeshEx(MESH_LOGIC_ERROR, "MeshPageStore::addArrays(): vertex index out of range.");
+                }
+                else {
+                    block[i].v[j] = first_id + f_idx[j];
+                    std::copy(pos + 3 * (size_t)f_idx[j], pos + 3 * (size_t)f_idx[j] + 3, block[i].pos[j]);
+                }
+            }
+        }
+        this->addFaces(block.data(), block.size());
+    }
+}
+
+template <typename R>
+void
+MeshPageStore<R>::partition(bool shifted)
+{
+    debugl(1, "MeshPageStore::partition(): %lu faces, shifted: %d.\n", (unsigned long)this->nfaces, shifted);
+    debugTabInc();
+
+    /* all chunks in storage order */
+    std::vector<Chunk> chunks;
+    for (auto &page : this->pages) {
+        chunks.insert(chunks.end(), page.begin(), page.end());
+    }
+    chunks.insert(chunks.end(), this->staging.begin(), this->staging.end());
+
+    /* cube around the bounding box, whose side is divided into 2^max_depth cells. the shift moves the cube by
+     * half the side of a leaf at typical_leaf_depth. */
+    Vec3<R> origin  = this->bb_min;
+    R       side    = 0;
+    for (uint32_t k = 0; k < 3; k++) {
+        side = std::max(side, this->bb_max[k] - this->bb_min[k]);
+    }
+    side = side * (R)(1 + 1E-6) + (R)1E-12;
+    if (shifted) {
+        R shift = side / (R)(2u << this->typical_leaf_depth);
+        origin -= Vec3<R>(shift, shift, shift);
+        side   += shift;
+    }
+    const uint32_t  ncells  = 1u << max_depth;
+    const R         scale   = (R)ncells / side;
+
+    /* morton code of the cell containing the centroid of a face */
+    auto face_code = [&] (FaceRecord const &f) -> uint32_t
+        {
+            uint32_t    nv      = (f.v[3] == UINT32_MAX) ? 3 : 4;
+            uint32_t    code    = 0;
+            for (uint32_t k = 0; k < 3; k++) {
+                R c = 0;
+                for (uint32_t j = 0; j < nv; j++) {
+                    c += f.pos[j][k];
+                }
+                R           x = (c / (R)nv - origin[k]) * scale;
+                uint32_t    q = (x <= 0) ? 0 : std::min<uint32_t>((uint32_t)x, ncells - 1);
+                code |= MeshPageStore_spreadBits(q) << k;
+            }
+            return code;
+        };
+
+    /* refine the octree until no leaf contains more than max_page_faces faces. the faces are not held in memory:
+     * every pass over the scratch file counts the faces of the nodes still too large in the cells up to
+     * levels_per_pass levels below them, the histograms decide which nodes become leaves and which are refined
+     * further in the next pass. leaves are sorted into morton order, which keeps pages processed one after another
+     * spatially close to each other. */
+    struct OpenNode {
+        uint32_t    start;
+        uint32_t    depth;
+        uint32_t    levels;
+        size_t      offset;
+    };
+
+    std::vector<std::pair<uint32_t, uint32_t>>  leaves;
+    std::vector<OpenNode>                       open;
+    std::vector<uint32_t>                       open_start;
+    std::vector<uint64_t>                       counts;
+
+    if (this->nfaces > this->max_page_faces) {
+        open.push_back({ 0, 0, 0, 0 });
+    }
+    else if (this->nfaces > 0) {
+        leaves.push_back({ 0, 0 });
+    }
+
+    while (!open.empty()) {
+        size_t ncounts = 0;
+        open_start.clear();
+        for (auto &node : open) {
+            node.levels = std::min(levels_per_pass, max_depth - node.depth);
+            node.offset = ncounts;
+            ncounts    += (size_t)1 << (3 * node.levels);
+            open_start.push_back(node.start);
+        }
+        counts.assign(ncounts, 0);
+
+        this->forEachFace(chunks,
+            [&] (FaceRecord const &f) -> void
+            {
+                uint32_t code   = face_code(f);
+                size_t   n      = std::upper_bound(open_start.begin(), open_start.end(), code) - open_start.begin();
+                if (n == 0) {
+                    return;
+                }
+                OpenNode const &node = open[n - 1];
+                if (code - node.start < (1u << (3 * (max_depth - node.depth)))) {
+                    counts[node.offset + ((code - node.start) >> (3 * (max_depth - node.depth - node.levels)))]++;
+                }
+            });
+
+        /* prefix sums, so that the count of any node within a histogram is a difference */
+        std::vector<uint64_t> prefix(ncounts + 1, 0);
+        for (size_t i = 0; i < ncounts; i++) {
+            prefix[i + 1] = prefix[i] + counts[i];
+        }
+
+        std::vector<OpenNode> next_open;
+        for (auto &node : open) {
+            std::function<void(uint32_t, uint32_t)> refine =
+                [&] (uint32_t start, uint32_t depth) -> void
+                {
+                    /* cells of the histogram covered by the node (start, depth) */
+                    uint32_t    cell_shift  = 3 * (max_depth - node.depth - node.levels);
+                    size_t      lo          = node.offset + ((start - node.start) >> cell_shift);
+                    size_t      hi          = lo + ((size_t)1 << (3 * (node.depth + node.levels - depth)));
+                    uint64_t    n           = prefix[hi] - prefix[lo];
+
+                    if (n == 0) {
+                        return;
+                    }
+                    if (n <= this->max_page_faces || depth == max_depth) {
+                        leaves.push_back({ start, depth });
+                        return;
+                    }
+                    if (depth == node.depth + node.levels) {
+                        next_open.push_back({ start, depth, 0, 0 });
+                        return;
+                    }
+
+                    uint32_t child_size = 1u << (3 * (max_depth - depth - 1));
+                    for (uint32_t c = 0; c < 8; c++) {
+                        refine(start + c * child_size, depth + 1);
+                    }
+                };
+            refine(node.start, node.depth);
+        }
+        open.swap(next_open);
+    }
+    std::vector<uint64_t>().swap(counts);
+
+    std::sort(leaves.begin(), leaves.end());
+    std::vector<uint32_t>   leaf_start, leaf_depth;
+    for (auto &leaf : leaves) {
+        leaf_start.push_back(leaf.first);
+        leaf_depth.push_back(leaf.second);
+    }
+
+    if (!leaf_depth.empty()) {
+        std::vector<uint32_t> depths(leaf_depth);
+        std::nth_element(depths.begin(), depths.begin() + depths.size() / 2, depths.end());
+        this->typical_leaf_depth = depths[depths.size() / 2];
+    }
+
+    /* redistribute the faces into a new scratch file. the faces of every page are collected in a buffer of their
+     * own, all buffers are written out whenever half the memory budget is used up. */
+    std::string new_filename    = this->filename_base + "." + std::to_string(this->file_generation + 1);
+    FILE       *new_file        = fopen(new_filename.c_str(), "w+b");
+    uint64_t    new_file_end    = 0;
+    if (!new_file) {
+        debugTabDec();
+        throw MeshEx(MESH_IO_ERROR, "MeshPageStore::partition(): can't open scratch file.");
+    }
+
+    std::vector<Page>                       new_pages(leaf_start.size());
+    std::vector<std::vector<FaceRecord>>    buffers(leaf_start.size());
+    const size_t                            buffer_limit    = std::max<size_t>(this->memory_budget / 2 / sizeof(FaceRecord), 1 << 16);
+    size_t                                  nbuffered       = 0;
+
+    auto flush_buffers = [&] () -> void
+        {
+            for (uint32_t p = 0; p < buffers.size(); p++) {
+                this->appendChunk(new_file, new_file_end, new_pages[p], buffers[p].data(), buffers[p].size());
+                std::vector<FaceRecord>().swap(buffers[p]);
+            }
+            nbuffered = 0;
+        };
+
+    try {
+        if (!this->vertex_page.resize((size_t)this->next_vertex_id * sizeof(uint32_t))) {
+            throw MeshEx(MESH_IO_ERROR, "MeshPageStore::partition(): can't resize scratch array.");
+        }
+        uint32_t *vertex_page = reinterpret_cast<uint32_t *>(this->vertex_page.data());
+        std::fill(vertex_page, vertex_page + this->next_vertex_id, vertex_unused);
+        this->nvertex_page = this->next_vertex_id;
+
+        this->forEachFace(chunks,
+            [&] (FaceRecord const &f) -> void
+            {
+                uint32_t p  = (std::upper_bound(leaf_start.begin(), leaf_start.end(), face_code(f)) - leaf_start.begin()) - 1;
+                uint32_t nv = (f.v[3] == UINT32_MAX) ? 3 : 4;
+                for (uint32_t j = 0; j < nv; j++) {
+                    uint32_t &vp = vertex_page[f.v[j]];
+                    vp = (vp == vertex_unused || vp == p) ? p : vertex_seam;
+                }
+
+                buffers[p].push_back(f);
+                if (++nbuffered >= buffer_limit) {
+                    flush_buffers();
+                }
+            });
+        flush_buffers();
+    }
+    catch (...) {
+        fclose(new_file);
+        remove(new_filename.c_str());
+        debugTabDec();
+        throw;
+    }
+
+    fclose(this->file);
+    remove(this->filename.c_str());
+
+    this->file              = new_file;
+    this->filename          = new_filename;
+    this->file_end          = new_file_end;
+    this->file_generation++;
+    this->pages.swap(new_pages);
+    this->staging.clear();
+
+    debugTabDec();
+    debugl(1, "MeshPageStore::partition(): done. %zu pages, typical leaf depth: %u.\n", this->pages.size(), this->typical_leaf_depth);
+}
+
+template <typename R>
+template <typename Tm, typename Tv, typename Tf>
+void
+MeshPageStore<R>::loadPage(
+    uint32_t                    p,
+    Mesh<Tm, Tv, Tf, R>        &M,
+    std::vector<uint32_t>      &vertex_gid,
+    std::vector<bool>          &locked)
+{
+    if (p >= this->pages.size()) {
+        throw MeshEx(MESH_LOGIC_ERROR, "MeshPageStore::loadPage(): invalid page index.");
+    }
+
+    std::vector<FaceRecord> faces(this->pageSize(this->pages[p]));
+    size_t                  i = 0;
+    for (auto &chunk : this->pages[p]) {
+        this->readFaces(chunk, 0, chunk.nfaces, faces.data() + i);
+        i += chunk.nfaces;
+    }
+
+    /* local vertex ids are the indices into the sorted global ids */
+    vertex_gid.clear();
+    for (auto &f : faces) {
+        uint32_t nv = (f.v[3] == UINT32_MAX) ? 3 : 4;
+        vertex_gid.insert(vertex_gid.end(), f.v, f.v + nv);
+    }
+    std::sort(vertex_gid.begin(), vertex_gid.end());
+    vertex_gid.erase(std::unique(vertex_gid.begin(), vertex_gid.end()), vertex_gid.end());
+
+    std::vector<R>          pos(3 * vertex_gid.size());
+    std::vector<uint32_t>   idx(4 * faces.size(), UINT32_MAX);
+    for (i = 0; i < faces.size(); i++) {
+        uint32_t nv = (faces[i].v[3] == UINT32_MAX) ? 3 : 4;
+        for (uint32_t j = 0; j < nv; j++) {
+            uint32_t id = std::lower_bound(vertex_gid.begin(), vertex_gid.end(), faces[i].v[j]) - vertex_gid.begin();
+            idx[4 * i + j] = id;
+            std::copy(faces[i].pos[j], faces[i].pos[j] + 3, pos.begin() + 3 * id);
+        }
+    }
+    std::vector<FaceRecord>().swap(faces);
+
+    M.buildFromArrays(vertex_gid.size(), pos.data(), idx.size() / 4, idx.data(), NULL, NULL);
+
+    locked.assign(vertex_gid.size(), false);
+    for (i = 0; i < vertex_gid.size(); i++) {
+        locked[i] = (this->getVertexPage(vertex_gid[i]) == vertex_seam);
+    }
+}
+
+template <typename R>
+template <typename Tm, typename Tv, typename Tf>
+void
+MeshPageStore<R>::storePage(
+    uint32_t                        p,
+    Mesh<Tm, Tv, Tf, R>            &M,
+    std::vector<uint32_t> const    &vertex_gid)
+{
+    if (p >= this->pages.size()) {
+        throw MeshEx(MESH_LOGIC_ERROR, "MeshPageStore::storePage(): invalid page index.");
+    }
+
+    std::vector<uint32_t>   gid(vertex_gid);
+    std::vector<FaceRecord> faces;
+    faces.reserve(M.numFaces());
+
+    auto get_gid = [&] (uint32_t id) -> uint32_t
+        {
+            if (id >= gid.size()) {
+                gid.resize(id + 1, UINT32_MAX);
+            }
+            if (gid[id] == UINT32_MAX) {
+                gid[id] = this->newVertexIds(1);
+                this->setVertexPage(gid[id], p);
+            }
+            return gid[id];
+        };
+
+    for (auto &f : M.faces) {
+        FaceRecord  rec;
+        uint32_t    ids[4]  = { 0, 0, 0, UINT32_MAX };
+        Vec3<R>     x[4];
+
+        if (f.isTri()) {
+            f.getTriIndices(ids[0], ids[1], ids[2]);
+            f.getTriPositions(x[0], x[1], x[2]);
+            rec.v[3] = UINT32_MAX;
+            x[3] = Vec3<R>((R)0);
+        }
+        else if (f.isQuad()) {
+            f.getQuadIndices(ids[0], ids[1], ids[2], ids[3]);
+            f.getQuadPositions(x[0], x[1], x[2], x[3]);
+        }
+        else {
+            throw MeshEx(MESH_LOGIC_ERROR, "MeshPageStore::storePage(): discovered face that is neither triangle nor quad.");
+        }
+
+        for (uint32_t j = 0; j < 4; j++) {
+            if (j < 3 || f.isQuad()) {
+                rec.v[j] = get_gid(ids[j]);
+            }
+            for (uint32_t k = 0; k < 3; k++) {
+                rec.pos[j][k] = x[j][k];
+            }
+        }
+        faces.push_back(rec);
+    }
+
+    /* the replaced chunks stay unused on the scratch file until the next partition() */
+    this->nfaces -= this->pageSize(this->pages[p]);
+    this->pages[p].clear();
+    this->appendChunk(this->file, this->file_end, this->pages[p], faces.data(), faces.size());
+    this->nfaces += faces.size();
+
+    for (auto &f : faces) {
+        uint32_t nv = (f.v[3] == UINT32_MAX) ? 3 : 4;
+        for (uint32_t j = 0; j < nv; j++) {
+            for (uint32_t k = 0; k < 3; k++) {
+                this->bb_min[k] = std::min(this->bb_min[k], f.pos[j][k]);
+                this->bb_max[k] = std::max(this->bb_max[k], f.pos[j][k]);
+            }
+        }
+    }
+}
+
+template <typename R>
+void
+MeshPageStore<R>::writeObjFile(const char *jobname)
+{
+    debugl(1, "MeshPageStore::writeObjFile(): \"%s\".\n", jobname);
+
+    std::string obj_filename    = std::string(jobname) + ".obj";
+    FILE       *outfile         = fopen(obj_filename.c_str(), "w");
+    if (!outfile) {
+        throw MeshEx(MESH_IO_ERROR, "MeshPageStore::writeObjFile(): can't open output file for writing.");
+    }
+
+    std::vector<Chunk> chunks;
+    for (auto &page : this->pages) {
+        chunks.insert(chunks.end(), page.begin(), page.end());
+    }
+    chunks.insert(chunks.end(), this->staging.begin(), this->staging.end());
+
+    /* number the vertices in order of first use and accumulate the vertex normals as the sum of the normals of
+     * the incident faces, computed as in Mesh::Face::getNormal(). out_id is indexed by global vertex id, normals by
+     * output index. both are scratch arrays, whose fresh contents are zero, hence out_id holds the index + 1. */
+    Aux::File::ScratchArray out_id_array, normals_array;
+    try {
+        this->openScratchArray(out_id_array, "obj_ids", (size_t)this->next_vertex_id * sizeof(uint32_t));
+        this->openScratchArray(normals_array, "obj_normals", 3 * (size_t)this->next_vertex_id * sizeof(R));
+    }
+    catch (...) {
+        fclose(outfile);
+        throw;
+    }
+    uint32_t   *out_id      = reinterpret_cast<uint32_t *>(out_id_array.data());
+    R          *normals     = reinterpret_cast<R *>(normals_array.data());
+    uint32_t    nvertices   = 0;
+
+    this->forEachFace(chunks,
+        [&] (FaceRecord const &f) -> void
+        {
+            uint32_t    nv = (f.v[3] == UINT32_MAX) ? 3 : 4;
+            Vec3<R>     x[4];
+            Vec3<R>     n, n2;
+
+            for (uint32_t j = 0; j < nv; j++) {
+                if (out_id[f.v[j]] == 0) {
+                    out_id[f.v[j]] = ++nvertices;
+                }
+                x[j] = Vec3<R>(f.pos[j][0], f.pos[j][1], f.pos[j][2]);
+            }
+
+            n = (x[1] - x[0]).cross(x[2] - x[0]);
+            n.normalize();
+            if (nv == 4) {
+                n2 = (x[2] - x[0]).cross(x[3] - x[0]);
+                n2.normalize();
+                n += n2;
+                n.normalize();
+            }
+            for (uint32_t j = 0; j < nv; j++) {
+                R *nj = normals + 3 * (size_t)(out_id[f.v[j]] - 1);
+                for (uint32_t k = 0; k < 3; k++) {
+                    nj[k] += n[k];
+                }
+            }
+        });
+
+    fprintf(outfile, "# obj file automatically generated by AnaMorph for jobname: \"%s\".\n", jobname);
+    fprintf(outfile, "o %s\n", jobname);
+    fprintf(outfile, "\n# %15u vertices.\n", nvertices);
+
+    /* vertex and face lines are formatted in parallel in blocks */
+    std::vector<std::array<R, 3>>   block_pos;
+    std::vector<uint32_t>           block_faces;
+    uint32_t                        nwritten    = 0;
+    bool                            write_ok    = true;
+
+    auto write_vertices = [&] () -> void
+        {
+            write_ok = write_ok && Aux::Alg::parallelWrite(outfile, block_pos.size(), 128,
+                [&] (size_t i, char *out) -> size_t
+                {
+                    char *s = out;
+                    *s++ = 'v';
+                    for (uint32_t k = 0; k < 3; k++) {
+                        *s++ = ' ';
+                        s   += Aux::Numbers::formatExp10(s, block_pos[i][k]);
+                    }
+                    *s++ = '\n';
+                    return s - out;
+                });
+            block_pos.clear();
+        };
+
+    this->forEachFace(chunks,
+        [&] (FaceRecord const &f) -> void
+        {
+            uint32_t nv = (f.v[3] == UINT32_MAX) ? 3 : 4;
+            for (uint32_t j = 0; j < nv; j++) {
+                if (out_id[f.v[j]] == nwritten + 1) {
+                    block_pos.push_back({ { f.pos[j][0], f.pos[j][1], f.pos[j][2] } });
+                    nwritten++;
+                }
+            }
+            if (block_pos.size() >= (1 << 16)) {
+                write_vertices();
+            }
+        });
+    write_vertices();
+
+    /* dummy texture coordinate and vertex normals, same layout as Mesh::writeObjFile() */
+    fprintf(outfile, "\n# dummy texture coordinate to increase compatibility with several programs importing .obj files.\n");
+    fprintf(outfile, "vt 0.0 0.0\n");
+
+    write_ok = write_ok && Aux::Alg::parallelWrite(outfile, nvertices, 128,
+        [&] (size_t i, char *out) -> size_t
+        {
+            Vec3<R> n(normals[3 * i], normals[3 * i + 1], normals[3 * i + 2]);
+            char   *s = out;
+
+            n.normalize();
+            *s++ = 'v';
+            *s++ = 'n';
+            for (uint32_t k = 0; k < 3; k++) {
+                *s++ = ' ';
+                s   += Aux::Numbers::formatExp10(s, n[k]);
+            }
+            *s++ = '\n';
+            return s - out;
+        });
+    normals_array.close();
+
+    auto write_faces = [&] () -> void
+        {
+            write_ok = write_ok && Aux::Alg::parallelWrite(outfile, block_faces.size() / 4, 64,
+                [&] (size_t i, char *out) -> size_t
+                {
+                    char *s = out;
+                    /* "f %u//%u %u//%u %u//%u[ %u//%u]\n", one-based */
+                    *s++ = 'f';
+                    for (uint32_t j = 0; j < 4 && block_faces[4 * i + j] != UINT32_MAX; j++) {
+                        *s++ = ' ';
+                        s   += Aux::Numbers::formatUInt32(s, block_faces[4 * i + j] + 1);
+                        *s++ = '/';
+                        *s++ = '/';
+                        s   += Aux::Numbers::formatUInt32(s, block_faces[4 * i + j] + 1);
+                    }
+                    *s++ = '\n';
+                    return s - out;
+                });
+            block_faces.clear();
+        };
+
+    fprintf(outfile, "\n# %15lu faces.\n", (unsigned long)this->nfaces);
+    this->forEachFace(chunks,
+        [&] (FaceRecord const &f) -> void
+        {
+            for (uint32_t j = 0; j < 4; j++) {
+                block_faces.push_back((f.v[j] == UINT32_MAX) ? UINT32_MAX : out_id[f.v[j]] - 1);
+            }
+            if (block_faces.size() >= 4 * (1 << 16)) {
+                write_faces();
+            }
+        });
+    write_faces();
+
+    if (fclose(outfile) != 0 || !write_ok) {
+        throw MeshEx(MESH_IO_ERROR, "MeshPageStore::writeObjFile(): error while writing output file.");
+    }
+}
@@ -53,14 +53,14 @@
  * ----------------------------------------------------------------------------------------------------------------- */
 
 /* mesh vertex ctors */
-/* NOTE: Vertex::m_vit is not set after these constructors have been called and thus the vertex is
- * not in a consistent state. the caller (which has to be a friend of Mesh::Vertex, since the
- * following ctor are private) needs to take care to set the iterator correctly */
+/* NOTE: the vertex is not inserted into Mesh::V and its position is not set in Mesh::V_pos by these
+ * constructors, so the vertex is not in a consistent state. the caller (which has to be a friend of
+ * Mesh::Vertex, since the following ctor are private) needs to take care of that. */
 template <typename Tm, typename Tv, typename Tf, typename R>
 Mesh<Tm, Tv, Tf, R>::Vertex::Vertex()
 {
     this->mesh                  = NULL;
-    this->position              = Aux::VecMat::nullvec<R>;
+    this->v_id                  = 0;
     this->current_traversal_id  = 0;
     this->traversal_state       = TRAV_UNSEEN;
 }
@@ -68,11 +68,13 @@ Mesh<Tm, Tv, Tf, R>::Vertex::Vertex()
 template <typename Tm, typename Tv, typename Tf, typename R>
 Mesh<Tm, Tv, Tf, R>::Vertex::Vertex(
     Mesh               *mesh,
-    Vec3<R> const      &pos,
+    uint32_t            id,
     Tv const           *data)
+        : adjacent_vertices(SlabAllocator<Vertex *>(&(mesh->node_pool))),
+          incident_faces(SlabAllocator<Face *>(&(mesh->node_pool)))
 {
     this->mesh                  = mesh;
-    this->position              = pos;
+    this->v_id                  = id;
     this->current_traversal_id  = 0;
     this->traversal_state       = TRAV_UNSEEN;
     if (data) {
@@ -90,8 +92,7 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 Mesh<Tm, Tv, Tf, R>::Vertex::Vertex(const Vertex &x)
 {    
     this->mesh                  = x.mesh;
-    this->m_vit                 = x.m_vit;
-    this->position              = x.position;
+    this->v_id                  = x.v_id;
     this->current_traversal_id  = x.current_traversal_id;
     this->traversal_state       = x.traversal_state;
     this->adjacent_vertices     = x.adjacent_vertices;
@@ -106,8 +107,7 @@ typename Mesh<Tm, Tv, Tf, R>::Vertex &
 Mesh<Tm, Tv, Tf, R>::Vertex::operator=(const Vertex &x)
 {
     this->mesh                  = x.mesh;
-    this->m_vit                 = x.m_vit;
-    this->position              = x.position;
+    this->v_id                  = x.v_id;
     this->current_traversal_id  = x.current_traversal_id;
     this->traversal_state       = x.traversal_state;
     this->adjacent_vertices     = x.adjacent_vertices;
@@ -119,19 +119,24 @@ Mesh<Tm, Tv, Tf, R>::Vertex::operator=(const Vertex &x)
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void *
-Mesh<Tm, Tv, Tf, R>::Vertex::operator new(size_t size)
+Mesh<Tm, Tv, Tf, R>::Vertex::operator new(
+    size_t  size,
+    Mesh   &m)
 {
     if (size != sizeof(Mesh::Vertex)) {
         throw MeshEx(MESH_LOGIC_ERROR, "Mesh::Vertex::operator new(): size does not match sizeof(Vertex). internal logic error.");
     }
-    return ::operator new(size);
+    return m.vertex_pool.allocate();
 }
 
+/* only called if the ctor throws in a new-expression using the above operator new */
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::Vertex::operator delete(void *p)
+Mesh<Tm, Tv, Tf, R>::Vertex::operator delete(
+    void   *p,
+    Mesh   &m)
 {
-    ::operator delete(p);
+    m.vertex_pool.deallocate(p);
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -154,11 +159,23 @@ Mesh<Tm, Tv, Tf, R>::Vertex::replaceAdjacentVertices(const std::map<Vertex *, Ve
 template <typename Tm, typename Tv, typename Tf, typename R>
 typename Mesh<Tm, Tv, Tf, R>::Vertex *
 Mesh<Tm, Tv, Tf, R>::Vertex::getPtr(
-    typename std::map<uint32_t, VertexPointerType >::iterator it)
+    typename IdSlotMap<VertexPointerType>::iterator it)
 {
     return (it->second);
 }
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::Vertex::setPos(const Vec3<R> &p)
+{
+    this->mesh->journalVertexPos(this);
+    this->mesh->V_pos[this->v_id] = p;
+
+    /* the octree is rebuilt on demand instead of relocating v and its incident faces, since
+     * positions are mostly changed in bulk (smoothing etc.) */
+    this->mesh->octree_updated = false;
+}
+
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::Vertex::insertAdjacentVertex(Vertex *v)
@@ -195,13 +212,13 @@ Mesh<Tm, Tv, Tf, R>::Vertex::getVertexStar(
     /* NOTE: assigning will assign to or destroy all values stored in vstar when it is given to this
      * method. since pointers have trivial operator=(), this is semantically equivalent to
      * clear()ing vstar and copying the list with std::copy. */
-    vstar = this->adjacent_vertices;
+    vstar.assign(this->adjacent_vertices.begin(), this->adjacent_vertices.end());
     vstar.sort([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() < y->id());});
     vstar.unique([] (const Vertex* x, const Vertex* y) -> bool {return (x->id() == y->id());});
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
-const std::list<typename Mesh<Tm, Tv, Tf, R>::Vertex*>&
+const typename Mesh<Tm, Tv, Tf, R>::VertexList &
 Mesh<Tm, Tv, Tf, R>::Vertex::getVertexStar() const
 {
     return adjacent_vertices;
@@ -250,7 +267,7 @@ Mesh<Tm, Tv, Tf, R>::Vertex::getVertexStarIterators(
 
 
 template <typename Tm, typename Tv, typename Tf, typename R>
-const std::list<typename Mesh<Tm, Tv, Tf, R>::Face*>&
+const typename Mesh<Tm, Tv, Tf, R>::FaceList &
 Mesh<Tm, Tv, Tf, R>::Vertex::getFaceStar() const
 {
     return incident_faces;
@@ -438,16 +455,16 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 Mesh<Tm, Tv, Tf, R>::Face::Face()
 {
     this->mesh                  = NULL;
-    this->current_traversal_id  = 0;
+    this->f_id                  = 0;
     this->vertices.fill(NULL);
     this->quad                  = false;
     this->current_traversal_id  = 0;
     this->traversal_state       = TRAV_UNSEEN;
 }
 
-/* NOTE: private ctor only to be used by the internal implementation, which default constructs the
- * internal iterator Mesh::m_fit. the (internal) caller must set the iterator (once it is known) to
- * bring the Face into a consistent state. */
+/* NOTE: private ctor only to be used by the internal implementation, which does not set the face id
+ * Face::f_id. the (internal) caller must set the id (once it is known) to bring the Face into a
+ * consistent state. */
 template <typename Tm, typename Tv, typename Tf, typename R>
 Mesh<Tm, Tv, Tf, R>::Face::Face(
     Mesh       *mesh,
@@ -481,7 +498,7 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 Mesh<Tm, Tv, Tf, R>::Face::Face(const Face &x)
 {
     this->mesh                  = x.mesh;
-    this->m_fit                 = x.m_fit;
+    this->f_id                  = x.f_id;
     this->quad                  = x.quad;
     for (int i = 0; i < 4; i++) {
         this->vertices[i]       = x.vertices[i];
@@ -498,7 +515,7 @@ typename Mesh<Tm, Tv, Tf, R>::Face &
 Mesh<Tm, Tv, Tf, R>::Face::operator=(const Mesh::Face &x)
 {
     this->mesh                  = x.mesh;
-    this->m_fit                 = x.m_fit;
+    this->f_id                  = x.f_id;
     this->quad                  = x.quad;
     for (int i = 0; i < 4; i++) {
         this->vertices[i]       = x.vertices[i];
@@ -510,9 +527,30 @@ Mesh<Tm, Tv, Tf, R>::Face::operator=(const Mesh::Face &x)
     return (*this);
 }
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+void *
+Mesh<Tm, Tv, Tf, R>::Face::operator new(
+    size_t  size,
+    Mesh   &m)
+{
+    if (size != sizeof(Mesh::Face)) {
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::Face::operator new(): size does not match sizeof(Face). internal logic error.");
+    }
+    return m.face_pool.allocate();
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::Face::operator delete(
+    void   *p,
+    Mesh   &m)
+{
+    m.face_pool.deallocate(p);
+}
+
 template <typename Tm, typename Tv, typename Tf, typename R>
 typename Mesh<Tm, Tv, Tf, R>::Face *
-Mesh<Tm, Tv, Tf, R>::Face::getPtr(typename std::map<uint32_t, FacePointerType >::iterator it)
+Mesh<Tm, Tv, Tf, R>::Face::getPtr(typename IdSlotMap<FacePointerType>::iterator it)
 {
     return (it->second);
 }
@@ -669,21 +707,21 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 uint32_t
 Mesh<Tm, Tv, Tf, R>::Face::id() const
 {
-    return this->m_fit->first;
+    return this->f_id;
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 typename Mesh<Tm, Tv, Tf, R>::face_iterator
 Mesh<Tm, Tv, Tf, R>::Face::iterator() const
 {
-    return face_iterator(this->mesh, this->m_fit );
+    return face_iterator(this->mesh, typename IdSlotMap<FacePointerType>::iterator(&(this->mesh->F), this->f_id));
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 typename Mesh<Tm, Tv, Tf, R>::face_const_iterator
 Mesh<Tm, Tv, Tf, R>::Face::const_iterator() const
 {
-    return face_iterator(this->mesh, this->m_fit );
+    return face_iterator(this->mesh, typename IdSlotMap<FacePointerType>::iterator(&(this->mesh->F), this->f_id));
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -952,6 +990,22 @@ Mesh<Tm, Tv, Tf, R>::Face::getEdges(
     }
 }
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::Face::getEdges(std::vector<Edge *> &edges) const
+{
+    this->checkTriQuad("Mesh::Face::getEdges");
+    if (!this->mesh->edge_index_enabled) {
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::Face::getEdges(): edge index disabled.");
+    }
+
+    const uint32_t nv = this->isQuad() ? 4 : 3;
+    edges.clear();
+    for (uint32_t i = 0; i < nv; i++) {
+        edges.push_back(this->mesh->edgeIndexFind(this->vertices[i], this->vertices[(i + 1) % nv]));
+    }
+}
+
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::Face::getFaceNeighbours(
@@ -959,7 +1013,7 @@ Mesh<Tm, Tv, Tf, R>::Face::getFaceNeighbours(
 {
     this->checkTriQuad("Mesh::Face::getFaceNeighbours()");
 
-    Face* thisFace = Face::getPtr(this->m_fit);
+    Face const* thisFace = this;
     Face* tmp[2];
     if (this->isTri()) {
         vertex_const_iterator   v_it[3];
@@ -1008,57 +1062,20 @@ Mesh<Tm, Tv, Tf, R>::Face::getFaceNeighbourhood(
     uint32_t            max_depth,
     std::vector<Face*>  &face_neighbourhood)
 {
-    std::queue< std::pair<Face*, uint32_t> >    Q;
-    Face                                       *f;
-    uint32_t                                    f_depth;
-    std::vector<Face*>                          f_neighbours;
-    f_neighbours.reserve(3);
-
     /* get new traversal id */
-    const uint32_t                              traversal_id = this->mesh->getFreshTraversalId();
-
-    // each new element can have two new neighbors at most (triangles)
-    // this leads to a maximum of 3*2^n-2 triangles in the neighborhood
-    // be careful if depth parameter is chosen ridiculously high
-    face_neighbourhood.clear();
-    face_neighbourhood.reserve(3*pow(2,std::min(max_depth,7u))-2);
-
-    /* initialize Q: we start at (this) face in depth 0 */
-    Q.push({this, 0});
-
-    //printf("go..\n");
-    while (!Q.empty())
-    {
-        //printf("Q.size(): %d\n", Q.size());
-        /* get front element and dequeue */
-        f       = Q.front().first;
-        f_depth = Q.front().second;
-        Q.pop();
-
-        /* append to face_list, set f's traversal state to done */
-        face_neighbourhood.push_back(f);
-        f->setTraversalState(traversal_id, TRAV_DONE);
-
-        /* if max_depth has not yet been reached, inspect all neighbours of f, if they haven't been
-         * enqueue yet, enqueue them. */
-        if (f_depth <= max_depth) {
-            f->getFaceNeighbours(f_neighbours);
-            for (Face *nb : f_neighbours) {
-                if (nb->getTraversalState(traversal_id) == TRAV_UNSEEN) {
-                    Q.push({nb, f_depth + 1});
-                    nb->setTraversalState(traversal_id, TRAV_ENQUEUED);
-                }
-            }
-            f_neighbours.clear();
-        }
-    }
+    InlineTraversalStates states(this->mesh->getFreshTraversalId());
+    this->mesh->traverseFaceNeighbourhood(this, max_depth, face_neighbourhood, states);
+}
 
-    // why would this be necessary!?
-    /*
-    std::sort(face_neighbourhood.begin(), face_neighbourhood.end(), Mesh::Face::ptr_less);
-    auto newEnd = std::unique(face_neighbourhood.begin(), face_neighbourhood.end());
-    face_neighbourhood.erase(newEnd, face_neighbourhood.end());
-    */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::Face::getFaceNeighbourhood(
+    uint32_t            max_depth,
+    std::vector<Face*>  &face_neighbourhood,
+    TraversalStates     &states)
+{
+    states.reset();
+    this->mesh->traverseFaceNeighbourhood(this, max_depth, face_neighbourhood, states);
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -1066,6 +1083,7 @@ void
 Mesh<Tm, Tv, Tf, R>::Face::invertOrientation()
 {
     this->checkTriQuad("Mesh::Face::invertOrientation()");
+    this->mesh->journalFaceVertices(this);
 
     /* for triangles, vertices[3] contains NULL, reverse only first three elements of array */
     if (this->isTri()) {
@@ -1756,20 +1774,128 @@ Mesh<Tm, Tv, Tf, R>::Face::getTriSharedAndRemainingVertex(
        throw MeshEx(MESH_LOGIC_ERROR, "(static void) Mesh::getTriSharedAndRemainingVertex(): given to edges do not share a vertex.");
    }
 }
+/* ----------------------------------------------------------------------------------------------------------------- *
+ *
+ *                       mesh edge class implementation..                                                        
+ *
+ * ----------------------------------------------------------------------------------------------------------------- */
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::Edge *
+Mesh<Tm, Tv, Tf, R>::Edge::getPtr(typename IdSlotMap<EdgePointerType>::iterator it)
+{
+    return (it->second);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_iterator
+Mesh<Tm, Tv, Tf, R>::Edge::iterator() const
+{
+    return edge_iterator(this->mesh, typename IdSlotMap<EdgePointerType>::iterator(&(this->mesh->E), this->e_id));
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::Edge::getVertices(
+    Vertex *&u,
+    Vertex *&v) const
+{
+    /* the index stores the end points in address order */
+    if (this->u->id() < this->v->id()) {
+        u = this->u;
+        v = this->v;
+    }
+    else {
+        u = this->v;
+        v = this->u;
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::Edge::getIterators(
+    vertex_iterator    &u_it,
+    vertex_iterator    &v_it) const
+{
+    Vertex *u, *v;
+    this->getVertices(u, v);
+    u_it = u->iterator();
+    v_it = v->iterator();
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::Edge::getIndices(
+    uint32_t   &u_id,
+    uint32_t   &v_id) const
+{
+    u_id = std::min(this->u->id(), this->v->id());
+    v_id = std::max(this->u->id(), this->v->id());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+uint32_t
+Mesh<Tm, Tv, Tf, R>::Edge::numFaces() const
+{
+    return (this->n);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::Edge::getFaces(std::vector<Face *> &faces) const
+{
+    faces.clear();
+    for (uint32_t j = 0; j < this->n; j++) {
+        faces.push_back((j < 2) ? this->f[j] : this->f_more[j - 2]);
+    }
+    std::sort(faces.begin(), faces.end(), [] (const Face* x, const Face* y) -> bool {return (x->id() < y->id());});
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::Edge::isBorderEdge() const
+{
+    return (this->n == 1);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::Edge::isManifoldEdge() const
+{
+    return (this->n == 2);
+}
+
 /* mesh ctors */
 template <typename Tm, typename Tv, typename Tf, typename R>
-Mesh<Tm, Tv, Tf, R>::Mesh() : vertices(*this) , faces(*this)
+Mesh<Tm, Tv, Tf, R>::Mesh()
+    : vertex_pool(sizeof(Vertex), alignof(Vertex)),
+      face_pool(sizeof(Face), alignof(Face)),
+      node_pool(3 * sizeof(void *), alignof(void *)),
+      vertices(*this), faces(*this), edges(*this)
 {
     this->O                 = NULL;
     this->octree_updated    = false;
+    this->bb_updated        = false;
+    this->edge_index_enabled = false;
+    this->journal_active    = false;
+    this->journal_replaying = false;
 }
 
 /* copy ctor */
 template <typename Tm, typename Tv, typename Tf, typename R>
-Mesh<Tm, Tv, Tf, R>::Mesh(const Mesh &X) : vertices(*this), faces(*this) {
+Mesh<Tm, Tv, Tf, R>::Mesh(const Mesh &X)
+    : vertex_pool(sizeof(Vertex), alignof(Vertex)),
+      face_pool(sizeof(Face), alignof(Face)),
+      node_pool(3 * sizeof(void *), alignof(void *)),
+      vertices(*this), faces(*this), edges(*this)
+{
     /* default init */
     this->O                 = NULL;
     this->octree_updated    = false;
+    this->bb_updated        = false;
+    this->edge_index_enabled = false;
+    this->journal_active    = false;
+    this->journal_replaying = false;
 
     /* use assignment operator. although this initializes all members with the default ctor and
      * immediately overwrites them again, this was deemed preferable to copying the code of
@@ -1798,62 +1924,62 @@ Mesh<Tm, Tv, Tf, R>::operator=(const Mesh &X)
     this->F_idq             = X.F_idq;
     this->traversal_idq     = X.traversal_idq;
 
+    /* the copy maintains an edge index iff X does. it is filled by the face insertions below. */
+    this->edge_index_enabled = X.edge_index_enabled;
+
     /* copy vertex map by value: this will temporarily copy pointers referring to data from X into
-     * (this) mesh, which is not desirable in the final result. however, all ids are copied
-     * correctly. in the next step, "deep copy" all elements in this->V, i.e. allocate new vertices
-     * and copy-assign the vertices from X. note that the link between (this) mesh and X still isn't
-     * broken, since the Vertex objects contains pointers, which still refer to components of X. */
+     * (this) mesh, which are replaced with pointers to the copies below. all ids are copied
+     * correctly. */
     this->V                 = X.V;
 
-    /* deep copy */
-    Vertex *v_new;
-    typename std::map<uint32_t, VertexPointerType >::iterator vit;
-    for (vit = this->V.begin(); vit != this->V.end(); ++vit) {
-
-        /* make a copy of the Vertex object currently pointed to by vit, which is a Vertex object
-         * allocated by X, with the private copy ctor of Vertex */
-        v_new       = new Vertex(*(vit->second)); 
-
-        /* store pointer to new copy in iterator */
-        vit->second = VertexPointerType(v_new);
-
-        /* although the vertex has been deep-copied, it still contains pointers referring to X.
-         * remove entirely. all topological information for (this) mesh will be constructed will be
-         * constructed below */
+    /* the position array is indexed by id and can hence be copied as a whole */
+    this->V_pos             = X.V_pos;
 
-        /* firstly, clear adjacency and incidence information */
-        v_new->adjacent_vertices.clear();
-        v_new->incident_faces.clear();
+    /* dense tables of X's vertices and faces in id order and of the copies, plus id -> copy
+     * tables with which all pointers of X are remapped. */
+    const size_t            nV = X.V.size(), nF = X.F.size();
+    std::vector<Vertex *>   X_vertices, new_vertices(nV), v_of_xid(X.V.idBound(), NULL);
+    std::vector<Face *>     X_faces, new_faces(nF), f_of_xid(X.F.idBound(), NULL);
+    size_t                  i;
 
-        /* set mesh pointer to (this) */
-        v_new->mesh     = this;
+    X_vertices.reserve(nV);
+    for (auto &vp : X.V) {
+        X_vertices.push_back(vp.second);
+    }
+    X_faces.reserve(nF);
+    for (auto &fp : X.F) {
+        X_faces.push_back(fp.second);
+    }
 
-        /* set iterator to vit */
-        v_new->m_vit    = vit;
+    /* allocate all vertices and faces of the copy up front in one slab each, since the pools are
+     * not thread-safe. they are constructed in parallel by cloneElements(). */
+    this->vertex_pool.reserve(nV);
+    this->face_pool.reserve(nF);
+    for (i = 0; i < nV; i++) {
+        new_vertices[i]                     = static_cast<Vertex *>(this->vertex_pool.allocate());
+        v_of_xid[X_vertices[i]->v_id]       = new_vertices[i];
+    }
+    for (i = 0; i < nF; i++) {
+        new_faces[i]                        = static_cast<Face *>(this->face_pool.allocate());
+        f_of_xid[X_faces[i]->f_id]          = new_faces[i];
     }
 
-    /* now the faces of X are added using the integer _id_ based version, not copy ctor or iterator
-     * based version. through this process, all topological information (pointers, etc) is
-     * constructed correctly for (this) mesh. */
+    this->cloneElements(X_vertices, X_faces, new_vertices, new_faces, v_of_xid, f_of_xid, true);
 
-    /* ids of vertices are copied, ids of faces are invalidated during the process. why not simply iterator of X.F
-     * instead of the accessor, extract the id of the face as well, locate vertices via id and generate face map entry
-     * in (this) mesh. this way, both vertex and face ids will be intact, which is very convenient in some applications:
-     * the caller can copy a mesh and re-use ids, although pointers and iterators are invalidated. in case of moving,
-     * ids are invalidated, by pointers stay intact. easy association of mesh components simplified complex processed
-     * significantly.. */
-    face_iterator       fit;
-	uint32_t i1, i2, i3, i4;
-    for (auto &xf : X.faces)
-    {
-        xf.getIndices(i1, i2, i3, i4);
-        if (i3 == i4) // triangle
-        	fit = faces.insert(i1, i2, i3);
-        else // quadrilateral
-        	fit = faces.insert(i1, i2, i3, i4);
+    /* vertex ids are kept: replace X's pointers in the slot array. faces are not: they get fresh
+     * ids from the idq in the order of X's face ids, exactly as if X's faces were inserted one by
+     * one, which is relied upon by callers. */
+    for (i = 0; i < nV; i++) {
+        this->V.at(X_vertices[i]->v_id)     = new_vertices[i];
+    }
 
-        /* copy the rest of the information from xf */
-        fit->traversal_state    = xf.traversal_state;
+    for (i = 0; i < nF; i++) {
+        Face *f     = new_faces[i];
+        f->f_id     = this->F_idq.getId();
+        if (!this->F.insert( { f->f_id, FacePointerType(f) } ).second) {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::operator=(): new Face with fresh id from idq already present in Face map. this must never happen..");
+        }
+        this->edgeIndexInsertFace(f);
     }
 
     /* copy mesh boudning box */
@@ -1874,34 +2000,162 @@ Mesh<Tm, Tv, Tf, R>::~Mesh()
         delete this->O;
     }
 
-    /* delete all allocated vertices */
+    /* destroy vertices and faces kept alive by the undo journal */
+    this->releaseCheckpoint();
+
+    /* destroy all allocated vertices and faces, the slabs are released by the pool dtors */
     for (auto &v : this->vertices) {
-        delete (&v);
+        this->destroyVertex(&v);
     }
 
-    /* delete all allocated faces */
     for (auto &f : this->faces) {
-        delete (&f);
+        this->destroyFace(&f);
     }
 }
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::destroyVertex(Vertex *v)
+{
+    v->~Vertex();
+    this->vertex_pool.deallocate(v);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::destroyFace(Face *f)
+{
+    f->~Face();
+    this->face_pool.deallocate(f);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::releaseCopyNodePools()
+{
+    this->copy_node_pools.clear();
+}
+
+/* the elements are processed in contiguous chunks, one per thread. chunk c clones the c-th part of
+ * the vertices along with their lists and the c-th part of the faces. all copies have been
+ * allocated by the caller and all pointers are looked up in the dense tables v_of_xid / f_of_xid,
+ * so every thread only writes to its own copies and the result does not depend on the number of
+ * threads. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::cloneElements(
+    std::vector<Vertex *> const    &X_vertices,
+    std::vector<Face *> const      &X_faces,
+    std::vector<Vertex *> const    &new_vertices,
+    std::vector<Face *> const      &new_faces,
+    std::vector<Vertex *> const    &v_of_xid,
+    std::vector<Face *> const      &f_of_xid,
+    bool                            copy_attributes)
+{
+    const size_t    nV      = X_vertices.size();
+    const size_t    nF      = X_faces.size();
+    const uint32_t  nchunks = Aux::Alg::parallelChunks(nV + nF, 1 << 16);
+    uint32_t        c;
+
+    /* chunk 0 uses the mesh's own node pool, every other chunk gets a pool of its own */
+    std::vector<SlabPool *> pools(nchunks, &(this->node_pool));
+    for (c = 1; c < nchunks; c++) {
+        this->copy_node_pools.push_back(std::unique_ptr<SlabPool>(new SlabPool(this->node_pool.nodeSize(), alignof(void *))));
+        pools[c] = this->copy_node_pools.back().get();
+    }
+
+    auto byId = [] (const Vertex *x, const Vertex *y) -> bool { return (x->id() < y->id()); };
+    auto byFaceId = [] (const Face *x, const Face *y) -> bool { return (x->id() < y->id()); };
+
+    Aux::Alg::parallelFor(nV, nchunks,
+        [&] (size_t vbegin, size_t vend, uint32_t c) -> void
+        {
+            SlabPool               *pool    = pools[c];
+            const size_t            fbegin  = (nF * c) / nchunks;
+            const size_t            fend    = (nF * (c + 1)) / nchunks;
+            std::vector<Vertex *>   x_adj;
+            std::vector<Face *>     x_inc;
+            size_t                  i, nnodes = 0;
+
+            for (i = vbegin; i < vend; i++) {
+                nnodes += X_vertices[i]->adjacent_vertices.size() + X_vertices[i]->incident_faces.size();
+            }
+            pool->reserve(nnodes);
+
+            for (i = vbegin; i < vend; i++) {
+                Vertex const   *x = X_vertices[i];
+                Vertex         *v = ::new (new_vertices[i]) Vertex(this, x->v_id, copy_attributes ? &(x->data) : NULL);
+
+                if (copy_attributes) {
+                    v->current_traversal_id = x->current_traversal_id;
+                    v->traversal_state      = x->traversal_state;
+                }
+
+                /* X's lists are sorted by X's ids, which is preserved by the remapping. sort
+                 * anyway if that invariant is broken, as sorted insertion would have done. */
+                x_adj.assign(x->adjacent_vertices.begin(), x->adjacent_vertices.end());
+                x_inc.assign(x->incident_faces.begin(), x->incident_faces.end());
+                if (!std::is_sorted(x_adj.begin(), x_adj.end(), byId)) {
+                    std::stable_sort(x_adj.begin(), x_adj.end(), byId);
+                }
+                if (!std::is_sorted(x_inc.begin(), x_inc.end(), byFaceId)) {
+                    std::stable_sort(x_inc.begin(), x_inc.end(), byFaceId);
+                }
+
+                v->adjacent_vertices    = VertexList(SlabAllocator<Vertex *>(pool));
+                v->incident_faces       = FaceList(SlabAllocator<Face *>(pool));
+                for (auto u : x_adj) {
+                    v->adjacent_vertices.push_back(v_of_xid[u->v_id]);
+                }
+                for (auto f : x_inc) {
+                    v->incident_faces.push_back(f_of_xid[f->f_id]);
+                }
+            }
+
+            for (i = fbegin; i < fend; i++) {
+                Face const     *x = X_faces[i];
+                Face           *f = ::new (new_faces[i]) Face(
+                                        this,
+                                        x->quad,
+                                        v_of_xid[x->vertices[0]->v_id],
+                                        v_of_xid[x->vertices[1]->v_id],
+                                        v_of_xid[x->vertices[2]->v_id],
+                                        x->quad ? v_of_xid[x->vertices[3]->v_id] : NULL);
+
+                if (copy_attributes) {
+                    f->traversal_state      = x->traversal_state;
+                }
+            }
+        });
+}
+
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::clear()
 {
-    /* delete all allocated vertices */
+    /* the mesh is emptied entirely, which can't be undone */
+    this->releaseCheckpoint();
+
+    /* destroy all allocated vertices and faces */
     for (auto &v : this->vertices) {
-        delete (&v);
+        this->destroyVertex(&v);
     }
 
-    /* delete all allocated faces */
     for (auto &f : this->faces) {
-        delete (&f);
+        this->destroyFace(&f);
     }
 
-    /* clear vertex / face maps */
+    /* clear vertex / face maps and the edge index, which stays enabled if it was */
     this->V.clear();
     this->F.clear();
+    this->V_pos.clear();
+    this->edgeIndexClear();
+
+    /* nothing lives in the pools anymore: return all slabs at once */
+    this->vertex_pool.release();
+    this->face_pool.release();
+    this->node_pool.release();
+    this->releaseCopyNodePools();
 
     /* clear id queues */
     this->V_idq.clear();
@@ -1920,21 +2174,33 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::clearFaces()
 {
-    /* delete all allocated faces */
+    this->releaseCheckpoint();
+
+    /* destroy all allocated faces */
     for (auto &f : this->faces) {
-        delete (&f);
+        this->destroyFace(&f);
     }
 
-    /* clear faces map and face id queue.*/
+    /* clear faces map, face id queue and edge index.*/
     this->F.clear();
     this->F_idq.clear();
+    this->edgeIndexClear();
 
     /* since there are no isolated edges, simply clear all adjacency and incidence information in
      * all vertices. */
     for (auto &vit : this->V) {
-        vit.second->adjacent_vertices.clear();
-        vit.second->incident_faces.clear();
+        vit.second->adjacent_vertices   = VertexList(SlabAllocator<Vertex *>(&(this->node_pool)));
+        vit.second->incident_faces      = FaceList(SlabAllocator<Face *>(&(this->node_pool)));
     }
+
+    /* no more faces and list nodes in use, release their slabs. the (empty) lists have been
+     * re-bound to the mesh's own node pool above. */
+    this->face_pool.release();
+    this->node_pool.release();
+    this->releaseCopyNodePools();
+
+    /* octree still refers to the faces */
+    this->octree_updated    = false;
 }
 
 /* renumber vertices and faces consecutively, starting from vertex_start_id for vertices and
@@ -1946,6 +2212,11 @@ Mesh<Tm, Tv, Tf, R>::renumberConsecutively(
     uint32_t face_start_id)
 {
     debugl(2, "Mesh::renumberConsecutively(): vertex_start_id: %5d, face_start_id: %5d.\n", vertex_start_id, face_start_id);
+
+    /* the journal refers to the current ids */
+    if (this->journal_active) {
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::renumberConsecutively(): can't renumber mesh while a checkpoint is set.");
+    }
     debugTabInc();
 
     /* renumber indices of vertices and faces in a consecutive fashion. since the internal maps
@@ -1955,20 +2226,27 @@ Mesh<Tm, Tv, Tf, R>::renumberConsecutively(
      * entire mesh back to a consistent state.
      *
      * in general, all iterators are invalidated by this method */
-    std::map<uint32_t, VertexPointerType >    vertices_swap; 
-    std::map<uint32_t, FacePointerType >      faces_swap;
+    IdSlotMap<VertexPointerType>    vertices_swap; 
+    IdSlotMap<FacePointerType>      faces_swap;
     
     /* swap vertices and faces with vertices_swap / faces_swap in-place */
     this->V.swap(vertices_swap);
     this->F.swap(faces_swap);
 
+    /* positions are indexed by id as well and are permuted along with the vertices */
+    std::vector<Vec3<R>>                    positions_swap;
+    this->V_pos.swap(positions_swap);
+    this->V_pos.resize(vertex_start_id + vertices_swap.size());
+    this->V.reserve(vertex_start_id + vertices_swap.size());
+    this->F.reserve(face_start_id + faces_swap.size());
+
     /* reset id queues for vertices / faces to start at vertex_start_id / face_start_id */
     this->V_idq = IdQueue(vertex_start_id);
     this->F_idq = IdQueue(face_start_id);
 
     /* iterate through swap arrays and insert Vertex and Face shared pointers into now empty 
      * maps this->V and this->F with correct ids */
-    typename std::map<uint32_t, VertexPointerType >::iterator   vit, vnew_it;
+    typename IdSlotMap<VertexPointerType>::iterator   vit, vnew_it;
     Vertex *v;
     for (uint32_t current_vertex_id = vertex_start_id; !vertices_swap.empty(); current_vertex_id++) {
         vit         = vertices_swap.begin();
@@ -1978,8 +2256,9 @@ Mesh<Tm, Tv, Tf, R>::renumberConsecutively(
          * iterator, which is the first element of the result (iterator, bool) pair. */
         vnew_it     = ( this->V.insert( {current_vertex_id, VertexPointerType(vit->second) } ) ).first;
 
-        /* update iterator in Vertex object */
-        v->m_vit    = vnew_it;
+        /* update id in Vertex object and move position to new slot */
+        v->v_id                             = current_vertex_id;
+        this->V_pos[current_vertex_id]      = positions_swap[vit->first];
 
         /* erase vertex from vertices_swap */
         vertices_swap.erase(vit);
@@ -1991,14 +2270,14 @@ Mesh<Tm, Tv, Tf, R>::renumberConsecutively(
     }
 
     /* same for all faces */
-    typename std::map<uint32_t, FacePointerType >::iterator fit, fnew_it;
+    typename IdSlotMap<FacePointerType>::iterator fit, fnew_it;
     Face *f;
 
     for (uint32_t current_face_id = face_start_id; !faces_swap.empty(); current_face_id++) {
         fit         = faces_swap.begin();
         f           = Face::getPtr(fit);
         fnew_it     = ( this->F.insert( {current_face_id, FacePointerType(fit->second) } ) ).first;
-        f->m_fit    = fnew_it;
+        f->f_id     = fnew_it->first;
         faces_swap.erase(fit);
         this->F_idq.getId();
     }
@@ -2025,6 +2304,10 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 uint32_t
 Mesh<Tm, Tv, Tf, R>::numEdges() const
 {
+    if (this->edge_index_enabled) {
+        return (this->E.size());
+    }
+
     uint32_t two_E = 0;
     for (auto &v : this->vertices) {
         two_E += v.deg();
@@ -2121,7 +2404,7 @@ Mesh<Tm, Tv, Tf, R>::getBoundingBox() const
     using Aux::VecMat::minVec3;
     using Aux::VecMat::maxVec3;
     
-    if (this->octree_updated) {
+    if (this->octree_updated && this->bb_updated) {
         return (this->bb);
     }
     else {
@@ -2152,48 +2435,77 @@ template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::copyAppend(const Mesh &B)
 {
-    std::map<uint32_t, vertex_iterator>                     new_vertex_its;
-    typename std::map<uint32_t, vertex_iterator>::iterator  idit;
-    vertex_iterator                                         new_it;
+    const size_t            nV = B.V.size(), nF = B.F.size();
+    std::vector<Vertex *>   B_vertices, new_vertices(nV), v_of_bid(B.V.idBound(), NULL);
+    std::vector<Face *>     B_faces, new_faces(nF), f_of_bid(B.F.idBound(), NULL);
+    size_t                  i;
 
     debugl(4, "Mesh::appendCopy()\n");
     debugTabInc();
-    /* add all vertices of B to (this) mesh, store iterators to new vertices */
-    for (auto &B_v : B.vertices) {
-        new_it  = this->vertices.insert( B_v.pos() );
 
-        if ( (idit = new_vertex_its.find( B_v.id() )) != new_vertex_its.end()) {
-            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::appendCopy(): duplicate entry in new_vertex_ids map, should be impossible.");
+    /* dense tables of B's elements and their copies, see operator=() */
+    B_vertices.reserve(nV);
+    for (auto &vp : B.V) {
+        B_vertices.push_back(vp.second);
+    }
+    B_faces.reserve(nF);
+    for (auto &fp : B.F) {
+        B_faces.push_back(fp.second);
+    }
+
+    this->vertex_pool.reserve(nV);
+    this->face_pool.reserve(nF);
+    for (i = 0; i < nV; i++) {
+        new_vertices[i]                 = static_cast<Vertex *>(this->vertex_pool.allocate());
+        v_of_bid[B_vertices[i]->v_id]   = new_vertices[i];
+    }
+    for (i = 0; i < nF; i++) {
+        new_faces[i]                    = static_cast<Face *>(this->face_pool.allocate());
+        f_of_bid[B_faces[i]->f_id]      = new_faces[i];
+    }
+
+    /* the copies get neither B's data nor its traversal states, just like vertices.insert(pos) and
+     * faces.insert() would create them. */
+    this->cloneElements(B_vertices, B_faces, new_vertices, new_faces, v_of_bid, f_of_bid, false);
+
+    /* assign fresh ids in the order of B's ids. ids handed out by the idqs are ascending, so the
+     * (id-sorted) lists built from B's lists are sorted for (this) mesh as well. */
+    for (i = 0; i < nV; i++) {
+        Vertex *v   = new_vertices[i];
+        v->v_id     = this->V_idq.getId();
+        if (v->v_id >= this->V_pos.size()) {
+            this->V_pos.resize(std::max<size_t>(v->v_id + 1, 2 * this->V_pos.size()));
         }
-        new_vertex_its[B_v.id()] = new_it;  
+        this->V_pos[v->v_id] = B.V_pos[B_vertices[i]->v_id];
 
-        debugl(5, "added vertex %5d from b under new id %5d. position: \n", B_v.id(), new_it->id() );
-        B_v.pos().print_debugl(5);
+        if (!this->V.insert( { v->v_id, VertexPointerType(v) } ).second) {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::copyAppend(): vertex with fresh id from idq already present in vertex map. this must never happen..");
+        }
+        if (this->journaling()) {
+            this->journal.push_back(JournalEntry(JOURNAL_VERTEX_INSERT, v, NULL));
+        }
+        debugl(5, "added vertex %5d from b under new id %5d.\n", B_vertices[i]->v_id, v->v_id);
     }
 
-    /* add all faces of B to (this) mesh while taking care to replace old vertex ids from B with the
-     * proper new ids */
-    uint32_t v0_id, v1_id, v2_id, v3_id;
-    for (auto &B_f : B.faces) {
-        if (B_f.isQuad()) {
-            B_f.getQuadIndices(v0_id, v1_id, v2_id, v3_id);
-            this->faces.insert(
-                new_vertex_its[v0_id],
-                new_vertex_its[v1_id],
-                new_vertex_its[v2_id],
-                new_vertex_its[v3_id]);
+    for (i = 0; i < nF; i++) {
+        Face *f     = new_faces[i];
+        f->f_id     = this->F_idq.getId();
+        if (!this->F.insert( { f->f_id, FacePointerType(f) } ).second) {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::copyAppend(): new Face with fresh id from idq already present in Face map. this must never happen..");
         }
-        else if (B_f.isTri()) {
-            B_f.getTriIndices(v0_id, v1_id, v2_id);
-            this->faces.insert(
-                new_vertex_its[v0_id],
-                new_vertex_its[v1_id],
-                new_vertex_its[v2_id]);
+        this->edgeIndexInsertFace(f);
+        if (this->journaling()) {
+            this->journal.push_back(JournalEntry(JOURNAL_FACE_INSERT, NULL, f));
         }
-        else throw MeshEx(MESH_LOGIC_ERROR, "Mesh::copyAppend(): found face that is neither quad nor triangle. general case intentionally unsupported right now => internal logic error.");
     }
 
-    this->octree_updated    = false;
+    /* the octree needs all positions */
+    for (i = 0; i < nV; i++) {
+        this->octreeInsertVertex(new_vertices[i]);
+    }
+    for (i = 0; i < nF; i++) {
+        this->octreeInsertFace(new_faces[i]);
+    }
 
     debugTabDec();
     debugl(4, "Mesh::appendCopy(): done.\n");
@@ -2207,15 +2519,9 @@ Mesh<Tm, Tv, Tf, R>::moveAppend(
 {
     uint32_t                            new_id;
     Vertex                             *v;
-    typename std::map<
-            uint32_t,
-            VertexPointerType
-        >::iterator                     v_newit;
+    typename IdSlotMap<VertexPointerType>::iterator                     v_newit;
     Face                               *f;
-    typename std::map<
-            uint32_t,
-            FacePointerType
-        >::iterator                     f_newit;
+    typename IdSlotMap<FacePointerType>::iterator                     f_newit;
     bool                                inserted;
         
 
@@ -2237,9 +2543,23 @@ Mesh<Tm, Tv, Tf, R>::moveAppend(
         }
     }
 
+    /* objects kept alive by B's undo journal must not be handed over along with B's slabs */
+    B.releaseCheckpoint();
+
+    /* the Vertex and Face objects of B are moved by pointer: take over the slabs they live in. the
+     * list nodes are re-allocated from (this) mesh's node pool below, since every list carries an
+     * allocator referring to the pool it has been created with. */
+    this->vertex_pool.adopt(B.vertex_pool);
+    this->face_pool.adopt(B.face_pool);
+    size_t B_nnodes = B.node_pool.numAllocated();
+    for (auto &pool : B.copy_node_pools) {
+        B_nnodes += pool->numAllocated();
+    }
+    this->node_pool.reserve(B_nnodes);
+
     /* add all vertices of B to (this) mesh, store iterators to new vertices */
     std::pair<
-            typename std::map<uint32_t, VertexPointerType>::iterator,
+            typename IdSlotMap<VertexPointerType>::iterator,
             bool
         > v_rpair;
     auto B_vit = B.V.begin();
@@ -2251,13 +2571,33 @@ Mesh<Tm, Tv, Tf, R>::moveAppend(
         v_rpair     = this->V.insert( { new_id, VertexPointerType(B_vit->second) } );
         inserted    = v_rpair.second;
         if (inserted) {
-            /* the vertex pointer has been moved to (this) mesh: update mesh pointer Vertex::mesh
-             * and iterator Vertex::m_vit */
+            /* the vertex pointer has been moved to (this) mesh: copy position to the new slot,
+             * update mesh pointer Vertex::mesh and id Vertex::v_id */
             /* get pointer to vertex */
             v_newit     = v_rpair.first;
             v           = v_newit->second;
+            if (new_id >= this->V_pos.size()) {
+                this->V_pos.resize(new_id + 1);
+            }
+            this->V_pos[new_id] = B.V_pos[v->v_id];
             v->mesh     = this;
-            v->m_vit    = v_newit;
+            v->v_id     = new_id;
+            this->octreeInsertVertex(v);
+
+            /* re-bind adjacency / incidence lists to (this) mesh's node pool. the allocators
+             * propagate on move assignment, the old nodes are returned to B's node pool. */
+            v->adjacent_vertices    = VertexList(
+                                        v->adjacent_vertices.begin(),
+                                        v->adjacent_vertices.end(),
+                                        SlabAllocator<Vertex *>(&(this->node_pool)));
+            v->incident_faces       = FaceList(
+                                        v->incident_faces.begin(),
+                                        v->incident_faces.end(),
+                                        SlabAllocator<Face *>(&(this->node_pool)));
+
+            if (this->journaling()) {
+                this->journal.push_back(JournalEntry(JOURNAL_VERTEX_INSERT, v, NULL));
+            }
 
             /* erase B_vit from B.V */
             B_vit       = B.V.erase(B_vit); 
@@ -2270,7 +2610,7 @@ Mesh<Tm, Tv, Tf, R>::moveAppend(
 
     /* move all faces of B to (this) mesh in very much the same way */
     std::pair<
-            typename std::map<uint32_t, FacePointerType >::iterator,
+            typename IdSlotMap<FacePointerType>::iterator,
             bool
         > f_rpair;
     auto B_fit = B.F.begin();
@@ -2291,14 +2631,18 @@ Mesh<Tm, Tv, Tf, R>::moveAppend(
             f_newit     = f_rpair.first;
             f           = f_newit->second;
             f->mesh     = this;
-            f->m_fit    = f_newit;
+            f->f_id     = new_id;
+            if (this->edge_index_enabled) {
+                this->edgeIndexInsertFace(f);
+            }
+            this->octreeInsertFace(f);
+            if (this->journaling()) {
+                this->journal.push_back(JournalEntry(JOURNAL_FACE_INSERT, NULL, f));
+            }
             B_fit       = B.F.erase(B_fit); 
         }
     }
 
-    /* mesh octree needs update */
-    this->octree_updated    = false;
-
     /* clear all information from B (B.V and B.F are empty, yet id queues etc are still set */
     if (!B.F.empty() || !B.V.empty()) {
         debugTabDec();
@@ -2378,8 +2722,6 @@ Mesh<Tm, Tv, Tf, R>::deleteConnectedComponent(vertex_iterator vstart_it)
     }
     debugTabDec();
 
-    this->octree_updated = false;
-
     debugTabDec();
     debugl(2, "Mesh::deleteConnectedComponent(). done.\n");
 }
@@ -2392,105 +2734,56 @@ Mesh<Tm, Tv, Tf, R>::getConnectedComponent(
     std::list<Vertex *>    *cc_vertices,
     std::list<Face *>      *cc_faces)
 {
-    debugl(2, "Mesh::getConnectedComponent(). start vertex: %5d\n", vstart_it->id());
-    debugTabInc();
+    if (!vstart_it.checkContainer(*this) || vstart_it == this->vertices.end()) {
+        throw("Mesh::getConnectedComponent(): invalid start vertex iterator.");
+    }
 
+    InlineTraversalStates states(traversal_id);
+    this->traverseConnectedComponent(&(*vstart_it), states, cc_vertices, cc_faces);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::getConnectedComponent(
+    Mesh::vertex_iterator   vstart_it,
+    TraversalStates        &states,
+    std::list<Vertex *>    *cc_vertices,
+    std::list<Face *>      *cc_faces)
+{
     if (!vstart_it.checkContainer(*this) || vstart_it == this->vertices.end()) {
         throw("Mesh::getConnectedComponent(): invalid start vertex iterator.");
     }
 
-    /* only process if one of the given list pointers isn't NULL and the start vertex's traversal
-     * state is set to UNSEEN. */
-    if ( (cc_vertices || cc_faces) && vstart_it->getTraversalState(traversal_id) == TRAV_UNSEEN) {
-        std::queue<Vertex *>    Q;
+    this->traverseConnectedComponent(&(*vstart_it), states, cc_vertices, cc_faces);
+}
 
-        Vertex                 *v;
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::deleteBorderCCsAndIsolatedVertices()
+{
+    debugl(2, "Mesh::deleteBorderCCsAndIsolatedVertices()\n");
+    debugTabInc();
+
+    bool done = false;
+
+restart_loop:
+    while (!done) {
+        debugl(3, "(re)entering loop..\n");
+        done = true;
+
+        Vertex                 *s, *v;
         std::list<Vertex *>     v_vstar;
         std::list<Face *>       v_fstar;
 
-        /* traverse cc of vstart_it, burning it down as we go.. */
-        Q.push( &(*vstart_it) );
+        std::queue<Vertex *>    Q;
 
-        debugl(3, "traversing connected component of start vertex %5d.\n", Q.front()->id());
-        debugTabInc();
-        while (!Q.empty()) {
-            v = Q.front();
-            Q.pop();
+        uint8_t                 u_state;
+        uint32_t                ccs, cc_size;
 
-            debugl(4, "current vertex %5d\n", v->id() );
+        const uint32_t          traversal_id = this->getFreshTraversalId();
 
-            /* add v and all its incident faces to the result lists if desired by the caller */
-            if (cc_vertices) {
-                cc_vertices->push_back(v);
-            }
-            if (cc_faces) {
-                /* get face star of v */
-                v->getFaceStar(v_fstar);
-
-                /* a face incident incident to v is appended to cc_faces list iff this face hasn't
-                 * been seen yet. in this case, set traversal state to DONE to prevent multiple
-                 * insertions of the same face. */
-                for (auto v_if : v_fstar) {
-                    if (v_if->getTraversalState(traversal_id) == TRAV_UNSEEN) {
-                        cc_faces->push_back(v_if);
-                        v_if->setTraversalState(traversal_id, TRAV_DONE);
-                    }
-                }
-            }
-
-            /* get vertex star of v */
-            v->getVertexStar(v_vstar);
-
-            debugTabInc();
-            /* iterate over all vertex neighbours u and enqueue them if they haven't been seen yet. */
-            for (auto &u : v_vstar) {
-                if (u->getTraversalState(traversal_id) == TRAV_UNSEEN) {
-                    debugl(4, "yet unseen neighbour %5d => enqueueing..\n", u->id() );
-                    Q.push(u);
-                    u->setTraversalState(traversal_id, TRAV_ENQUEUED);
-                }
-            }
-            debugTabDec();
-
-            /* v is done. */
-            debugl(4, "vertex %5d done.\n", v->id() );
-            v->setTraversalState(traversal_id, TRAV_DONE);
-        }
-        debugTabDec();
-        debugl(3, "traversal of connected component completed.\n");
-    }
-
-    debugTabDec();
-    debugl(2, "Mesh::getConnectedComponent(). done.\n");
-}
-
-template <typename Tm, typename Tv, typename Tf, typename R>
-void
-Mesh<Tm, Tv, Tf, R>::deleteBorderCCsAndIsolatedVertices()
-{
-    debugl(2, "Mesh::deleteBorderCCsAndIsolatedVertices()\n");
-    debugTabInc();
-
-    bool done = false;
-
-restart_loop:
-    while (!done) {
-        debugl(3, "(re)entering loop..\n");
-        done = true;
-
-        Vertex                 *s, *v;
-        std::list<Vertex *>     v_vstar;
-        std::list<Face *>       v_fstar;
-
-        std::queue<Vertex *>    Q;
-
-        uint8_t                 u_state;
-        uint32_t                ccs, cc_size;
-
-        const uint32_t          traversal_id = this->getFreshTraversalId();
-
-        ccs         = 0;
-        debugl(3, "deleting all isolated vertices..\n");
+        ccs         = 0;
+        debugl(3, "deleting all isolated vertices..\n");
 
         debugTabInc();
 
@@ -2593,9 +2886,6 @@ restart_loop:
         debugTabDec();
     }
 
-    /* octree no longer up to date */
-    this->octree_updated = false;
-
     debugTabDec();
     debugl(2, "Mesh::deleteBorderCCsAndIsolatedVertices(): done.\n");
 }
@@ -2676,12 +2966,13 @@ Mesh<Tm, Tv, Tf, R>::updateOctree()
 
         /* call recursive partitioning algorithm */
         debugl(2, "calling recursive partitioning / construction algorithm.\n", time);
-        Mesh::partitionOctree(*O, (*this), &(O->root), root_face_list, root_vertex_list, 0, 64, 9);
+        Mesh::partitionOctree(*O, (*this), &(O->root), root_face_list, root_vertex_list, 0, OCTREE_MAX_ELEMENTS, OCTREE_MAX_DEPTH);
 
         debugl(2, "recursive octree construction done. time: %10.5f\n", tack(15));
 
         /* octree has been updated */
         this->octree_updated = true;
+        this->bb_updated     = true;
     }
 
     debugTabDec();
@@ -2884,8 +3175,6 @@ Mesh<Tm, Tv, Tf, R>::partitionOctree(
         if (rec_facelist.size() + rec_vertexlist.size() > max_elements) {
             debugl(5, "max depth not yet reached => partitioning %8ld faces and %8ld vertices among children..\n", rec_facelist.size(), rec_vertexlist.size() );
             uint32_t                            i;
-            Vec3<R>                             nc_min, nc_max, nc_m;
-            Vec3<R>                             xdisp, ydisp, zdisp;
 
             std::list<Face *>                  *children_facelists[8];
             std::list<Vertex *>                *children_vertexlists[8];
@@ -2901,42 +3190,8 @@ Mesh<Tm, Tv, Tf, R>::partitionOctree(
                 children_vertexlists[i] = new std::list<Vertex *>;
             }
 
-            /* compute midpoint of n's cube and init children's cube min / max vectors.
-             * incidentally, this does not need to be a cube here.. but who cares. the OtId thing
-             * has been designed for DMC and is not used here. space.. well.. o_O */
-            nc_min                      = n->data.cube_min;
-            nc_max                      = n->data.cube_max;
-            nc_m                        = (nc_min + nc_max) * 0.5;
-
-            xdisp                       = Vec3<R>( (nc_max[0] - nc_min[0]) / 2.0, 0.0, 0.0);
-            ydisp                       = Vec3<R>( 0.0, (nc_max[1] - nc_min[1]) / 2.0, 0.0);
-            zdisp                       = Vec3<R>( 0.0, 0.0, (nc_max[2] - nc_min[2]) / 2.0);
-
-            /* child 0: n_min and midpoint. offsetting from there with displacement vectors */
-            children[0]->data.cube_min  = nc_min;
-            children[0]->data.cube_max  = nc_m;
-
-            children[1]->data.cube_min  = nc_min + xdisp;
-            children[1]->data.cube_max  = nc_m + xdisp;
-
-            children[2]->data.cube_min  = nc_min + xdisp + ydisp;
-            children[2]->data.cube_max  = nc_m + xdisp + ydisp;
-
-            children[3]->data.cube_min  = nc_min + ydisp;
-            children[3]->data.cube_max  = nc_m + ydisp;
-
-            children[4]->data.cube_min  = nc_min + zdisp;
-            children[4]->data.cube_max  = nc_m + zdisp;
-
-            children[5]->data.cube_min  = nc_min + xdisp + zdisp;
-            children[5]->data.cube_max  = nc_m + xdisp + zdisp;
-
-            /* special case: child 6 has min corner m and max corner nc_max */
-            children[6]->data.cube_min  = nc_m;
-            children[6]->data.cube_max  = nc_max;
-
-            children[7]->data.cube_min  = nc_min + ydisp + zdisp;
-            children[7]->data.cube_max  = nc_m + ydisp + zdisp;
+            /* compute the children's cubes */
+            Mesh::setOctreeChildCubes(n);
 
             /* iterate over all faces in rec_facelist and partition them into the child lists.
              * recursive call */
@@ -3017,6 +3272,298 @@ Mesh<Tm, Tv, Tf, R>::partitionOctree(
 }
 
 
+/* compute the cubes of the eight children of the (freshly split) node n from n's cube */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::setOctreeChildCubes(OctreeNode<Mesh_OctreeNodeInfo> *n)
+{
+    uint32_t                            i;
+    Vec3<R>                             nc_min, nc_max, nc_m;
+    Vec3<R>                             xdisp, ydisp, zdisp;
+    OctreeNode<Mesh_OctreeNodeInfo>    *children[8];
+
+    for (i = 0; i < 8; i++) {
+        children[i] = n->getChild(i);
+    }
+
+    /* compute midpoint of n's cube and init children's cube min / max vectors.
+     * incidentally, this does not need to be a cube here.. but who cares. the OtId thing
+     * has been designed for DMC and is not used here. space.. well.. o_O */
+    nc_min                      = n->data.cube_min;
+    nc_max                      = n->data.cube_max;
+    nc_m                        = (nc_min + nc_max) * 0.5;
+
+    xdisp                       = Vec3<R>( (nc_max[0] - nc_min[0]) / 2.0, 0.0, 0.0);
+    ydisp                       = Vec3<R>( 0.0, (nc_max[1] - nc_min[1]) / 2.0, 0.0);
+    zdisp                       = Vec3<R>( 0.0, 0.0, (nc_max[2] - nc_min[2]) / 2.0);
+
+    /* child 0: n_min and midpoint. offsetting from there with displacement vectors */
+    children[0]->data.cube_min  = nc_min;
+    children[0]->data.cube_max  = nc_m;
+
+    children[1]->data.cube_min  = nc_min + xdisp;
+    children[1]->data.cube_max  = nc_m + xdisp;
+
+    children[2]->data.cube_min  = nc_min + xdisp + ydisp;
+    children[2]->data.cube_max  = nc_m + xdisp + ydisp;
+
+    children[3]->data.cube_min  = nc_min + ydisp;
+    children[3]->data.cube_max  = nc_m + ydisp;
+
+    children[4]->data.cube_min  = nc_min + zdisp;
+    children[4]->data.cube_max  = nc_m + zdisp;
+
+    children[5]->data.cube_min  = nc_min + xdisp + zdisp;
+    children[5]->data.cube_max  = nc_m + xdisp + zdisp;
+
+    /* special case: child 6 has min corner m and max corner nc_max */
+    children[6]->data.cube_min  = nc_m;
+    children[6]->data.cube_max  = nc_max;
+
+    children[7]->data.cube_min  = nc_min + ydisp + zdisp;
+    children[7]->data.cube_max  = nc_m + ydisp + zdisp;
+}
+
+/* the octree can only be maintained incrementally if it has been built and is up to date */
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::octreeLive() const
+{
+    return (this->O && this->octree_updated);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::octreeInsertVertex(Vertex *v)
+{
+    if (this->octreeLive()) {
+        auto v_bb = v->getBoundingBox();
+        if (this->octreeContain(v_bb)) {
+            this->octreeInsertRecursive(&(this->O->root), 0, v_bb.min(), v_bb.max(), v, NULL);
+        }
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::octreeEraseVertex(Vertex *v)
+{
+    if (this->octreeLive()) {
+        auto v_bb = v->getBoundingBox();
+        this->octreeEraseRecursive(&(this->O->root), v_bb.min(), v_bb.max(), v, NULL);
+        this->bb_updated = false;
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::octreeInsertFace(Face *f)
+{
+    if (this->octreeLive()) {
+        auto f_bb = f->getBoundingBox();
+        if (this->octreeContain(f_bb)) {
+            this->octreeInsertRecursive(&(this->O->root), 0, f_bb.min(), f_bb.max(), NULL, f);
+        }
+    }
+}
+
+/* NOTE: f has to have the same vertices at the same positions as when it was inserted, since the
+ * leaves containing f are located with f's bounding box. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::octreeEraseFace(Face *f)
+{
+    if (this->octreeLive()) {
+        auto f_bb = f->getBoundingBox();
+        this->octreeEraseRecursive(&(this->O->root), f_bb.min(), f_bb.max(), NULL, f);
+        this->bb_updated = false;
+    }
+}
+
+/* make sure the root cube of the octree contains the given bounding box of an element which is
+ * about to be inserted by doubling the root cube towards the element as often as necessary. if
+ * that takes unreasonably many steps, the octree is dropped and rebuilt on the next query. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::octreeContain(BoundingBox<R> const &elem_bb)
+{
+    Vec3<R> const       elem_min = elem_bb.min(), elem_max = elem_bb.max();
+    uint32_t            growth   = 0;
+
+    /* type of the child of the new root the old root becomes, indexed by the (binary) offset of
+     * the old root in the new one. see setOctreeChildCubes(). */
+    static const uint8_t child_type[2][2][2] = { { {0, 4}, {3, 7} }, { {1, 5}, {2, 6} } };
+
+    this->bb_updated = false;
+
+    while (true) {
+        Mesh_OctreeNodeInfo    &root_info = this->O->root.data;
+        Vec3<R>                 new_min;
+        uint32_t                below[3];
+        uint32_t                i;
+
+        if (    root_info.cube_min[0] <= elem_min[0] && elem_max[0] <= root_info.cube_max[0] &&
+                root_info.cube_min[1] <= elem_min[1] && elem_max[1] <= root_info.cube_max[1] &&
+                root_info.cube_min[2] <= elem_min[2] && elem_max[2] <= root_info.cube_max[2])
+        {
+            return true;
+        }
+        else if (growth++ >= OCTREE_MAX_ROOT_GROWTH) {
+            debugl(1, "Mesh::octreeContain(): element far outside of root cube => octree will be rebuilt.\n");
+            this->octree_updated = false;
+            return false;
+        }
+
+        /* grow towards the element: in every dimension where the element sticks out below the
+         * root cube, the old root becomes the upper half of the new root and vice versa. */
+        R const len = this->O->root_l;
+        for (i = 0; i < 3; i++) {
+            below[i]    = (elem_min[i] < root_info.cube_min[i]) ? 1 : 0;
+            new_min[i]  = root_info.cube_min[i] - below[i] * len;
+        }
+
+        Mesh_OctreeNodeInfo new_root_info;
+        new_root_info.cube_min      = new_min;
+        new_root_info.cube_max      = new_min + Vec3<R>(2.0 * len, 2.0 * len, 2.0 * len);
+
+        debugl(2, "Mesh::octreeContain(): growing root cube to (%5.4f, %5.4f, %5.4f) - (%5.4f, %5.4f, %5.4f).\n",
+                new_root_info.cube_min[0], new_root_info.cube_min[1], new_root_info.cube_min[2],
+                new_root_info.cube_max[0], new_root_info.cube_max[1], new_root_info.cube_max[2]);
+
+        /* the old root keeps its exact cube instead of the recomputed one */
+        Vec3<R> const   old_cube_min    = root_info.cube_min;
+        Vec3<R> const   old_cube_max    = root_info.cube_max;
+        uint8_t const   old_root_type   = child_type[below[0]][below[1]][below[2]];
+
+        this->O->growRoot(new_root_info, old_root_type, new_min, 2.0 * len);
+        Mesh::setOctreeChildCubes(&(this->O->root));
+
+        Mesh_OctreeNodeInfo &old_root_info  = this->O->root.getChild(old_root_type)->data;
+        old_root_info.cube_min              = old_cube_min;
+        old_root_info.cube_max              = old_cube_max;
+    }
+}
+
+/* recursively insert v or f into all leaves below n whose cube intersects the given bounding box,
+ * splitting leaves that get too full on the way. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::octreeInsertRecursive(
+    OctreeNode<Mesh_OctreeNodeInfo>    *n,
+    uint32_t                            depth,
+    Vec3<R> const                      &aabb_min,
+    Vec3<R> const                      &aabb_max,
+    Vertex                             *v,
+    Face                               *f)
+{
+    using namespace Aux::Geometry::IntersectionTestResults;
+
+    if (n->isLeaf()) {
+        if (v) n->data.vertex_list.push_back(v);
+        if (f) n->data.face_list.push_back(f);
+
+        /* split n with the partitioning algorithm used for construction. n's lists are moved out
+         * first, since splitLeaf() copies n's data to all children. */
+        if (depth < OCTREE_MAX_DEPTH && n->data.face_list.size() + n->data.vertex_list.size() > OCTREE_MAX_ELEMENTS) {
+            std::list<Face *>   n_facelist;
+            std::list<Vertex *> n_vertexlist;
+
+            n_facelist.swap(n->data.face_list);
+            n_vertexlist.swap(n->data.vertex_list);
+            Mesh::partitionOctree(*(this->O), *this, n, n_facelist, n_vertexlist, depth, OCTREE_MAX_ELEMENTS, OCTREE_MAX_DEPTH);
+        }
+    }
+    else {
+        OctreeNode<Mesh_OctreeNodeInfo>    *child;
+        uint32_t                            i;
+
+        for (i = 0; i < 8; i++) {
+            child = n->getChild(i);
+            if (child && Aux::Geometry::simpleIntersect2AABB(
+                        aabb_min,
+                        aabb_max,
+                        child->data.cube_min,
+                        child->data.cube_max) == INTERSECTION)
+            {
+                this->octreeInsertRecursive(child, depth + 1, aabb_min, aabb_max, v, f);
+            }
+        }
+    }
+}
+
+/* recursively erase v or f from all leaves below n whose cube intersects the given bounding box,
+ * merging underfull children back into their parent on the way up. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::octreeEraseRecursive(
+    OctreeNode<Mesh_OctreeNodeInfo>    *n,
+    Vec3<R> const                      &aabb_min,
+    Vec3<R> const                      &aabb_max,
+    Vertex                             *v,
+    Face                               *f)
+{
+    using namespace Aux::Geometry::IntersectionTestResults;
+    using Aux::Alg::removeFirstOccurrenceFromList;
+
+    if (n->isLeaf()) {
+        if (v) removeFirstOccurrenceFromList(n->data.vertex_list, v);
+        if (f) removeFirstOccurrenceFromList(n->data.face_list, f);
+    }
+    else {
+        OctreeNode<Mesh_OctreeNodeInfo>    *child;
+        uint32_t                            i;
+        size_t                              n_elements  = 0;
+        bool                                all_leaves  = true;
+
+        for (i = 0; i < 8; i++) {
+            child = n->getChild(i);
+            if (child && Aux::Geometry::simpleIntersect2AABB(
+                        aabb_min,
+                        aabb_max,
+                        child->data.cube_min,
+                        child->data.cube_max) == INTERSECTION)
+            {
+                this->octreeEraseRecursive(child, aabb_min, aabb_max, v, f);
+            }
+
+            if (child) {
+                all_leaves  = all_leaves && child->isLeaf();
+                n_elements += child->data.face_list.size() + child->data.vertex_list.size();
+            }
+        }
+
+        if (all_leaves && n_elements <= OCTREE_MERGE_ELEMENTS) {
+            this->octreeMergeChildren(n);
+        }
+    }
+}
+
+/* turn n, all of whose children are leaves, into a leaf containing the union of the children's
+ * elements. */
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::octreeMergeChildren(OctreeNode<Mesh_OctreeNodeInfo> *n)
+{
+    OctreeNode<Mesh_OctreeNodeInfo>    *child;
+    uint32_t                            i;
+
+    for (i = 0; i < 8; i++) {
+        if ( (child = n->getChild(i)) ) {
+            n->data.face_list.splice(n->data.face_list.end(), child->data.face_list);
+            n->data.vertex_list.splice(n->data.vertex_list.end(), child->data.vertex_list);
+        }
+    }
+
+    /* elements intersecting several children are contained in several lists */
+    n->data.face_list.sort();
+    n->data.face_list.unique();
+    n->data.vertex_list.sort();
+    n->data.vertex_list.unique();
+
+    this->O->mergeChildren(n);
+}
+
+
 /* static recursive octree location traversal: given a bounding box, find all leafs in the octree
  * that intersect the bounding box and return the union of their face lists */
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -3235,64 +3782,382 @@ Mesh<Tm, Tv, Tf, R>::invertFaceSelection(std::list<Face *> &flist) const
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::checkEdge(
-    const std::string&              fn,
-    const vertex_const_iterator    &u_it,
-    const vertex_const_iterator    &v_it) const
+Mesh<Tm, Tv, Tf, R>::checkpoint()
 {
-    if (!u_it.checkContainer( *this ) || !u_it.sameContainer(v_it) || u_it == v_it) {
-        throw MeshEx(MESH_LOGIC_ERROR, fn + "given edge (u, v) invalid: u and v not from (this) mesh or identical.");
-    }
-    else if (!u_it->gotNeighbour(v_it)) {
-        throw MeshEx(MESH_LOGIC_ERROR, fn + "given edge (u, v) invalid: both vertices from (this) mesh, yet edge does not exist.");
-    }
+    /* a new savepoint supersedes the old one */
+    this->releaseCheckpoint();
+
+    this->journal_active    = true;
+    this->V_idq_checkpoint  = this->V_idq;
+    this->F_idq_checkpoint  = this->F_idq;
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::checkEdge(
-    const char                     *fn,
-    const vertex_const_iterator    &u_it,
-    const vertex_const_iterator    &v_it) const
+Mesh<Tm, Tv, Tf, R>::rollback()
 {
-    if (!u_it.checkContainer( *this ) || !u_it.sameContainer(v_it) || u_it == v_it) {
-        throw MeshEx(MESH_LOGIC_ERROR, std::string(fn) + "given edge (u, v) invalid: u and v not from (this) mesh or identical.");
+    debugl(2, "Mesh::rollback(): undoing %zu journaled changes.\n", this->journal.size());
+
+    if (!this->journal_active) {
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::rollback(): no checkpoint set.");
     }
-    else if (!u_it->gotNeighbour(v_it)) {
-        throw MeshEx(MESH_LOGIC_ERROR, std::string(fn) + "given edge (u, v) invalid: both vertices from (this) mesh, yet edge does not exist.");
+
+    /* undo all changes in reverse order. the accessors are used to undo insertions, the replay flag
+     * makes them destroy the objects right away instead of journaling the erasure. */
+    this->journal_replaying = true;
+    while (!this->journal.empty()) {
+        JournalEntry   &e = this->journal.back();
+        Vertex         *v = e.v;
+        Face           *f = e.f;
+
+        switch (e.op) {
+            case JOURNAL_VERTEX_INSERT:
+                this->vertices.erase(v->iterator());
+                break;
+
+            case JOURNAL_VERTEX_ERASE:
+                if (!this->V.insert( { v->v_id, VertexPointerType(v) } ).second) {
+                    throw MeshEx(MESH_LOGIC_ERROR, "Mesh::rollback(): id of erased vertex taken. internal logic error.");
+                }
+                if (v->v_id >= this->V_pos.size()) {
+                    this->V_pos.resize(v->v_id + 1);
+                }
+                this->V_pos[v->v_id] = e.pos;
+                this->octreeInsertVertex(v);
+                break;
+
+            case JOURNAL_VERTEX_POS:
+                this->V_pos[v->v_id] = e.pos;
+                this->octree_updated = false;
+                break;
+
+            case JOURNAL_VERTEX_LISTS:
+                v->adjacent_vertices.assign(e.adjacent_vertices.begin(), e.adjacent_vertices.end());
+                v->incident_faces.assign(e.incident_faces.begin(), e.incident_faces.end());
+                break;
+
+            case JOURNAL_FACE_INSERT:
+                this->faces.erase(f->iterator());
+                break;
+
+            case JOURNAL_FACE_ERASE:
+            {
+                if (!this->F.insert( { f->f_id, FacePointerType(f) } ).second) {
+                    throw MeshEx(MESH_LOGIC_ERROR, "Mesh::rollback(): id of erased face taken. internal logic error.");
+                }
+
+                /* re-create adjacency and incidence information exactly as FaceAccessor::insert()
+                 * does. all lists are sorted by id, so this restores them exactly. */
+                const uint32_t nv = f->isQuad() ? 4 : 3;
+                for (uint32_t i = 0; i < nv; i++) {
+                    f->vertices[i]->insertAdjacentVertex(f->vertices[(i + nv - 1) % nv]);
+                    f->vertices[i]->insertAdjacentVertex(f->vertices[(i + 1) % nv]);
+                    f->vertices[i]->insertIncidentFace(f);
+                }
+                this->edgeIndexInsertFace(f);
+                this->octreeInsertFace(f);
+                break;
+            }
+
+            case JOURNAL_FACE_VERTICES:
+                this->edgeIndexEraseFace(f);
+                this->octreeEraseFace(f);
+                f->vertices = e.f_vertices;
+                this->edgeIndexInsertFace(f);
+                this->octreeInsertFace(f);
+                break;
+        }
+        this->journal.pop_back();
     }
+    this->journal_replaying = false;
+
+    /* ids are handed out exactly as they would have been at the savepoint */
+    this->V_idq             = this->V_idq_checkpoint;
+    this->F_idq             = this->F_idq_checkpoint;
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::getFacesIncidentToEdge(
-    const vertex_const_iterator    &u_it,
-    const vertex_const_iterator    &v_it,
-    Face**                          incident_faces,
-    size_t&                         sizeInOut) const
+Mesh<Tm, Tv, Tf, R>::releaseCheckpoint()
 {
-    this->checkEdge("Mesh::getFacesIncidentToEdge()", u_it, v_it);
+    if (!this->journal_active) {
+        return;
+    }
 
-    // this is extremely slow due to recurring call of new operator for creation of lists
-#if 0
-    std::list<Face *> ufaces, vfaces;
+    /* erased objects are no longer needed */
+    for (auto &e : this->journal) {
+        if (e.op == JOURNAL_VERTEX_ERASE) {
+            this->destroyVertex(e.v);
+        }
+        else if (e.op == JOURNAL_FACE_ERASE) {
+            this->destroyFace(e.f);
+        }
+    }
+    std::vector<JournalEntry>().swap(this->journal);
 
-    u_it->getFaceStar(ufaces);
-    v_it->getFaceStar(vfaces);
+    this->journal_active    = false;
+    this->V_idq_checkpoint  = IdQueue();
+    this->F_idq_checkpoint  = IdQueue();
+}
 
-    /* clear() result, sort and set intersect into result */
-    incident_faces.clear();
-    ufaces.sort(Mesh::Face::ptr_less);
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::hasCheckpoint() const
+{
+    return this->journal_active;
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::journaling() const
+{
+    return (this->journal_active && !this->journal_replaying);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::journalVertexPos(Vertex *v)
+{
+    if (this->journaling()) {
+        this->journal.push_back(JournalEntry(JOURNAL_VERTEX_POS, v, NULL));
+        this->journal.back().pos = v->pos();
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::journalVertexLists(Vertex *v)
+{
+    if (this->journaling()) {
+        this->journal.push_back(JournalEntry(JOURNAL_VERTEX_LISTS, v, NULL));
+        this->journal.back().adjacent_vertices.assign(v->adjacent_vertices.begin(), v->adjacent_vertices.end());
+        this->journal.back().incident_faces.assign(v->incident_faces.begin(), v->incident_faces.end());
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::journalFaceVertices(Face *f)
+{
+    if (this->journaling()) {
+        this->journal.push_back(JournalEntry(JOURNAL_FACE_VERTICES, NULL, f));
+        this->journal.back().f_vertices = f->vertices;
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::enableEdgeIndex()
+{
+    if (this->edge_index_enabled) {
+        return;
+    }
+
+    /* build the index from scratch. every edge of a closed triangle mesh is shared by two faces,
+     * so there are about 1.5 edges per face. */
+    this->edge_index_enabled = true;
+    this->edgeIndexClear();
+    this->edge_index.reserve(2 * this->F.size());
+    for (auto &fit : this->F) {
+        this->edgeIndexInsertFace(fit.second);
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::disableEdgeIndex()
+{
+    this->edge_index_enabled = false;
+
+    /* swap trick to actually free the bucket array */
+    EdgeIndexMap().swap(this->edge_index);
+    IdSlotMap<EdgePointerType>().swap(this->E);
+    this->E_idq.clear();
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::hasEdgeIndex() const
+{
+    return this->edge_index_enabled;
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+std::pair<const typename Mesh<Tm, Tv, Tf, R>::Vertex *, const typename Mesh<Tm, Tv, Tf, R>::Vertex *>
+Mesh<Tm, Tv, Tf, R>::edgeIndexKey(const Vertex *u, const Vertex *v)
+{
+    return (u < v) ? std::make_pair(u, v) : std::make_pair(v, u);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::Edge *
+Mesh<Tm, Tv, Tf, R>::edgeIndexFind(const Vertex *u, const Vertex *v) const
+{
+    auto eit = this->edge_index.find(edgeIndexKey(u, v));
+    return (eit != this->edge_index.end()) ? const_cast<Edge *>(&(eit->second)) : NULL;
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::edgeIndexClear()
+{
+    this->edge_index.clear();
+    this->E.clear();
+    this->E_idq.clear();
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::edgeIndexInsertFace(Face *f)
+{
+    if (!this->edge_index_enabled) {
+        return;
+    }
+
+    const uint32_t nv = f->isQuad() ? 4 : 3;
+    for (uint32_t i = 0; i < nv; i++) {
+        auto    key = edgeIndexKey(f->vertices[i], f->vertices[(i + 1) % nv]);
+        Edge   &e   = this->edge_index[key];
+
+        /* new edge: assign id and register with E */
+        if (e.n == 0) {
+            e.mesh  = this;
+            e.e_id  = this->E_idq.getId();
+            e.u     = const_cast<Vertex *>(key.first);
+            e.v     = const_cast<Vertex *>(key.second);
+            this->E.insert( { e.e_id, EdgePointerType(&e) } );
+        }
+
+        if (e.n < 2) {
+            e.f[e.n] = f;
+        }
+        else {
+            e.f_more.push_back(f);
+        }
+        e.n++;
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::edgeIndexEraseFace(Face *f)
+{
+    if (!this->edge_index_enabled) {
+        return;
+    }
+
+    const uint32_t nv = f->isQuad() ? 4 : 3;
+    for (uint32_t i = 0; i < nv; i++) {
+        auto eit = this->edge_index.find(edgeIndexKey(f->vertices[i], f->vertices[(i + 1) % nv]));
+        if (eit == this->edge_index.end()) {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::edgeIndexEraseFace(): edge of face not found in edge index. internal logic error.");
+        }
+
+        /* remove f and fill the gap with the last face of the entry */
+        Edge &e             = eit->second;
+        Face *last          = (e.n > 2) ? e.f_more.back() : e.f[e.n - 1];
+        bool found          = false;
+        for (uint32_t j = 0; j < e.n && !found; j++) {
+            Face *&slot = (j < 2) ? e.f[j] : e.f_more[j - 2];
+            if (slot == f) {
+                slot    = last;
+                found   = true;
+            }
+        }
+        if (!found) {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::edgeIndexEraseFace(): face not registered with one of its edges. internal logic error.");
+        }
+
+        if (e.n > 2) {
+            e.f_more.pop_back();
+        }
+        if (--e.n == 0) {
+            this->E.erase(e.e_id);
+            this->E_idq.freeId(e.e_id);
+            this->edge_index.erase(eit);
+        }
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::checkEdge(
+    const std::string&              fn,
+    const vertex_const_iterator    &u_it,
+    const vertex_const_iterator    &v_it) const
+{
+    if (!u_it.checkContainer( *this ) || !u_it.sameContainer(v_it) || u_it == v_it) {
+        throw MeshEx(MESH_LOGIC_ERROR, fn + "given edge (u, v) invalid: u and v not from (this) mesh or identical.");
+    }
+    else if (this->edge_index_enabled ? !this->edgeIndexFind(&(*u_it), &(*v_it)) : !u_it->gotNeighbour(v_it)) {
+        throw MeshEx(MESH_LOGIC_ERROR, fn + "given edge (u, v) invalid: both vertices from (this) mesh, yet edge does not exist.");
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::checkEdge(
+    const char                     *fn,
+    const vertex_const_iterator    &u_it,
+    const vertex_const_iterator    &v_it) const
+{
+    if (!u_it.checkContainer( *this ) || !u_it.sameContainer(v_it) || u_it == v_it) {
+        throw MeshEx(MESH_LOGIC_ERROR, std::string(fn) + "given edge (u, v) invalid: u and v not from (this) mesh or identical.");
+    }
+    else if (this->edge_index_enabled ? !this->edgeIndexFind(&(*u_it), &(*v_it)) : !u_it->gotNeighbour(v_it)) {
+        throw MeshEx(MESH_LOGIC_ERROR, std::string(fn) + "given edge (u, v) invalid: both vertices from (this) mesh, yet edge does not exist.");
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::getFacesIncidentToEdge(
+    const vertex_const_iterator    &u_it,
+    const vertex_const_iterator    &v_it,
+    Face**                          incident_faces,
+    size_t&                         sizeInOut) const
+{
+    this->checkEdge("Mesh::getFacesIncidentToEdge()", u_it, v_it);
+
+    // this is extremely slow due to recurring call of new operator for creation of lists
+#if 0
+    std::list<Face *> ufaces, vfaces;
+
+    u_it->getFaceStar(ufaces);
+    v_it->getFaceStar(vfaces);
+
+    /* clear() result, sort and set intersect into result */
+    incident_faces.clear();
+    ufaces.sort(Mesh::Face::ptr_less);
     vfaces.sort(Mesh::Face::ptr_less);
 
     /* use back_inserter to compile result into incident_faces */
     std::set_intersection(ufaces.begin(), ufaces.end(), vfaces.begin(), vfaces.end(), std::back_inserter(incident_faces) );
 #endif
 
+    /* with the edge index, read off the incident faces directly. they are reported in ascending
+     * order of face ids, just like the scan over the (sorted) face star of u below. */
+    if (this->edge_index_enabled) {
+        const Edge *e = this->edgeIndexFind(&(*u_it), &(*v_it));
+        if (!e) {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::getFacesIncidentToEdge(): input edge invalid or non-existent.");
+        }
+        else if (e->n > sizeInOut) {
+            throw MeshEx(MESH_LOGIC_ERROR, "Found more incident faces to edge than expected.");
+        }
+
+        for (uint32_t j = 0; j < e->n; j++) {
+            incident_faces[j] = (j < 2) ? e->f[j] : e->f_more[j - 2];
+        }
+        std::sort(incident_faces, incident_faces + e->n, [] (const Face* x, const Face* y) -> bool {return (x->id() < y->id());});
+        sizeInOut = e->n;
+        return;
+    }
+
     // we do it brute force without sorting and are still faster
     size_t sz = 0;
-    const std::list<Face*>& uFaces = u_it->getFaceStar();
-    const std::list<Face*>& vFaces = v_it->getFaceStar();
+    const FaceList& uFaces = u_it->getFaceStar();
+    const FaceList& vFaces = v_it->getFaceStar();
     typename std::list<Face*>::const_iterator itU = uFaces.begin();
     typename std::list<Face*>::const_iterator itV;
     typename std::list<Face*>::const_iterator itUend = uFaces.end();
@@ -3422,29 +4287,27 @@ Mesh<Tm, Tv, Tf, R>::getTriCommonEdge(
     A_it->getTriVertices(A_v0, A_v1, A_v2);
     B_it->getTriVertices(B_v0, B_v1, B_v2);
 
-    std::vector<Vertex *> A_vertices = { A_v0, A_v1, A_v2 };
-    std::vector<Vertex *> B_vertices = { B_v0, B_v1, B_v2 };
-    std::vector<Vertex *> AB_shared_vertices;
+    /* intersect the two vertex triples directly, which needs no sorting and no allocations */
+    Vertex     *A_vertices[3] = { A_v0, A_v1, A_v2 };
+    Vertex     *AB_shared_vertices[3];
+    uint32_t    nshared = 0;
 
-    auto vrtCmp = [] (const Vertex* x, const Vertex* y) -> bool {return (x->id() < y->id());};
-    std::sort(A_vertices.begin(), A_vertices.end(), vrtCmp);
-    std::sort(B_vertices.begin(), B_vertices.end(), vrtCmp);
-    std::set_intersection(
-            A_vertices.begin(),
-            A_vertices.end(),
-            B_vertices.begin(),
-            B_vertices.end(),
-            std::inserter(AB_shared_vertices, AB_shared_vertices.begin()),
-            vrtCmp
-        );
+    for (Vertex *a : A_vertices) {
+        if (a == B_v0 || a == B_v1 || a == B_v2) {
+            AB_shared_vertices[nshared++] = a;
+        }
+    }
 
-    if (AB_shared_vertices.size() == 2) {
-        /* write return variables */
-        u_it = AB_shared_vertices.front()->iterator();
-        v_it = AB_shared_vertices.back()->iterator();
+    if (nshared == 2) {
+        /* write return variables, ordered by id */
+        if (AB_shared_vertices[0]->id() > AB_shared_vertices[1]->id()) {
+            std::swap(AB_shared_vertices[0], AB_shared_vertices[1]);
+        }
+        u_it = AB_shared_vertices[0]->iterator();
+        v_it = AB_shared_vertices[1]->iterator();
         return true;
     }
-    else if (AB_shared_vertices.size() == 0 || AB_shared_vertices.size() == 1) {
+    else if (nshared == 0 || nshared == 1) {
         return false;
     }
     else {
@@ -3570,8 +4433,10 @@ void
 Mesh<Tm, Tv, Tf, R>::scale(R const &r)
 {
     for (auto &v : this->vertices) {
+        this->journalVertexPos(&v);
         v.pos() *= r;
     }
+    this->octree_updated = false;
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -3579,8 +4444,10 @@ void
 Mesh<Tm, Tv, Tf, R>::translate(Vec3<R> const &d)
 {
     for (auto &v : this->vertices) {
+        this->journalVertexPos(&v);
         v.pos() += d;
     }
+    this->octree_updated = false;
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -4011,6 +4878,11 @@ Mesh<Tm, Tv, Tf, R>::collapseTriEdge(
         /* create map for vertex replacement */
         std::map<Vertex *, Vertex *> replace_map = { {u_vertex, w_vertex}, {v_vertex, w_vertex} };
 
+        /* the lists of u, v and w are manipulated directly below */
+        this->journalVertexLists(u_vertex);
+        this->journalVertexLists(v_vertex);
+        this->journalVertexLists(w_vertex);
+
         /* w's incident faces is the union of u's and v's. */
         debugl(3, "getting incident faces of u and v and computing union as new incident faces of w.\n");
         w_vertex->incident_faces = u_vertex->incident_faces;
@@ -4028,7 +4900,12 @@ Mesh<Tm, Tv, Tf, R>::collapseTriEdge(
         debugTabInc();
         for (Face *f : w_vertex->incident_faces) {
             debugl(1, "%5d = (%5d, %5d, %5d)\n", f->id(), f->vertices[0]->id(), f->vertices[1]->id(), f->vertices[2]->id() );
+            this->journalFaceVertices(f);
+            this->edgeIndexEraseFace(f);
+            this->octreeEraseFace(f);
             f->replaceVertices(replace_map);
+            this->edgeIndexInsertFace(f);
+            this->octreeInsertFace(f);
         } 
         debugTabDec();
 
@@ -4052,6 +4929,7 @@ Mesh<Tm, Tv, Tf, R>::collapseTriEdge(
         std::list<Vertex *> w_adj_vertices;
         w_vertex->getVertexStar(w_adj_vertices);
         for (Vertex *w_nb : w_adj_vertices) {
+            this->journalVertexLists(w_nb);
             w_nb->replaceAdjacentVertices(replace_map);
         }
 
@@ -4127,6 +5005,10 @@ Mesh<Tm, Tv, Tf, R>::mergeUnrelatedVertices(
 
     Mesh::vertex_iterator w_it = this->vertices.insert(w_pos);
 
+    this->journalVertexLists(&(*u_it));
+    this->journalVertexLists(&(*v_it));
+    this->journalVertexLists(&(*w_it));
+
     /* manually copy adjacent_vertices and incident from both u and v to w and clear info inside u
      * and v. */
     w_it->adjacent_vertices = u_it->adjacent_vertices;
@@ -4159,12 +5041,18 @@ Mesh<Tm, Tv, Tf, R>::mergeUnrelatedVertices(
      * and still think they're connected to u or v). */
     std::map<Vertex *, Vertex *> replace_map = { { &(*u_it), &(*w_it)}, { &(*v_it), &(*w_it)} };
     for (auto &f : w_it->incident_faces) {
+        this->journalFaceVertices(f);
+        this->edgeIndexEraseFace(f);
+        this->octreeEraseFace(f);
         f->replaceVertices(replace_map);
+        this->edgeIndexInsertFace(f);
+        this->octreeInsertFace(f);
     } 
 
     std::list<Vertex *> w_vstar;
     w_it->getVertexStar(w_vstar);
     for (auto &w_nb : w_vstar) {
+        this->journalVertexLists(w_nb);
         w_nb->replaceAdjacentVertices(replace_map);
     }
 
@@ -4197,7 +5085,7 @@ Mesh<Tm, Tv, Tf, R>::checkTopology()
     uint8_t                 u_state;
     uint32_t                ccs, cc_size;
 
-    const uint32_t          traversal_id = this->getFreshTraversalId();
+    TraversalStates         states(*this);
 
     ccs         = 0;
     debugl(2, "checking for orphaned vertices..\n");
@@ -4229,7 +5117,7 @@ Mesh<Tm, Tv, Tf, R>::checkTopology()
     debugl(2, "checking for non-manifold edges by traversing all connected components.\n");
     debugTabInc();
     for (Vertex &vref : this->vertices) {
-        if (vref.getTraversalState(traversal_id) == TRAV_UNSEEN) {
+        if (states.getVertexState(&vref) == TRAV_UNSEEN) {
             /* new connected component with root s */
             s       = &vref;
             cc_size = 0;
@@ -4251,7 +5139,7 @@ Mesh<Tm, Tv, Tf, R>::checkTopology()
 
                 for (auto u : v_vstar) {
                     /* current neighbour u */
-                    u_state = u->getTraversalState(traversal_id);
+                    u_state = states.getVertexState(u);
 
                     /* we handle the edge in in the direction {v -> u} if u is not done (but can be
                      * either enqueued or unseen), otherwise u has already handled the edge in
@@ -4299,12 +5187,12 @@ Mesh<Tm, Tv, Tf, R>::checkTopology()
                     /* enqueue u if it hasn't been seen yet */
                     if (u_state == TRAV_UNSEEN) {
                         Q.push(u);
-                        u->setTraversalState(traversal_id, TRAV_ENQUEUED);
+                        states.setVertexState(u, TRAV_ENQUEUED);
                     }
                 }
 
                 /* v is done */
-                v->setTraversalState(traversal_id, TRAV_DONE);
+                states.setVertexState(v, TRAV_DONE);
             }
             debugTabDec();
 
@@ -4590,169 +5478,228 @@ Mesh<Tm, Tv, Tf, R>::checkGeometry(
 }
 
 /* I/O */
-struct obj_face {
-    bool        quad;
-    uint32_t    v_idx[4];
-    uint32_t    n_idx[4];
-
-    obj_face(
-        bool        quad,
-        bool        use_normals,
-        uint32_t    v0,
-        uint32_t    v1,
-        uint32_t    v2,
-        uint32_t    v3,
-        uint32_t    n0 = 0,
-        uint32_t    n1 = 0,
-        uint32_t    n2 = 0,
-        uint32_t    n3 = 0)
-    {
-        this->quad      = quad;
-        this->v_idx[0]  = v0 - 1;
-        this->v_idx[1]  = v1 - 1;  
-        this->v_idx[2]  = v2 - 1;  
-        if (quad) {
-            this->v_idx[3]  = v3 - 1;
-        }
-
-        if (use_normals) {
-            n_idx[0]    = n0 - 1;
-            n_idx[1]    = n1 - 1;
-            n_idx[2]    = n2 - 1;
-            if (quad) {
-                n_idx[3]    = n3 - 1;
+
+/* vertices and faces parsed from a line-aligned chunk of an obj file. face vertex indices are
+ * 0-based, four per face with UINT32_MAX as fourth index of a triangle. */
+template <typename R>
+struct obj_chunk {
+    std::vector<R>          pos;
+    std::vector<uint32_t>   idx;
+    char const             *error_line;
+    const char             *error;
+
+    obj_chunk() : error_line(NULL), error(NULL) {}
+};
+
+inline bool
+obj_isblank(char c)
+{
+    return (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f');
+}
+
+/* parse all lines of [data, size) that start in [begin, end[. a line starting before end is parsed
+ * to its end, so neighbouring chunks split the file without overlap. supported lines are "v x y z",
+ * faces with three or four vertices of the forms "a", "a/t", "a//n" and "a/t/n" as well as comments
+ * and "o", "vt" and "vn", which are ignored. */
+template <typename R>
+void
+obj_parse_chunk(
+    char const     *data,
+    size_t          size,
+    size_t          begin,
+    size_t          end,
+    obj_chunk<R>   &chunk)
+{
+    using Aux::Numbers::parseDouble;
+    using Aux::Numbers::parseUInt32;
+
+    char const     *s       = data + begin;
+    char const     *eof     = data + size;
+
+    /* start at the first line beginning in the chunk */
+    if (begin > 0 && data[begin - 1] != '\n') {
+        s = static_cast<char const *>(memchr(s, '\n', eof - s));
+        s = s ? s + 1 : eof;
+    }
+
+    while (s < data + end) {
+        char const     *line    = s;
+        char const     *eol     = static_cast<char const *>(memchr(s, '\n', eof - s));
+        eol                     = eol ? eol : eof;
+
+        while (s < eol && obj_isblank(*s)) {
+            s++;
+        }
+
+        if (s == eol || *s == '#' || *s == 'o' || (s + 1 < eol && s[0] == 'v' && (s[1] == 't' || s[1] == 'n'))) {
+        }
+        else if (s + 1 < eol && s[0] == 'v' && obj_isblank(s[1])) {
+            double x[3];
+            s++;
+            for (uint32_t i = 0; i < 3; i++) {
+                while (s < eol && obj_isblank(*s)) {
+                    s++;
+                }
+                if (!parseDouble(s, eol, x[i])) {
+                    chunk.error_line    = line;
+                    chunk.error         = "Mesh::readFromObjFile(): invalid vertex.";
+                    return;
+                }
+            }
+            chunk.pos.push_back(x[0]);
+            chunk.pos.push_back(x[1]);
+            chunk.pos.push_back(x[2]);
+        }
+        else if (s + 1 < eol && s[0] == 'f' && obj_isblank(s[1])) {
+            uint32_t    v[4]    = { 0, 0, 0, UINT32_MAX };
+            uint32_t    nv      = 0, dummy;
+
+            s++;
+            while (true) {
+                while (s < eol && obj_isblank(*s)) {
+                    s++;
+                }
+                if (s == eol) {
+                    break;
+                }
+                if (nv == 4) {
+                    chunk.error_line    = line;
+                    chunk.error         = "Mesh::readFromObjFile(): only triangles and quads are supported.";
+                    return;
+                }
+                if (!parseUInt32(s, eol, v[nv]) || v[nv] == 0) {
+                    chunk.error_line    = line;
+                    chunk.error         = "Mesh::readFromObjFile(): invalid face vertex index.";
+                    return;
+                }
+                v[nv++]--;
+
+                /* skip optional texture coordinate and normal indices */
+                if (s < eol && *s == '/') {
+                    s++;
+                    parseUInt32(s, eol, dummy);
+                    if (s < eol && *s == '/') {
+                        s++;
+                        parseUInt32(s, eol, dummy);
+                    }
+                }
+                if (s < eol && !obj_isblank(*s)) {
+                    chunk.error_line    = line;
+                    chunk.error         = "Mesh::readFromObjFile(): invalid face vertex.";
+                    return;
+                }
+            }
+
+            if (nv < 3) {
+                chunk.error_line    = line;
+                chunk.error         = "Mesh::readFromObjFile(): face with less than three vertices.";
+                return;
             }
+            chunk.idx.insert(chunk.idx.end(), v, v + 4);
         }
         else {
-            n_idx[0] = 0;
-            n_idx[1] = 0;
-            n_idx[2] = 0;
-            n_idx[3] = 0;
+            chunk.error_line    = line;
+            chunk.error         = "Mesh::readFromObjFile(): unrecognized line.";
+            return;
         }
+
+        s = (eol < eof) ? eol + 1 : eof;
     }
-};
+}
 
+/* the file is mapped and split into line-aligned chunks, which are parsed in parallel. the
+ * per-chunk arrays are concatenated in file order, so vertex i of the file ends up at pos[3*i]
+ * and gets id i in readFromObjFile(), which builds the mesh from the arrays in bulk. */
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
-Mesh<Tm, Tv, Tf, R>::readFromObjFile(const char *filename)
+Mesh<Tm, Tv, Tf, R>::readObjArrays(
+    const char             *filename,
+    std::vector<R>         &pos,
+    std::vector<uint32_t>  &idx)
 {
-    debugl(1, "Mesh::readFromObjFile()");
+    debugl(1, "Mesh::readObjArrays()");
     debugTabInc();
 
-    /* clear mesh */
-    this->clear();
-
-    std::list<Vec3<R>>      vertices;
-    std::list<Vec3<R>>      normals;
-    std::list<obj_face>     faces;
-
-    std::string             line_string;
-    char                   *line;
-    std::ifstream           f;
-
-    f.open(filename, std::ifstream::in);
-    if ( !f.is_open() ) {
-        throw MeshEx(MESH_IO_ERROR, "Mesh::readFromObjFile(): can't open input file\n");
+    Aux::File::MappedFile   file;
+    if (!file.open(filename)) {
+        debugTabDec();
+        throw MeshEx(MESH_IO_ERROR, "Mesh::readObjArrays(): can't open input file\n");
     }
 
-    R           x, y, z;
-    uint32_t    v0, v1, v2, v3, n0, n1, n2, n3;
+    char const     *data    = file.data();
+    const size_t    size    = file.size();
+#ifdef __DEBUG__
+    /* debug output is not thread-safe */
+    const uint32_t  nchunks = 1;
+#else
+    const uint32_t  nchunks = Aux::Alg::parallelChunks(size, 1 << 20);
+#endif
+    uint32_t        c;
 
-    /* keep reading until eof */
-    while ( f.good() ) {
-        /* get line, convert to c string */
-        std::getline(f, line_string);
-        if (line_string.size() == 0) {
-            debugl(3, "empty line..\n");
-            continue;
-        }
+    std::vector<obj_chunk<R>> chunks(nchunks);
+    Aux::Alg::parallelFor(size, nchunks,
+        [&] (size_t begin, size_t end, uint32_t c) -> void
+        {
+            obj_parse_chunk<R>(data, size, begin, end, chunks[c]);
+        });
 
-        line = new char [ line_string.size() + 1];
-        std::strcpy(line, line_string.c_str() );
+    /* report the first error in file order */
+    for (c = 0; c < nchunks; c++) {
+        if (chunks[c].error) {
+            char const *eol = static_cast<char const *>(memchr(chunks[c].error_line, '\n', data + size - chunks[c].error_line));
+            int         len = (int)std::min<size_t>((eol ? eol : data + size) - chunks[c].error_line, 256);
 
-        /* parse line with sscanf, if not a comment */
-        if (line[0] == '#') {
-            //printf("comment: ");
-        }
-        /* object declaration */
-        else if (line[0] == 'o') {
-            //printf("comment: ");
-        }
-        /* dummy texture coordinate */
-        else if (line[0] == 'v' && line[1] == 't') {
-        }
-        else if ( sscanf(line, "v %lf %lf %lf", &x, &y, &z) == 3 ) {
-            //printf("vertex.");
-            vertices.push_back( Vec3<R>(x, y, z) );
-        }
-        else if ( sscanf(line, "vn %lf %lf %lf", &x, &y, &z) == 3) {
-            //printf("normal.");
-            normals.push_back( Vec3<R>(x, y, z) );
-        }
-        else if ( sscanf(line, "f %u %u %u", &v0, &v1, &v2) == 3) {
-            //printf("simple triangle.");
-            faces.push_back( obj_face(false, false, v0, v1, v2, 0) );
-        }
-        else if ( sscanf(line, "f %u %u %u %u", &v0, &v1, &v2, &v3) == 4) {
-            //printf("simple quad.");
-            throw("Mesh::readFromObjFile(): QUAD!\n");
-            //faces.push_back( obj_face(true, false, v0, v1, v2, v3) );
-        }
-        else if ( sscanf(line, "f %u//%u %u//%u %u//%u", &v0, &n0, &v1, &n1, &v2, &n2) == 6) {
-            //printf("triangle with normals.");
-            faces.push_back( obj_face(false, true, v0, v1, v2, 0, n0, n1, n2, 0) );
-        }
-        else if ( sscanf(line, "f %u//%u %u//%u %u//%u %u//%u", &v0, &n0, &v1, &n1, &v2, &n2, &v3, &n3) == 8) {
-            //printf("quad with normals.");
-            throw("Mesh::readFromObjFile(): QUAD!\n");
-            //faces.push_back( obj_face(true, true, v0, v1, v2, v3, n0, n1, n2, n3) );
-        }
-        else {
-            printf("Mesh::readFromObjFile(): unrecognized line: \"%s\".\n", line);
-            throw("Mesh::readFromObjFile(): unrecognized line.\n");
+            printf("Mesh::readObjArrays(): error in line: \"%.*s\".\n", len, chunks[c].error_line);
+            debugTabDec();
+            throw MeshEx(MESH_IO_ERROR, chunks[c].error);
         }
+    }
 
-        delete[] line;
+    /* concatenate */
+    std::vector<size_t> pos_offset(nchunks + 1, 0), idx_offset(nchunks + 1, 0);
+    for (c = 0; c < nchunks; c++) {
+        pos_offset[c + 1] = pos_offset[c] + chunks[c].pos.size();
+        idx_offset[c + 1] = idx_offset[c] + chunks[c].idx.size();
+    }
+    if (pos_offset[nchunks] / 3 >= UINT32_MAX || idx_offset[nchunks] / 4 >= UINT32_MAX) {
+        debugTabDec();
+        throw MeshEx(MESH_IO_ERROR, "Mesh::readObjArrays(): too many vertices or faces.");
     }
 
-    /* try to add all vertices and faces. */
-    try {
-        /* NOTE: this relies upon the fact that adding n vertices to an empty mesh will number them 0...(n-1) */
-        debugl(2, "Adding %5d vertices\n", (uint32_t)vertices.size());
-        while (!vertices.empty()) {
-            this->vertices.insert(vertices.front());
-            vertices.pop_front();
-        }
-        debugl(2, "done adding vertices.\n");
-
-        debugl(2, "adding %5d faces..\n", (uint32_t)faces.size());
-        obj_face *f;
-        while (!faces.empty()) {
-            f = &(faces.front());
-            if (f->quad) {
-                this->faces.insert(
-                        f->v_idx[0],
-                        f->v_idx[1],
-                        f->v_idx[2],
-                        f->v_idx[3]
-                    );
-            }
-            /* obj reader only supports quads and triangles, so !f->quad <=> f is triangle */
-            else {
-                this->faces.insert(
-                        f->v_idx[0],
-                        f->v_idx[1],
-                        f->v_idx[2]
-                    );
+    pos.resize(pos_offset[nchunks]);
+    idx.resize(idx_offset[nchunks]);
+    Aux::Alg::parallelFor(nchunks, nchunks,
+        [&] (size_t begin, size_t end, uint32_t) -> void
+        {
+            for (size_t c = begin; c < end; c++) {
+                std::copy(chunks[c].pos.begin(), chunks[c].pos.end(), pos.begin() + pos_offset[c]);
+                std::copy(chunks[c].idx.begin(), chunks[c].idx.end(), idx.begin() + idx_offset[c]);
+                std::vector<R>().swap(chunks[c].pos);
+                std::vector<uint32_t>().swap(chunks[c].idx);
             }
+        });
 
-            /* pop_front added face */
-            faces.pop_front();
-        }
-        debugl(2, "done adding faces.\n");
+    debugTabDec();
+    debugl(1, "Mesh::readObjArrays(): done.\n");
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::readFromObjFile(const char *filename)
+{
+    debugl(1, "Mesh::readFromObjFile()");
+    debugTabInc();
+
+    std::vector<R>          pos;
+    std::vector<uint32_t>   idx;
+
+    try {
+        Mesh::readObjArrays(filename, pos, idx);
+        this->buildFromArrays(pos.size() / 3, pos.data(), idx.size() / 4, idx.data(), NULL, NULL);
     }
-    catch (MeshEx& err) {
-        printf("caught exception: \"%s\".\n", err.error_msg.c_str() );
+    catch (...) {
+        debugTabDec();
+        throw;
     }
 
     debugTabDec();
@@ -4781,19 +5728,55 @@ Mesh<Tm, Tv, Tf, R>::writeObjFile(const char *jobname)
     fprintf(outfile, "# obj file automatically generated by AnaMorph for jobname: \"%s\".\n", jobname);
     fprintf(outfile, "o %s\n", jobname);
 
+    /* lines are formatted in parallel into large buffers, see Aux::Alg::parallelWrite(). collect
+     * vertices and faces in output order first. */
+    std::vector<Vertex *>   vtable;
+    std::vector<Face *>     ftable;
+
+    vtable.reserve(this->V.size());
+    ftable.reserve(this->F.size());
+    for (auto &v : this->vertices) {
+        vtable.push_back(&v);
+    }
+    for (auto &f : this->faces) {
+        if (!f.isTri() && !f.isQuad()) {
+            fclose(outfile);
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::writeObjFile(): discovered face that is neither triangle nor quad. internal logic error.");
+        }
+        ftable.push_back(&f);
+    }
+
+    /* "%+.10e %+.10e %+.10e\n" */
+    auto format_vec =
+        [] (char *out, Vec3<R> const &x) -> uint32_t
+        {
+            char *s = out;
+            for (uint32_t i = 0; i < 3; i++) {
+                s   += Aux::Numbers::formatExp10(s, x[i]);
+                *s++ = (i < 2) ? ' ' : '\n';
+            }
+            return s - out;
+        };
+
+    bool write_ok = true;
+
     /* write in all the vertices, preceeded by a comment */
     fprintf(outfile, "\n# %15ld vertices.\n", this->V.size());
 
     debugl(4, "writing %15ld vertices..\n", this->vertices.size());
     debugTabInc();
 
-    Vec3<R> vpos;
-    for (auto &v : this->vertices) {
-        vpos = v.pos();
-        debugl(5, "writing vertex %5d..\n", v.id());
-        vpos.print_debugl(5);
-        fprintf(outfile, "v %+.10e %+.10e %+.10e\n", vpos[0], vpos[1], vpos[2]);
-    }
+    write_ok = write_ok && Aux::Alg::parallelWrite(outfile, vtable.size(), 128,
+        [&] (size_t i, char *out) -> size_t
+        {
+            Vec3<R> vpos = vtable[i]->pos();
+            debugl(5, "writing vertex %5d..\n", vtable[i]->id());
+            vpos.print_debugl(5);
+
+            out[0] = 'v';
+            out[1] = ' ';
+            return 2 + format_vec(out + 2, vpos);
+        });
 
     debugTabDec();
 
@@ -4809,16 +5792,22 @@ Mesh<Tm, Tv, Tf, R>::writeObjFile(const char *jobname)
     debugTabInc();
 
     // vertex normals, for whatever reason they may be needed
-    Vec3<R> n;
-    for (auto &v : this->vertices) {
-        debugl(5, "writing vertex normal %5d..\n", v.id());
-        const std::list<typename Mesh<Tm, Tv, Tf, R>::Face*>& faceStar = v.getFaceStar();
-        n.assign((R)0);
-        for (auto f : faceStar)
-            n += f->getNormal();
-        n.normalize();
-        fprintf(outfile, "vn %+.10e %+.10e %+.10e\n", n[0], n[1], n[2]);
-    }
+    write_ok = write_ok && Aux::Alg::parallelWrite(outfile, vtable.size(), 128,
+        [&] (size_t i, char *out) -> size_t
+        {
+            debugl(5, "writing vertex normal %5d..\n", vtable[i]->id());
+            const FaceList& faceStar = vtable[i]->getFaceStar();
+            Vec3<R> n;
+            n.assign((R)0);
+            for (auto f : faceStar)
+                n += f->getNormal();
+            n.normalize();
+
+            out[0] = 'v';
+            out[1] = 'n';
+            out[2] = ' ';
+            return 3 + format_vec(out + 3, n);
+        });
 
     debugTabDec();
 
@@ -4828,52 +5817,463 @@ Mesh<Tm, Tv, Tf, R>::writeObjFile(const char *jobname)
     debugl(4, "writing %15ld faces..\n", this->faces.size());
     debugTabInc();
 
-    uint32_t v0_id, v1_id, v2_id, v3_id;
-    for (auto &f: this->faces) {
-        if (f.isQuad()) {
-            f.getQuadIndices(v0_id, v1_id, v2_id, v3_id);
-            fprintf(outfile, "f %u//%u %u//%u %u//%u %u//%u\n",
-                    v0_id + 1, 
-                    v0_id + 1, 
-                    v1_id + 1,
-                    v1_id + 1,
-                    v2_id + 1,
-                    v2_id + 1,
-                    v3_id + 1,
-                    v3_id + 1);
-
-            debugl(5, "quad  %u/%u/%u/%u\n",
-                    v0_id, 
-                    v1_id,
-                    v2_id,
-                    v3_id);
-        }
-        else if (f.isTri()) {
-            f.getTriIndices(v0_id, v1_id, v2_id);
-            fprintf(outfile, "f %u//%u %u//%u %u//%u\n",
-                    v0_id + 1, 
-                    v0_id + 1, 
-                    v1_id + 1,
-                    v1_id + 1,
-                    v2_id + 1,
-                    v2_id + 1);
-
-            debugl(5, "tri  %u/%u/%u/\n",
-                    v0_id, 
-                    v1_id,
-                    v2_id);
+    /* "f %u//%u %u//%u %u//%u[ %u//%u]\n", one-based */
+    write_ok = write_ok && Aux::Alg::parallelWrite(outfile, ftable.size(), 128,
+        [&] (size_t i, char *out) -> size_t
+        {
+            uint32_t    ids[4];
+            uint32_t    nids    = 3;
+            char       *s       = out;
+
+            if (ftable[i]->isQuad()) {
+                ftable[i]->getQuadIndices(ids[0], ids[1], ids[2], ids[3]);
+                nids = 4;
+                debugl(5, "quad  %u/%u/%u/%u\n", ids[0], ids[1], ids[2], ids[3]);
+            }
+            else {
+                ftable[i]->getTriIndices(ids[0], ids[1], ids[2]);
+                debugl(5, "tri  %u/%u/%u/\n", ids[0], ids[1], ids[2]);
+            }
+
+            *s++ = 'f';
+            for (uint32_t j = 0; j < nids; j++) {
+                *s++ = ' ';
+                s   += Aux::Numbers::formatUInt32(s, ids[j] + 1);
+                *s++ = '/';
+                *s++ = '/';
+                s   += Aux::Numbers::formatUInt32(s, ids[j] + 1);
+            }
+            *s++ = '\n';
+
+            return s - out;
+        });
+    debugTabDec();
+
+    if (fclose(outfile) != 0 || !write_ok) {
+        debugTabDec();
+        throw MeshEx(MESH_IO_ERROR, "Mesh::writeObjFile(): error while writing output file.");
+    }
+
+    debugTabDec();
+    debugl(4, "Mesh::writeObjFile(): done.\n");
+}
+
+/* binary mesh format, see Mesh.hh. all sections start at 8-byte aligned offsets, which keeps them
+ * aligned inside the (page-aligned) mapping of the file. */
+struct amb_header {
+    char        magic[8];
+    uint32_t    version;
+    uint32_t    byte_order;
+    uint32_t    real_size;
+    uint32_t    vertex_data_size;
+    uint32_t    face_data_size;
+    uint32_t    reserved;
+    uint64_t    nvertices;
+    uint64_t    nfaces;
+    uint64_t    pos_offset;
+    uint64_t    idx_offset;
+    uint64_t    vdata_offset;
+    uint64_t    fdata_offset;
+};
+
+static const char       amb_magic[8]    = { 'A', 'M', 'B', 'M', 'E', 'S', 'H', '\0' };
+static const uint32_t   amb_version     = 1;
+static const uint32_t   amb_byte_order  = 0x01020304;
+
+inline uint64_t
+amb_align(uint64_t offset)
+{
+    return ((offset + 7) & ~((uint64_t)7));
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::buildFromArrays(
+    uint32_t        nvertices,
+    R const        *pos,
+    uint32_t        nfaces,
+    uint32_t const *idx,
+    Tv const       *vdata,
+    Tf const       *fdata)
+{
+    debugl(2, "Mesh::buildFromArrays(): %u vertices, %u faces.\n", nvertices, nfaces);
+    debugTabInc();
+
+#ifdef __DEBUG__
+    /* debug output is not thread-safe */
+    const uint32_t  nchunks = 1;
+#else
+    const uint32_t  nchunks = Aux::Alg::parallelChunks((size_t)nvertices + nfaces, 1 << 16);
+#endif
+    uint32_t        i, j, nv, c;
+    uint32_t const *fi;
+
+    /* check all faces before the mesh is touched */
+    try {
+        Aux::Alg::parallelFor(nfaces, nchunks,
+            [&] (size_t begin, size_t end, uint32_t) -> void
+            {
+                for (size_t f = begin; f < end; f++) {
+                    uint32_t const *fv  = idx + 4 * f;
+                    uint32_t const  nfv = (fv[3] == UINT32_MAX) ? 3 : 4;
+                    for (uint32_t k = 0; k < nfv; k++) {
+                        if (fv[k] >= nvertices) {
+                            throw MeshEx(MESH_IO_ERROR, "Mesh::buildFromArrays(): vertex index of face out of range.");
+                        }
+                        for (uint32_t l = 0; l < k; l++) {
+                            if (fv[k] == fv[l]) {
+                                throw MeshEx(MESH_IO_ERROR, "Mesh::buildFromArrays(): face contains the same vertex twice.");
+                            }
+                        }
+                    }
+                }
+            });
+    }
+    catch (...) {
+        debugTabDec();
+        throw;
+    }
+
+    this->clear();
+
+    /* adjacency and incidence in compressed row form: every face contributes the two ring
+     * neighbours of each of its vertices, see FaceAccessor::insert(), and itself. a vertex hence
+     * has exactly half as many incidence as adjacency entries, so adj_begin / 2 delimits the
+     * incidence rows. incidence rows are filled in face order and thus sorted by face id. */
+    std::vector<size_t>     adj_begin(nvertices + 1, 0);
+    for (i = 0; i < nfaces; i++) {
+        fi  = idx + 4 * (size_t)i;
+        nv  = (fi[3] == UINT32_MAX) ? 3 : 4;
+        for (j = 0; j < nv; j++) {
+            adj_begin[fi[j] + 1] += 2;
+        }
+    }
+    std::partial_sum(adj_begin.begin(), adj_begin.end(), adj_begin.begin());
+
+    std::vector<uint32_t>   adj(adj_begin[nvertices]);
+    std::vector<uint32_t>   inc(adj_begin[nvertices] / 2);
+    {
+        std::vector<size_t> adj_end(adj_begin.begin(), adj_begin.end() - 1);
+        for (i = 0; i < nfaces; i++) {
+            fi  = idx + 4 * (size_t)i;
+            nv  = (fi[3] == UINT32_MAX) ? 3 : 4;
+            for (j = 0; j < nv; j++) {
+                size_t &r           = adj_end[fi[j]];
+                inc[r / 2]          = i;
+                adj[r++]            = fi[(j + nv - 1) % nv];
+                adj[r++]            = fi[(j + 1) % nv];
+            }
+        }
+    }
+
+    /* the elements get the ids 0..n-1 of the cleared id queues */
+    this->V_idq.getIdBlock(nvertices);
+    this->F_idq.getIdBlock(nfaces);
+
+    std::vector<Vertex *>   new_vertices(nvertices);
+    std::vector<Face *>     new_faces(nfaces);
+
+    this->vertex_pool.reserve(nvertices);
+    this->face_pool.reserve(nfaces);
+    for (i = 0; i < nvertices; i++) {
+        new_vertices[i] = static_cast<Vertex *>(this->vertex_pool.allocate());
+    }
+    for (i = 0; i < nfaces; i++) {
+        new_faces[i]    = static_cast<Face *>(this->face_pool.allocate());
+    }
+    this->V_pos.resize(nvertices);
+
+    /* construct the elements and sorted lists in parallel as in cloneElements() */
+    std::vector<SlabPool *> pools(nchunks, &(this->node_pool));
+    for (c = 1; c < nchunks; c++) {
+        this->copy_node_pools.push_back(std::unique_ptr<SlabPool>(new SlabPool(this->node_pool.nodeSize(), alignof(void *))));
+        pools[c] = this->copy_node_pools.back().get();
+    }
+
+    Aux::Alg::parallelFor(nvertices, nchunks,
+        [&] (size_t vbegin, size_t vend, uint32_t c) -> void
+        {
+            SlabPool       *pool    = pools[c];
+            const size_t    fbegin  = ((size_t)nfaces * c) / nchunks;
+            const size_t    fend    = ((size_t)nfaces * (c + 1)) / nchunks;
+            size_t          v, f, r;
+
+            pool->reserve(adj_begin[vend] - adj_begin[vbegin] + (adj_begin[vend] - adj_begin[vbegin]) / 2);
+
+            for (v = vbegin; v < vend; v++) {
+                Vertex *x = ::new (new_vertices[v]) Vertex(this, v, vdata ? vdata + v : NULL);
+
+                x->adjacent_vertices    = VertexList(SlabAllocator<Vertex *>(pool));
+                x->incident_faces       = FaceList(SlabAllocator<Face *>(pool));
+
+                std::sort(adj.begin() + adj_begin[v], adj.begin() + adj_begin[v + 1]);
+                for (r = adj_begin[v]; r < adj_begin[v + 1]; r++) {
+                    x->adjacent_vertices.push_back(new_vertices[adj[r]]);
+                }
+                for (r = adj_begin[v] / 2; r < adj_begin[v + 1] / 2; r++) {
+                    x->incident_faces.push_back(new_faces[inc[r]]);
+                }
+
+                this->V_pos[v] = Vec3<R>(pos[3 * v], pos[3 * v + 1], pos[3 * v + 2]);
+            }
+
+            for (f = fbegin; f < fend; f++) {
+                uint32_t const *fv      = idx + 4 * f;
+                const bool      quad    = (fv[3] != UINT32_MAX);
+                Face           *y       = ::new (new_faces[f]) Face(
+                                                this,
+                                                quad,
+                                                new_vertices[fv[0]],
+                                                new_vertices[fv[1]],
+                                                new_vertices[fv[2]],
+                                                quad ? new_vertices[fv[3]] : NULL,
+                                                fdata ? fdata + f : NULL);
+                y->f_id = f;
+            }
+        });
+
+    this->V.reserve(nvertices);
+    this->F.reserve(nfaces);
+    for (i = 0; i < nvertices; i++) {
+        this->V.insert( { i, VertexPointerType(new_vertices[i]) } );
+    }
+    for (i = 0; i < nfaces; i++) {
+        this->F.insert( { i, FacePointerType(new_faces[i]) } );
+        this->edgeIndexInsertFace(new_faces[i]);
+    }
+
+    /* clear() has dropped the octree, which is rebuilt on demand */
+
+    debugTabDec();
+    debugl(2, "Mesh::buildFromArrays(): done.\n");
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::readFromBinaryFile(const char *filename)
+{
+    debugl(1, "Mesh::readFromBinaryFile(): reading mesh from \"%s\".\n", filename);
+    debugTabInc();
+
+    Aux::File::MappedFile   file;
+    if (!file.open(filename)) {
+        debugTabDec();
+        throw MeshEx(MESH_IO_ERROR, "Mesh::readFromBinaryFile(): can't open input file.");
+    }
+
+    char const     *map         = file.data();
+    const size_t    map_size    = file.size();
+
+    try {
+        if (map_size < sizeof(amb_header)) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromBinaryFile(): input file too small to hold a header.");
+        }
+
+        amb_header h;
+        std::memcpy(&h, map, sizeof(amb_header));
+
+        if (std::memcmp(h.magic, amb_magic, sizeof(amb_magic)) != 0) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromBinaryFile(): input file is not a binary mesh file.");
+        }
+        if (h.byte_order != amb_byte_order) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromBinaryFile(): input file has been written with a different byte order.");
+        }
+        if (h.version != amb_version) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromBinaryFile(): unsupported format version.");
+        }
+        if (h.real_size != sizeof(float) && h.real_size != sizeof(double)) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromBinaryFile(): unsupported floating point size.");
+        }
+        if (h.nvertices >= UINT32_MAX || h.nfaces >= UINT32_MAX) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromBinaryFile(): too many vertices or faces.");
+        }
+
+        /* sections must be aligned and lie within the file */
+        auto section_ok = [&] (uint64_t offset, uint64_t nbytes) -> bool
+            {
+                return (offset % 8 == 0 && offset <= map_size && nbytes <= map_size - offset);
+            };
+
+        if (!section_ok(h.pos_offset, 3 * h.real_size * h.nvertices) || !section_ok(h.idx_offset, 4 * sizeof(uint32_t) * h.nfaces)) {
+            throw MeshEx(MESH_IO_ERROR, "Mesh::readFromBinaryFile(): corrupt section table.");
+        }
+
+        /* positions are used in place if the floating point type matches, converted otherwise */
+        R const            *pos;
+        std::vector<R>      pos_buffer;
+        if (h.real_size == sizeof(R)) {
+            pos = reinterpret_cast<R const *>(map + h.pos_offset);
         }
         else {
-            fclose(outfile);
-            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::writeObjFile(): discovered face that is neither triangle nor quad. internal logic error.");
+            pos_buffer.resize(3 * h.nvertices);
+            if (h.real_size == sizeof(float)) {
+                float const *src = reinterpret_cast<float const *>(map + h.pos_offset);
+                std::copy(src, src + pos_buffer.size(), pos_buffer.begin());
+            }
+            else {
+                double const *src = reinterpret_cast<double const *>(map + h.pos_offset);
+                std::copy(src, src + pos_buffer.size(), pos_buffer.begin());
+            }
+            pos = pos_buffer.data();
+        }
+
+        /* vertex / face data is optional and skipped if its size doesn't match */
+        Tv const *vdata = NULL;
+        Tf const *fdata = NULL;
+        if (std::is_trivially_copyable<Tv>::value && h.vdata_offset != 0 && h.vertex_data_size == sizeof(Tv) &&
+            alignof(Tv) <= 8 && section_ok(h.vdata_offset, sizeof(Tv) * h.nvertices))
+        {
+            vdata = reinterpret_cast<Tv const *>(map + h.vdata_offset);
         }
+        if (std::is_trivially_copyable<Tf>::value && h.fdata_offset != 0 && h.face_data_size == sizeof(Tf) &&
+            alignof(Tf) <= 8 && section_ok(h.fdata_offset, sizeof(Tf) * h.nfaces))
+        {
+            fdata = reinterpret_cast<Tf const *>(map + h.fdata_offset);
+        }
+
+        this->buildFromArrays(
+            h.nvertices,
+            pos,
+            h.nfaces,
+            reinterpret_cast<uint32_t const *>(map + h.idx_offset),
+            vdata,
+            fdata);
     }
+    catch (...) {
+        debugTabDec();
+        throw;
+    }
+
     debugTabDec();
+    debugl(1, "Mesh::readFromBinaryFile(): done reading mesh: numVertices(): %d, numFaces(): %d\n", this->numVertices(), this->numFaces());
+}
 
-    fclose(outfile);
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::writeBinaryFile(
+    const char *jobname,
+    bool        write_data)
+{
+    debugl(4, "Mesh::writeBinaryFile(): writing binary mesh to outfile \"%s\".\n", jobname);
+    debugTabInc();
+
+    /* ids become the indices into the position and data arrays */
+    this->renumberConsecutively();
+
+    char amb_filename[512];
+    snprintf(amb_filename, 512, "%s.amb", jobname);
+    FILE *outfile = fopen(amb_filename, "wb");
+
+    if (!outfile) {
+        debugl(1, "Mesh::writeBinaryFile(): can't open file \'%s\' for writing.\n", amb_filename);
+        debugTabDec();
+        throw MeshEx(MESH_IO_ERROR, "Mesh::writeBinaryFile(): can't open output file for writing.");
+    }
+
+    const bool      write_vdata = write_data && std::is_trivially_copyable<Tv>::value;
+    const bool      write_fdata = write_data && std::is_trivially_copyable<Tf>::value;
+    const uint64_t  nvertices   = this->V.size();
+    const uint64_t  nfaces      = this->F.size();
+
+    amb_header h;
+    std::memset(&h, 0, sizeof(amb_header));
+    std::memcpy(h.magic, amb_magic, sizeof(amb_magic));
+    h.version           = amb_version;
+    h.byte_order        = amb_byte_order;
+    h.real_size         = sizeof(R);
+    h.vertex_data_size  = write_vdata ? sizeof(Tv) : 0;
+    h.face_data_size    = write_fdata ? sizeof(Tf) : 0;
+    h.nvertices         = nvertices;
+    h.nfaces            = nfaces;
+    h.pos_offset        = amb_align(sizeof(amb_header));
+    h.idx_offset        = amb_align(h.pos_offset + 3 * sizeof(R) * nvertices);
+
+    uint64_t end        = h.idx_offset + 4 * sizeof(uint32_t) * nfaces;
+    if (write_vdata) {
+        h.vdata_offset  = amb_align(end);
+        end             = h.vdata_offset + sizeof(Tv) * nvertices;
+    }
+    if (write_fdata) {
+        h.fdata_offset  = amb_align(end);
+    }
+
+    /* write a section, preceded by zero padding up to its offset */
+    uint64_t    written = 0;
+    bool        ok      = true;
+    auto write_section = [&] (uint64_t offset, void const *data, size_t nbytes)
+        {
+            static const char zeros[8] = { 0 };
+            if (offset > written) {
+                ok      &= (fwrite(zeros, 1, offset - written, outfile) == offset - written);
+                written  = offset;
+            }
+            ok      &= (fwrite(data, 1, nbytes, outfile) == nbytes);
+            written += nbytes;
+        };
+
+    write_section(0, &h, sizeof(amb_header));
+
+    std::vector<R> pos;
+    pos.reserve(3 * nvertices);
+    for (auto &v : this->vertices) {
+        Vec3<R> const &p = v.pos();
+        pos.push_back(p[0]);
+        pos.push_back(p[1]);
+        pos.push_back(p[2]);
+    }
+    write_section(h.pos_offset, pos.data(), pos.size() * sizeof(R));
+    std::vector<R>().swap(pos);
+
+    std::vector<uint32_t> idx;
+    idx.reserve(4 * nfaces);
+    for (auto &f : this->faces) {
+        f.checkTriQuad("Mesh::writeBinaryFile()");
+        for (uint32_t i = 0; i < 4; i++) {
+            idx.push_back((i < 3 || f.isQuad()) ? f.vertices[i]->id() : UINT32_MAX);
+        }
+    }
+    write_section(h.idx_offset, idx.data(), idx.size() * sizeof(uint32_t));
+    std::vector<uint32_t>().swap(idx);
+
+    /* raw bytes, since std::vector<bool> has no contiguous storage */
+    if (write_vdata) {
+        std::vector<char>   vdata(sizeof(Tv) * nvertices);
+        size_t              i = 0;
+        for (auto &v : this->vertices) {
+            std::memcpy(&vdata[sizeof(Tv) * i++], &(v.data), sizeof(Tv));
+        }
+        write_section(h.vdata_offset, vdata.data(), vdata.size());
+    }
+    if (write_fdata) {
+        std::vector<char>   fdata(sizeof(Tf) * nfaces);
+        size_t              i = 0;
+        for (auto &f : this->faces) {
+            std::memcpy(&fdata[sizeof(Tf) * i++], &(f.data), sizeof(Tf));
+        }
+        write_section(h.fdata_offset, fdata.data(), fdata.size());
+    }
+
+    ok &= (fclose(outfile) == 0);
+    if (!ok) {
+        debugTabDec();
+        throw MeshEx(MESH_IO_ERROR, "Mesh::writeBinaryFile(): error while writing output file.");
+    }
 
     debugTabDec();
-    debugl(4, "Mesh::writeObjFile(): done.\n");
+    debugl(4, "Mesh::writeBinaryFile(): done.\n");
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::readFromFile(const char *filename)
+{
+    size_t const len = strlen(filename);
+    if (len >= 4 && strcmp(filename + len - 4, ".amb") == 0) {
+        this->readFromBinaryFile(filename);
+    }
+    else {
+        this->readFromObjFile(filename);
+    }
 }
 
 template <typename Tm, typename Tv, typename Tf, typename R>
@@ -4949,28 +6349,36 @@ typename Mesh<Tm, Tv, Tf, R>::vertex_iterator
 Mesh<Tm, Tv, Tf, R>::VertexAccessor::insert(const Vec3<R> &vpos)
 {
     std::pair<
-            typename std::map<uint32_t, VertexPointerType >::iterator,
+            typename IdSlotMap<VertexPointerType>::iterator,
             bool
         >                                                               pair;
 
-    typename std::map<uint32_t, VertexPointerType >::iterator           vit;
+    typename IdSlotMap<VertexPointerType>::iterator           vit;
 
-    /* get fresh id for new vertex, allocate new vertex, insert pair (id, vertex) into map */
+    /* get fresh id for new vertex, allocate new vertex, insert pair (id, vertex) into slot array */
     uint32_t v_id   = this->mesh.V_idq.getId();
-    Vertex *v       = new Vertex(&(this->mesh), vpos);
+    Vertex *v       = new (this->mesh) Vertex(&(this->mesh), v_id);
     pair            = this->mesh.V.insert( { v_id, VertexPointerType(v) } );
     if (!pair.second) {
         throw MeshEx(MESH_LOGIC_ERROR, "vertex with fresh id from idq already present in vertex map. this must never happen..");
     }
     else {
-        /* the (private) constructor Vertex(const Vec3 &pos) does not set the internal iterator
-         * Vertex::m_vit, since it has no way of knowing it in advance. set it now to bring the new
-         * vertex into a consistent state. */
+        /* store position in the slot of the position array belonging to v_id. grow geometrically,
+         * since ids are handed out (almost) consecutively. vpos is copied first, since it might
+         * refer to the position of another vertex of (this) mesh. */
+        Vec3<R> const p             = vpos;
+        if (v_id >= this->mesh.V_pos.size()) {
+            this->mesh.V_pos.resize(std::max<size_t>(v_id + 1, 2 * this->mesh.V_pos.size()));
+        }
+        this->mesh.V_pos[v_id]      = p;
         vit                         = pair.first;
-        v->m_vit                    = vit;
 
-        /* mesh octree needs update */
-        this->mesh.octree_updated   = false;
+        if (this->mesh.journaling()) {
+            this->mesh.journal.push_back(JournalEntry(JOURNAL_VERTEX_INSERT, v, NULL));
+        }
+
+        /* update mesh octree */
+        this->mesh.octreeInsertVertex(v);
 
         /* return iterator */
         return (vit->second->iterator());
@@ -5007,12 +6415,19 @@ Mesh<Tm, Tv, Tf, R>::VertexAccessor::erase(vertex_iterator it)
     /* free id */
     this->mesh.V_idq.freeId(it->id());
 
-    debugl(4, "deleting (deallocating) vertex object..\n");
-    /* delete allocated vertex object */
-    delete &(*it);
+    /* erase vertex from mesh octree while its position is still available */
+    this->mesh.octreeEraseVertex(&(*it));
 
-    /* mesh octree needs update */
-    this->mesh.octree_updated = false;
+    /* delete allocated vertex object. with a checkpoint set, it is kept alive for rollback() */
+    if (this->mesh.journaling()) {
+        debugl(4, "journaling vertex object..\n");
+        this->mesh.journal.push_back(JournalEntry(JOURNAL_VERTEX_ERASE, &(*it), NULL));
+        this->mesh.journal.back().pos = it->pos();
+    }
+    else {
+        debugl(4, "deleting (deallocating) vertex object..\n");
+        this->mesh.destroyVertex(&(*it));
+    }
 
     debugTabDec();
     debugl(3, "Mesh::VertexAccessor::erase(). erase()ing and returning vertex_iterator to next vertex.\n");
@@ -5163,10 +6578,7 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
     Face                           *tri;
     Vertex                         *v0, *v1, *v2;
     std::pair<
-        typename std::map<
-            uint32_t,
-            FacePointerType
-        >::iterator,
+        typename IdSlotMap<FacePointerType>::iterator,
         bool>                       rpair;
 
     /* at least check whether all iterators refer to (this) mesh! */
@@ -5186,7 +6598,7 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
 
     /* get fresh id for new triangle */
     tri_id  = this->mesh.F_idq.getId();
-    tri     = new Face(&(this->mesh), false, v0, v1, v2, NULL);
+    tri     = new (this->mesh) Face(&(this->mesh), false, v0, v1, v2, NULL);
 
     /* insert into map, directly set iterator inside newly created Face */
     rpair   = this->mesh.F.insert( {tri_id, FacePointerType(tri) } );
@@ -5194,9 +6606,9 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
         throw MeshEx(MESH_LOGIC_ERROR, "Mesh::FaceAccessor::insert(): new Face with fresh id from idq already present in Face map. this must never happen..");
     }
 
-    /* set Face::m_fit iterator, which is required for Face to be in a consistent state and has not
-     * been set by the (private) Face ctor, just as for Mesh::Vertex */
-    tri->m_fit  = rpair.first;
+    /* set Face::f_id, which is required for Face to be in a consistent state and has not been set by
+     * the (private) Face ctor */
+    tri->f_id   = tri_id;
 
     /* vertex ids can be in adjacent_vertices multiple times, for two vertices can be an edge of two
      * incident faces. when getAdjacentIndices/Vertices() is called, the unique() list is computed.
@@ -5216,7 +6628,11 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
     v2->insertAdjacentVertex(v1);
     v2->insertIncidentFace(tri);
 
-    this->mesh.octree_updated = false;
+    this->mesh.edgeIndexInsertFace(tri);
+    this->mesh.octreeInsertFace(tri);
+    if (this->mesh.journaling()) {
+        this->mesh.journal.push_back(JournalEntry(JOURNAL_FACE_INSERT, NULL, tri));
+    }
 
     /* return iterator to newly inserted tri */
     return (tri->iterator());
@@ -5254,9 +6670,7 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
     Face                           *quad;
     Vertex                         *v0, *v1, *v2, *v3;
     std::pair<
-        typename std::map<
-            uint32_t,
-            FacePointerType >
+        typename IdSlotMap<FacePointerType>
         ::iterator,
         bool>                       rpair;
 
@@ -5278,7 +6692,7 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
 
     /* get fresh id for new triangle */
     quad_id = this->mesh.F_idq.getId();
-    quad    = new Face( &(this->mesh), true, v0, v1, v2, v3);
+    quad    = new (this->mesh) Face( &(this->mesh), true, v0, v1, v2, v3);
 
     /* insert into map, directly set iterator inside newly created Face */
     rpair   = this->mesh.F.insert( { quad_id, FacePointerType(quad) } );
@@ -5286,9 +6700,9 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
         throw MeshEx(MESH_LOGIC_ERROR, "Mesh::FaceAccessor::insert(): new Face with fresh id from idq already present in Face map. this must never happen..");
     }
 
-    /* set Face::m_fit iterator, which is required for Face to be in a consistent state and has not
-     * been set by the (private) Face ctor, just as for Mesh::Vertex */
-    quad->m_fit = rpair.first;
+    /* set Face::f_id, which is required for Face to be in a consistent state and has not been set by
+     * the (private) Face ctor */
+    quad->f_id  = quad_id;
 
     /* topology information update */
     v0->insertAdjacentVertex(v3);
@@ -5307,8 +6721,11 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::insert(
     v3->insertAdjacentVertex(v0);
     v3->insertIncidentFace(quad);
 
-    /* mesh octree needs update */
-    this->mesh.octree_updated = false;
+    this->mesh.edgeIndexInsertFace(quad);
+    this->mesh.octreeInsertFace(quad);
+    if (this->mesh.journaling()) {
+        this->mesh.journal.push_back(JournalEntry(JOURNAL_FACE_INSERT, NULL, quad));
+    }
 
     /* return iterator to newly inserted quad */
     return ( quad->iterator() );
@@ -5352,6 +6769,10 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::erase(face_iterator it)
     /* get pointer to face */
     Face *f = &(*it);
 
+    /* remove the face from the edge index and the octree while its vertices are still intact */
+    this->mesh.edgeIndexEraseFace(f);
+    this->mesh.octreeEraseFace(f);
+
     /* quads */
     if ( f->isQuad() ) {
         Vertex *v_i, *v_j, *v_k, *v_l;
@@ -5424,11 +6845,13 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::erase(face_iterator it)
     /* free face_id */
     this->mesh.F_idq.freeId( it->id() );
 
-    /* delete allocated face object */
-    delete &(*it);
-
-    /* mesh octree needs update */
-    this->mesh.octree_updated = false;
+    /* delete allocated face object. with a checkpoint set, it is kept alive for rollback() */
+    if (this->mesh.journaling()) {
+        this->mesh.journal.push_back(JournalEntry(JOURNAL_FACE_ERASE, NULL, f));
+    }
+    else {
+        this->mesh.destroyFace(f);
+    }
 
     debugTabDec();
 
@@ -5466,6 +6889,151 @@ Mesh<Tm, Tv, Tf, R>::FaceAccessor::empty() const
     return (this->mesh.F.empty());
 }
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::EdgeAccessor(Mesh<Tm, Tv, Tf, R> &m) : mesh(m)
+{
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::checkEnabled(const char *fn) const
+{
+    if (!this->mesh.edge_index_enabled) {
+        throw MeshEx(MESH_LOGIC_ERROR, std::string(fn) + ": edge index disabled. call Mesh::enableEdgeIndex() before accessing edges.");
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::begin()
+{
+    this->checkEnabled("Mesh::EdgeAccessor::begin()");
+    return Mesh::edge_iterator( &(this->mesh), this->mesh.E.begin());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_const_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::begin() const
+{
+    this->checkEnabled("Mesh::EdgeAccessor::begin()");
+    return Mesh::edge_const_iterator( &(this->mesh), this->mesh.E.begin());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::end()
+{
+    return Mesh::edge_iterator( &(this->mesh), this->mesh.E.end());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_const_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::end() const
+{
+    return Mesh::edge_const_iterator( &(this->mesh), this->mesh.E.end());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::find(const uint32_t &id)
+{
+    this->checkEnabled("Mesh::EdgeAccessor::find()");
+    return Mesh::edge_iterator( &(this->mesh), this->mesh.E.find(id));
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_const_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::find(const uint32_t &id) const
+{
+    this->checkEnabled("Mesh::EdgeAccessor::find()");
+    return Mesh::edge_const_iterator( &(this->mesh), this->mesh.E.find(id));
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::find(
+    const vertex_const_iterator    &u_it,
+    const vertex_const_iterator    &v_it)
+{
+    this->checkEnabled("Mesh::EdgeAccessor::find()");
+    if (!u_it.checkContainer(this->mesh) || !u_it.sameContainer(v_it)) {
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::EdgeAccessor::find(): given vertices not from (this) mesh.");
+    }
+
+    Edge *e = this->mesh.edgeIndexFind(&(*u_it), &(*v_it));
+    return (e ? e->iterator() : this->end());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_const_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::find(
+    const vertex_const_iterator    &u_it,
+    const vertex_const_iterator    &v_it) const
+{
+    return const_cast<EdgeAccessor *>(this)->find(u_it, v_it);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::lowerBound(const uint32_t &id)
+{
+    this->checkEnabled("Mesh::EdgeAccessor::lowerBound()");
+    return Mesh::edge_iterator( &(this->mesh), this->mesh.E.lower_bound(id));
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::edge_const_iterator
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::lowerBound(const uint32_t &id) const
+{
+    this->checkEnabled("Mesh::EdgeAccessor::lowerBound()");
+    return Mesh::edge_const_iterator( &(this->mesh), this->mesh.E.lower_bound(id));
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+uint32_t
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::idBound() const
+{
+    this->checkEnabled("Mesh::EdgeAccessor::idBound()");
+    return (this->mesh.E.idBound());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+typename Mesh<Tm, Tv, Tf, R>::Edge &
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::at(const uint32_t &id)
+{
+    this->checkEnabled("Mesh::EdgeAccessor::at()");
+    try {
+        return *(this->mesh.E.at(id));
+    }
+    catch (std::out_of_range &e) {
+        throw MeshEx(MESH_LOGIC_ERROR, "Mesh::EdgeAccessor::at(): no edge with given id.");
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::exists(const uint32_t &id) const
+{
+    this->checkEnabled("Mesh::EdgeAccessor::exists()");
+    return (this->mesh.E.exists(id));
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+size_t
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::size() const
+{
+    this->checkEnabled("Mesh::EdgeAccessor::size()");
+    return (this->mesh.E.size());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+bool
+Mesh<Tm, Tv, Tf, R>::EdgeAccessor::empty() const
+{
+    this->checkEnabled("Mesh::EdgeAccessor::empty()");
+    return (this->mesh.E.empty());
+}
+
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::resetTraversalStates()
@@ -5500,6 +7068,204 @@ Mesh<Tm, Tv, Tf, R>::getFreshTraversalId()
     return tid;
 }
 
+template <typename Tm, typename Tv, typename Tf, typename R>
+template <typename S>
+void
+Mesh<Tm, Tv, Tf, R>::traverseFaceNeighbourhood(
+    Face                   *fstart,
+    uint32_t                max_depth,
+    std::vector<Face*>     &face_neighbourhood,
+    S                      &states)
+{
+    std::queue< std::pair<Face*, uint32_t> >    Q;
+    Face                                       *f;
+    uint32_t                                    f_depth;
+    std::vector<Face*>                          f_neighbours;
+    f_neighbours.reserve(3);
+
+    // each new element can have two new neighbors at most (triangles)
+    // this leads to a maximum of 3*2^n-2 triangles in the neighborhood
+    // be careful if depth parameter is chosen ridiculously high
+    face_neighbourhood.clear();
+    face_neighbourhood.reserve(3*pow(2,std::min(max_depth,7u))-2);
+
+    /* initialize Q: we start at face fstart in depth 0 */
+    Q.push({fstart, 0});
+
+    while (!Q.empty())
+    {
+        /* get front element and dequeue */
+        f       = Q.front().first;
+        f_depth = Q.front().second;
+        Q.pop();
+
+        /* append to face_list, set f's traversal state to done */
+        face_neighbourhood.push_back(f);
+        states.setFaceState(f, TRAV_DONE);
+
+        /* if max_depth has not yet been reached, inspect all neighbours of f, if they haven't been
+         * enqueue yet, enqueue them. */
+        if (f_depth <= max_depth) {
+            f->getFaceNeighbours(f_neighbours);
+            for (Face *nb : f_neighbours) {
+                if (states.getFaceState(nb) == TRAV_UNSEEN) {
+                    Q.push({nb, f_depth + 1});
+                    states.setFaceState(nb, TRAV_ENQUEUED);
+                }
+            }
+            f_neighbours.clear();
+        }
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+template <typename S>
+void
+Mesh<Tm, Tv, Tf, R>::traverseConnectedComponent(
+    Vertex                 *vstart,
+    S                      &states,
+    std::list<Vertex *>    *cc_vertices,
+    std::list<Face *>      *cc_faces)
+{
+    debugl(2, "Mesh::getConnectedComponent(). start vertex: %5d\n", vstart->id());
+    debugTabInc();
+
+    /* only process if one of the given list pointers isn't NULL and the start vertex's traversal
+     * state is set to UNSEEN. */
+    if ( (cc_vertices || cc_faces) && states.getVertexState(vstart) == TRAV_UNSEEN) {
+        std::queue<Vertex *>    Q;
+
+        Vertex                 *v;
+
+        /* traverse cc of vstart, burning it down as we go.. */
+        Q.push(vstart);
+
+        debugl(3, "traversing connected component of start vertex %5d.\n", Q.front()->id());
+        debugTabInc();
+        while (!Q.empty()) {
+            v = Q.front();
+            Q.pop();
+
+            debugl(4, "current vertex %5d\n", v->id() );
+
+            /* add v and all its incident faces to the result lists if desired by the caller */
+            if (cc_vertices) {
+                cc_vertices->push_back(v);
+            }
+            if (cc_faces) {
+                /* a face incident incident to v is appended to cc_faces list iff this face hasn't
+                 * been seen yet. in this case, set traversal state to DONE to prevent multiple
+                 * insertions of the same face. */
+                for (auto v_if : v->getFaceStar()) {
+                    if (states.getFaceState(v_if) == TRAV_UNSEEN) {
+                        cc_faces->push_back(v_if);
+                        states.setFaceState(v_if, TRAV_DONE);
+                    }
+                }
+            }
+
+            debugTabInc();
+            /* iterate over all vertex neighbours u and enqueue them if they haven't been seen yet. */
+            for (auto &u : v->getVertexStar()) {
+                if (states.getVertexState(u) == TRAV_UNSEEN) {
+                    debugl(4, "yet unseen neighbour %5d => enqueueing..\n", u->id() );
+                    Q.push(u);
+                    states.setVertexState(u, TRAV_ENQUEUED);
+                }
+            }
+            debugTabDec();
+
+            /* v is done. */
+            debugl(4, "vertex %5d done.\n", v->id() );
+            states.setVertexState(v, TRAV_DONE);
+        }
+        debugTabDec();
+        debugl(3, "traversal of connected component completed.\n");
+    }
+
+    debugTabDec();
+    debugl(2, "Mesh::getConnectedComponent(). done.\n");
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+Mesh<Tm, Tv, Tf, R>::TraversalStates::TraversalStates(Mesh<Tm, Tv, Tf, R> const &M)
+    : mesh(&M), epoch(1), v_states(M.V.idBound(), 0), f_states(M.F.idBound(), 0)
+{
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::TraversalStates::reset()
+{
+    /* states are stored as (epoch << 8) | state, so the 24 bit epoch wraps after 2^24 - 1
+     * resets. only then are the arrays actually cleared. */
+    if (++(this->epoch) == (1u << 24)) {
+        std::fill(this->v_states.begin(), this->v_states.end(), 0);
+        std::fill(this->f_states.begin(), this->f_states.end(), 0);
+        this->epoch = 1;
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+inline uint8_t
+Mesh<Tm, Tv, Tf, R>::TraversalStates::getState(
+    std::vector<uint32_t> const    &states,
+    uint32_t                        id) const
+{
+    if (id < states.size() && (states[id] >> 8) == this->epoch) {
+        return (states[id] & 0xFF);
+    }
+    else {
+        return TRAV_UNSEEN;
+    }
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+inline void
+Mesh<Tm, Tv, Tf, R>::TraversalStates::setState(
+    std::vector<uint32_t>  &states,
+    uint32_t                id,
+    uint8_t                 state)
+{
+    /* element inserted after construction: grow to the current id bound */
+    if (id >= states.size()) {
+        states.resize(std::max<size_t>(id + 1, (&states == &(this->v_states) ? this->mesh->V.idBound() : this->mesh->F.idBound())), 0);
+    }
+    states[id] = (this->epoch << 8) | state;
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+uint8_t
+Mesh<Tm, Tv, Tf, R>::TraversalStates::getVertexState(Vertex const *v) const
+{
+    return this->getState(this->v_states, v->id());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::TraversalStates::setVertexState(
+    Vertex const   *v,
+    uint8_t         state)
+{
+    this->setState(this->v_states, v->id(), state);
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+uint8_t
+Mesh<Tm, Tv, Tf, R>::TraversalStates::getFaceState(Face const *f) const
+{
+    return this->getState(this->f_states, f->id());
+}
+
+template <typename Tm, typename Tv, typename Tf, typename R>
+void
+Mesh<Tm, Tv, Tf, R>::TraversalStates::setFaceState(
+    Face const *f,
+    uint8_t     state)
+{
+    this->setState(this->f_states, f->id(), state);
+}
+
 template <typename Tm, typename Tv, typename Tf, typename R>
 void
 Mesh<Tm, Tv, Tf, R>::checkInternalConsistency() const
@@ -5513,7 +7279,7 @@ Mesh<Tm, Tv, Tf, R>::checkInternalConsistency() const
     std::list<Vertex *> vptr_list;
     for (auto vit = this->V.begin(); vit != this->V.end(); ++vit) {
         v = vit->second;
-        if (v->mesh != this || v->m_vit != vit || v->id() != vit->first) {
+        if (v->mesh != this || v->id() != vit->first) {
             throw MeshEx(MESH_LOGIC_ERROR, "Mesh::checkInternalConsistency(): found vertex with inconsistent mesh pointer or internal iterator. internal logic error.");
         }
         /* only if shared_ptr<Vertex> is VertexPointerType */
@@ -5536,7 +7302,7 @@ Mesh<Tm, Tv, Tf, R>::checkInternalConsistency() const
     std::list<Face *> fptr_list;
     for (auto fit = this->F.begin(); fit != this->F.end(); ++fit) {
         f = fit->second;
-        if (f->mesh != this || f->m_fit != fit || f->id() != fit->first) {
+        if (f->mesh != this || f->id() != fit->first) {
             throw MeshEx(MESH_LOGIC_ERROR, "Mesh::checkInternalConsistency(): found face with inconsistent mesh pointer or internal iterator. internal logic error.");
         }
         /* only if shared_ptr<Face> is FacePointerType */
@@ -5555,6 +7321,42 @@ Mesh<Tm, Tv, Tf, R>::checkInternalConsistency() const
     if (fptr_list.size() != this->F.size()) {
         throw MeshEx(MESH_LOGIC_ERROR, "Mesh::checkInternalConsistency(): at least one face (pointer) stored under two differend ids..\n");
     }
+
+    /* if present, the edge index must list exactly the edges of all faces */
+    if (this->edge_index_enabled) {
+        size_t nedge_face_pairs = 0;
+        for (auto &e : this->edge_index) {
+            nedge_face_pairs += e.second.n;
+        }
+
+        size_t nface_edges = 0;
+        for (Face *f : fptr_list) {
+            const uint32_t nv = f->isQuad() ? 4 : 3;
+            for (uint32_t i = 0; i < nv; i++) {
+                const Edge *e = this->edgeIndexFind(f->vertices[i], f->vertices[(i + 1) % nv]);
+                if (!e || !(e->f[0] == f || (e->n > 1 && e->f[1] == f) ||
+                            std::find(e->f_more.begin(), e->f_more.end(), f) != e->f_more.end()))
+                {
+                    throw MeshEx(MESH_LOGIC_ERROR, "Mesh::checkInternalConsistency(): found face edge missing in edge index. internal logic error.");
+                }
+            }
+            nface_edges += nv;
+        }
+
+        if (nedge_face_pairs != nface_edges) {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::checkInternalConsistency(): edge index contains stale entries. internal logic error.");
+        }
+
+        /* every edge must be registered under its id */
+        if (this->E.size() != this->edge_index.size()) {
+            throw MeshEx(MESH_LOGIC_ERROR, "Mesh::checkInternalConsistency(): number of edge ids differs from number of edges. internal logic error.");
+        }
+        for (auto &e : this->edge_index) {
+            if (!this->E.exists(e.second.e_id) || this->E.at(e.second.e_id) != &(e.second) || e.second.mesh != this) {
+                throw MeshEx(MESH_LOGIC_ERROR, "Mesh::checkInternalConsistency(): edge not registered under its id. internal logic error.");
+            }
+        }
+    }
     debugTabDec();
     debugl(1, "Mesh::checkInternalConsistency(): mesh internally consistent.\n");
 }
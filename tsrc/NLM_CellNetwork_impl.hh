@@ -885,6 +885,8 @@ NLM_CellNetwork<R>::NLM_CellNetwork(std::string network_name)
     this->analysis_nthreads                         = 4;
     this->analysis_univar_solver_eps                = 1E-6;
     this->analysis_bivar_solver_eps                 = 1E-4;
+    this->analysis_incremental                      = false;
+    this->analysis_stop_at_first_intersection       = false;
 
     this->partition_filter_angle                    = M_PI / 2.0;
     this->partition_filter_max_ratio_ratio          = Aux::Numbers::inf<R>();
@@ -922,6 +924,8 @@ NLM_CellNetwork<R>::getSettings() const
     s.analysis_nthreads                         = this->analysis_nthreads;
     s.analysis_univar_solver_eps                = this->analysis_univar_solver_eps;
     s.analysis_bivar_solver_eps                 = this->analysis_bivar_solver_eps;
+    s.analysis_incremental                      = this->analysis_incremental;
+    s.analysis_stop_at_first_intersection       = this->analysis_stop_at_first_intersection;
     /*
     s.partition_filter_angle                    = this->partition_filter_angle;
     s.partition_filter_max_ratio_ratio          = this->partition_filter_max_ratio_ratio;
@@ -953,6 +957,8 @@ NLM_CellNetwork<R>::updateSettings(Settings const &s)
     this->analysis_nthreads                         = s.analysis_nthreads;
     this->analysis_univar_solver_eps                = s.analysis_univar_solver_eps;
     this->analysis_bivar_solver_eps                 = s.analysis_bivar_solver_eps;
+    this->analysis_incremental                      = s.analysis_incremental;
+    this->analysis_stop_at_first_intersection       = s.analysis_stop_at_first_intersection;
 
     this->partition_algo                            = s.partition_algo;
     this->parametrization_algo                      = s.parametrization_algo;
@@ -976,6 +982,8 @@ NLM_CellNetwork<R>::updateSettings(Settings const &s)
         "\t analysis_nthreads:                      %5d\n"\
         "\t analysis_univar_solver_eps:             %5.4e\n"\
         "\t analysis_bivar_solver_eps:              %5.4e\n"\
+        "\t analysis_incremental:                   %s\n"\
+        "\t analysis_stop_at_first_intersection:    %s\n"\
         "\t meshing_flush:                          %5d\n"\
         "\t meshing_flush_face_limit:               %5d\n"\
         "\t meshing_n_soma_refs:                    %5d\n"\
@@ -988,6 +996,8 @@ NLM_CellNetwork<R>::updateSettings(Settings const &s)
         this->analysis_nthreads,
         this->analysis_univar_solver_eps,
         this->analysis_bivar_solver_eps,
+        this->analysis_incremental ? "true" : "false",
+        this->analysis_stop_at_first_intersection ? "true" : "false",
         this->meshing_flush,
         this->meshing_flush_face_limit,
         this->meshing_n_soma_refs,
@@ -2082,7 +2092,8 @@ NLM_CellNetwork<R>::checkNeuriteNeuriteIntersection(
     BLRCanalSurface<3u, R> const   &Delta,
     R const                    &univar_solver_eps,
     R const                    &bivar_solver_eps,
-    std::vector<NLM::p3<R>>    &isec_stat_points)
+    std::vector<NLM::p3<R>>    &isec_stat_points,
+    std::vector<PolyAlg::RealRectangle<R>> const *presolved_roots)
 {
     debugl(2, "NLM_CellNetwork::checkNeuriteNeuriteIntersection():\n");
 
@@ -2119,26 +2130,13 @@ NLM_CellNetwork<R>::checkNeuriteNeuriteIntersection(
     /* scale down to generous absolute error bound */
     feps *= 1E-10;
 
-    debugl(2, "checkNeuriteNeuriteIntersection(): solving bivariate system with bivariate linear clipping..\n");
-    /* solve the system of bivariate polynomials with bivariate linear clipping.
-     * NOTE: unnecessarily, the bivariate linaer clipping implementation requires both polynomials
-     * to be in the same basis, because the same legendre approximation matrices are used. this is
-     * not necessary, but inconvenient to change right now, so:
-     * p is in BB(2m-1, n), q in BB(m, 2n-1) => elevate p by (0, n-1) and q by (m-1, 0) */
-    BiBernsteinPolynomial<5u, 5u, R, R> p_elev, q_elev;
-    p_elev = p.template elevateDegree<0,2u>();
-    q_elev = q.template elevateDegree<2u,0>();
+    /* solve the system of bivariate polynomials unless the roots have been computed by the parts of a split job */
     std::vector<PolyAlg::RealRectangle<R>> roots;
-    try {
-        PolyAlg::BiLinClip_roots<5u, 5u, R>(p_elev, q_elev, 0.0, 1.0, 0.0, 1.0, bivar_solver_eps, pq_roots);
+    if (presolved_roots) {
+        pq_roots = *presolved_roots;
     }
-    catch (const char *err) {
-        debugl(1, "checkNeuriteNeuriteIntersection(): caught exception from BiLinClip_roots: \'%s\'. outputting plot files of polynomial system and defaulting to intersection.\n", err);
-        //p.writePlotFile(200, "gsi_exception_p.plot");
-        //q.writePlotFile(200, "gsi_exception_q.plot");
-
+    else if (!solveNeuriteNeuriteSystem(p, q, PolyAlg::RealRectangle<R>(0.0, 1.0, 0.0, 1.0), bivar_solver_eps, pq_roots)) {
         /* default to intersection */
-        result = true;
         return true;
     }
     /* append root rectangles returned by bivariate linear clipping to candidate points */
@@ -2225,6 +2223,36 @@ NLM_CellNetwork<R>::checkNeuriteNeuriteIntersection(
     return result;
 }
 
+template <typename R>
+bool
+NLM_CellNetwork<R>::solveNeuriteNeuriteSystem(
+    BiBernsteinPolynomial<5u, 3u, R, R>        &p,
+    BiBernsteinPolynomial<3u, 5u, R, R>        &q,
+    PolyAlg::RealRectangle<R> const            &D,
+    R const                                    &bivar_solver_eps,
+    std::vector<PolyAlg::RealRectangle<R>>     &pq_roots)
+{
+    debugl(2, "NLM_CellNetwork::solveNeuriteNeuriteSystem(): solving bivariate system with bivariate linear clipping..\n");
+    /* solve the system of bivariate polynomials with bivariate linear clipping.
+     * NOTE: unnecessarily, the bivariate linaer clipping implementation requires both polynomials
+     * to be in the same basis, because the same legendre approximation matrices are used. this is
+     * not necessary, but inconvenient to change right now, so:
+     * p is in BB(2m-1, n), q in BB(m, 2n-1) => elevate p by (0, n-1) and q by (m-1, 0) */
+    BiBernsteinPolynomial<5u, 5u, R, R> p_elev, q_elev;
+    p_elev = p.template elevateDegree<0,2u>();
+    q_elev = q.template elevateDegree<2u,0>();
+    try {
+        PolyAlg::BiLinClip_roots<5u, 5u, R>(p_elev, q_elev, D.x0, D.x1, D.y0, D.y1, bivar_solver_eps, pq_roots);
+    }
+    catch (const char *err) {
+        debugl(1, "NLM_CellNetwork::solveNeuriteNeuriteSystem(): caught exception from BiLinClip_roots: \'%s\'.\n", err);
+        //p.writePlotFile(200, "gsi_exception_p.plot");
+        //q.writePlotFile(200, "gsi_exception_q.plot");
+        return false;
+    }
+    return true;
+}
+
 /* same for adjacent neurite canal segments. if Gamma and Delta do not share their starting
  * point, then Gamma and Delta MUST be given in the order that  satisfies gamma(1.0) = delta(0.0),
  * i.e. the endpoint of Gamma's spine curve must be the starting point of Delta's spine curve. */
@@ -2439,170 +2467,123 @@ NLM_CellNetwork<R>::checkAdjacentNeuriteNeuriteIntersection(
 
 template <typename R>
 void
-NLM_CellNetwork<R>::startWorkerThread(ThreadInfo *tinfo)
+NLM_CellNetwork<R>::processIntersectionJob(
+    IsecJob                *generic_job,
+    Profiler::StageSet     &prof_stages)
 {
-    using namespace Aux::Timing;
+    Profiler::StageSet::Scope prof_job(prof_stages, generic_job->type());
 
-    IsecJob            *generic_job;
-    REG_Job            *reg_job;
-    LSI_Job            *lsi_job;
-    GSI_Job            *gsi_job;
-    SONS_Job           *sons_job;
-    NSNS_Adj_Job       *nsns_adj_job;
-    NSNS_NonAdj_Job    *nsns_nonadj_job;
-   
-    /* catch exceptions here */
-    try {
-        /* blocking lock: thread waits until it acquires the lock on the mutex in order to work safely. */
-        tinfo->mutex.lock();
-
-        /* measure time */
-        tick(tinfo->thread_id + 1);
-
-        /* loop over all jobs */
-        #ifdef __DEBUG__
-        uint32_t job_index = 0;
-        #endif
-        for (auto generic_job_shared_ptr : tinfo->job_list) {
-            generic_job         = generic_job_shared_ptr.get();
-
-            debugl(1, "Thread %2d: processing job %5d/%5d: type: %2d\n", tinfo->thread_id, ++job_index, tinfo->job_list.size(), generic_job->type());
-
-            /* reset all specialized pointers to NULL */
-            reg_job             = NULL;
-            lsi_job             = NULL;
-            gsi_job             = NULL;
-            sons_job            = NULL;
-            nsns_adj_job        = NULL;
-            nsns_nonadj_job     = NULL;
-
-            /* depending on the job type, down-cast to specialized job class and call solver with the
-             * stored arguments */
-            switch (generic_job->type()) {
-                case JOB_REG:
-                    reg_job                         = dynamic_cast<REG_Job *>(generic_job);
-                    if (reg_job) {
-                        BLRCanalSurface<3u, R> const &Gamma = reg_job->ns_it->neurite_segment_data.canal_segment_magnified;
-
-                        reg_job->result                 = checkCanalSegmentRegularity(
-                                Gamma,
-                                reg_job->univar_solver_eps,
-                                reg_job->checkpoly_roots);
-                    }
-                    else {
-                        throw("(static) NLM_CellNetwork::startWorkerThread(): failed to down-cast generic job to specialized job of indicated type.");
-                    }
-                    break;
-                    
-                case JOB_LSI:
-                    lsi_job = dynamic_cast<LSI_Job *>(generic_job);
-                    if (lsi_job) {
-                        BLRCanalSurface<3u, R> const &Gamma = lsi_job->ns_it->neurite_segment_data.canal_segment_magnified;
-
-                        lsi_job->result                 = checkNeuriteLocalSelfIntersection(
-                                Gamma,
-                                lsi_job->univar_solver_eps,
-                                lsi_job->lsi_neg_points);
-                    }
-                    else {
-                        throw("(static) NLM_CellNetwork::startWorkerThread(): failed to down-cast generic job to specialized job of indicated type.");
-                    }
-                    break;
-                    
-                case JOB_GSI:
-                    gsi_job = dynamic_cast<GSI_Job *>(generic_job);
-
-                    if (gsi_job) {
-                        BLRCanalSurface<3u, R> const &Gamma = gsi_job->ns_it->neurite_segment_data.canal_segment_magnified;
-
-                        gsi_job->result                 = checkNeuriteGlobalSelfIntersection(
-                                Gamma,
-                                gsi_job->univar_solver_eps,
-                                gsi_job->bivar_solver_eps,
-                                gsi_job->gsi_stat_points);
-                    }
-                    else {
-                        throw("(static) NLM_CellNetwork::startWorkerThread(): failed to down-cast generic job to specialized job of indicated type.");
-                    }
-                    break;
-                    
-                case JOB_SONS:
-                    sons_job = dynamic_cast<SONS_Job *>(generic_job);
-
-                    if (sons_job) {
-                        BLRCanalSurface<3u, R> const &Gamma = sons_job->ns_it->neurite_segment_data.canal_segment_magnified;
-
-                        sons_job->result                = checkSomaNeuriteIntersection(
-                                sons_job->s_it->soma_data.soma_sphere,
-                                Gamma,
-                                sons_job->neurite_root_segment,
-                                sons_job->univar_solver_eps,
-                                sons_job->isec_stat_points);
-                    }
-                    else {
-                        throw("(static) NLM_CellNetwork::startWorkerThread(): failed to down-cast generic job to specialized job of indicated type.");
-                    }
-                    break;
-                    
-                case JOB_NS_NS_ADJ:
-                    nsns_adj_job            = dynamic_cast<NSNS_Adj_Job *>(generic_job);
-
-                    if (nsns_adj_job) {
-                        BLRCanalSurface<3u, R> const &Gamma = nsns_adj_job->ns_first_it->neurite_segment_data.canal_segment_magnified;
-                        BLRCanalSurface<3u, R> const &Delta = nsns_adj_job->ns_second_it->neurite_segment_data.canal_segment_magnified;
-
-                        nsns_adj_job->result            = checkAdjacentNeuriteNeuriteIntersection(
-                                Gamma,
-                                Delta,
-                                nsns_adj_job->univar_solver_eps,
-                                nsns_adj_job->bivar_solver_eps,
-                                nsns_adj_job->fst_end_snd_start,
-                                nsns_adj_job->isec_stat_points);
-                    }
-                    else {
-                        throw("(static) NLM_CellNetwork::startWorkerThread(): failed to down-cast generic job to specialized job of indicated type.");
-                    }
-                    break;
-
-                case JOB_NS_NS_NONADJ:
-                    nsns_nonadj_job = dynamic_cast<NSNS_NonAdj_Job *>(generic_job);
-
-                    if (nsns_nonadj_job) {
-                        BLRCanalSurface<3u, R> const &Gamma = nsns_nonadj_job->ns_first_it->neurite_segment_data.canal_segment_magnified;
-                        BLRCanalSurface<3u, R> const &Delta = nsns_nonadj_job->ns_second_it->neurite_segment_data.canal_segment_magnified;
+    /* depending on the job type, down-cast to specialized job class and call solver with the
+     * stored arguments. the type is authoritative, no checked cast required. */
+    switch (generic_job->type()) {
+        case JOB_REG:
+            {
+                REG_Job                        *reg_job = static_cast<REG_Job *>(generic_job);
+                BLRCanalSurface<3u, R> const   &Gamma   = reg_job->ns_it->neurite_segment_data.canal_segment_magnified;
 
-                        nsns_nonadj_job->result         = checkNeuriteNeuriteIntersection(
-                                Gamma,
-                                Delta,
-                                nsns_nonadj_job->univar_solver_eps,
-                                nsns_nonadj_job->bivar_solver_eps,
-                                nsns_nonadj_job->isec_stat_points);
-                    }
-                    else {
-                        throw("(static) NLM_CellNetwork::startWorkerThread(): failed to down-cast generic job to specialized job of indicated type.");
-                    }
-                    break;
+                reg_job->result                 = checkCanalSegmentRegularity(
+                        Gamma,
+                        reg_job->univar_solver_eps,
+                        reg_job->checkpoly_roots);
+            }
+            break;
+            
+        case JOB_LSI:
+            {
+                LSI_Job                        *lsi_job = static_cast<LSI_Job *>(generic_job);
+                BLRCanalSurface<3u, R> const   &Gamma   = lsi_job->ns_it->neurite_segment_data.canal_segment_magnified;
 
-                default:
-                    throw("NLM_CellNetwork::processIntersectionJobs(): unknown job type encountered.\n");
+                lsi_job->result                 = checkNeuriteLocalSelfIntersection(
+                        Gamma,
+                        lsi_job->univar_solver_eps,
+                        lsi_job->lsi_neg_points);
             }
-            /* set job state */
-            generic_job->job_state = JOB_DONE;
-        }
+            break;
+            
+        case JOB_GSI:
+            {
+                GSI_Job                        *gsi_job = static_cast<GSI_Job *>(generic_job);
+                BLRCanalSurface<3u, R> const   &Gamma   = gsi_job->ns_it->neurite_segment_data.canal_segment_magnified;
+
+                gsi_job->result                 = checkNeuriteGlobalSelfIntersection(
+                        Gamma,
+                        gsi_job->univar_solver_eps,
+                        gsi_job->bivar_solver_eps,
+                        gsi_job->gsi_stat_points);
+            }
+            break;
+            
+        case JOB_SONS:
+            {
+                SONS_Job                       *sons_job    = static_cast<SONS_Job *>(generic_job);
+                BLRCanalSurface<3u, R> const   &Gamma       = sons_job->ns_it->neurite_segment_data.canal_segment_magnified;
+
+                sons_job->result                = checkSomaNeuriteIntersection(
+                        sons_job->s_it->soma_data.soma_sphere,
+                        Gamma,
+                        sons_job->neurite_root_segment,
+                        sons_job->univar_solver_eps,
+                        sons_job->isec_stat_points);
+            }
+            break;
+            
+        case JOB_NS_NS_ADJ:
+            {
+                NSNS_Adj_Job                   *nsns_adj_job    = static_cast<NSNS_Adj_Job *>(generic_job);
+                BLRCanalSurface<3u, R> const   &Gamma           = nsns_adj_job->ns_first_it->neurite_segment_data.canal_segment_magnified;
+                BLRCanalSurface<3u, R> const   &Delta           = nsns_adj_job->ns_second_it->neurite_segment_data.canal_segment_magnified;
+
+                nsns_adj_job->result            = checkAdjacentNeuriteNeuriteIntersection(
+                        Gamma,
+                        Delta,
+                        nsns_adj_job->univar_solver_eps,
+                        nsns_adj_job->bivar_solver_eps,
+                        nsns_adj_job->fst_end_snd_start,
+                        nsns_adj_job->isec_stat_points);
+            }
+            break;
 
-        debugl(1, "Thread slot %02d: thread finished after %5.4f seconds.\n", tinfo->thread_id, tack(tinfo->thread_id + 1));
+        case JOB_NS_NS_NONADJ:
+            {
+                NSNS_NonAdj_Job                *nsns_nonadj_job = static_cast<NSNS_NonAdj_Job *>(generic_job);
+                BLRCanalSurface<3u, R> const   &Gamma           = nsns_nonadj_job->ns_first_it->neurite_segment_data.canal_segment_magnified;
+                BLRCanalSurface<3u, R> const   &Delta           = nsns_nonadj_job->ns_second_it->neurite_segment_data.canal_segment_magnified;
+
+                nsns_nonadj_job->result         = checkNeuriteNeuriteIntersection(
+                        Gamma,
+                        Delta,
+                        nsns_nonadj_job->univar_solver_eps,
+                        nsns_nonadj_job->bivar_solver_eps,
+                        nsns_nonadj_job->isec_stat_points);
+            }
+            break;
 
-        /* set thread state to DONE */
-        tinfo->thread_state = THREAD_DONE;
+        case JOB_NS_NS_NONADJ_PART:
+            {
+                NSNS_NonAdj_Part_Job           *nsns_part_job   = static_cast<NSNS_NonAdj_Part_Job *>(generic_job);
+                BLRCanalSurface<3u, R> const   &Gamma           = nsns_part_job->parent->ns_first_it->neurite_segment_data.canal_segment_magnified;
+                BLRCanalSurface<3u, R> const   &Delta           = nsns_part_job->parent->ns_second_it->neurite_segment_data.canal_segment_magnified;
+
+                BiBernsteinPolynomial<5u, 3u, R, R> p;
+                BiBernsteinPolynomial<3u, 5u, R, R> q;
+                BernsteinPolynomial<5u, R, R>       pe_x0, pe_x1, pe_y0, pe_y1;
+
+                /* only the bivariate roots, the result is set when the parent job is evaluated */
+                Gamma.computeIntersectionSystem(Delta, p, q, pe_x0, pe_x1, pe_y0, pe_y1);
+                nsns_part_job->solver_failed    = !solveNeuriteNeuriteSystem(
+                        p,
+                        q,
+                        nsns_part_job->domain,
+                        nsns_part_job->bivar_solver_eps,
+                        nsns_part_job->pq_roots);
+            }
+            break;
 
-        /* unlock mutex */
-        tinfo->mutex.unlock();
-    }
-    catch (const char *errmsg) {
-        /* panic for now */
-        printf("NLM_CellNetwork::startWorkerThread(): caught exception \"%s\". shutting down...\n", errmsg);
-        exit(1);
+        default:
+            throw("(static) NLM_CellNetwork::processIntersectionJob(): unknown job type encountered.");
     }
+    /* set job state */
+    generic_job->job_state = JOB_DONE;
 }
 
 
@@ -2643,13 +2624,12 @@ NLM_CellNetwork<R>::getAllNeuritePaths(std::list<NLM::NeuritePath<R> const *> &n
 /* compute all intersection jobs for one full analysis cycle */
 template <typename R>
 void
-NLM_CellNetwork<R>::computeFullAnalysisIntersectionJobs(
-    std::list<std::shared_ptr<IsecJob>> &job_queue) const
+NLM_CellNetwork<R>::computeFullAnalysisIntersectionJobs(IsecJobTable &jobs) const
 {
     using namespace Aux::Geometry::IntersectionTestResults;
 
-    /* clear job queue passed by reference */
-    job_queue.clear();
+    /* clear job table passed by reference */
+    jobs = IsecJobTable();
 
     /* independent of the soma or neurite it belongs to, every neurite segment of the network is checked for
      *
@@ -2660,10 +2640,13 @@ NLM_CellNetwork<R>::computeFullAnalysisIntersectionJobs(
      *  3. global self-intersection (GSI)
      *
      * */
+    jobs.reg.reserve(this->neurite_segments.size());
+    jobs.lsi.reserve(this->neurite_segments.size());
+    jobs.gsi.reserve(this->neurite_segments.size());
     for (auto &ns : this->neurite_segments) {
-        job_queue.push_back( std::shared_ptr<IsecJob>(new REG_Job( ns.iterator(), this->analysis_univar_solver_eps)) );
-        job_queue.push_back( std::shared_ptr<IsecJob>(new LSI_Job( ns.iterator(), this->analysis_univar_solver_eps)) );
-        job_queue.push_back( std::shared_ptr<IsecJob>(new GSI_Job( ns.iterator(), this->analysis_univar_solver_eps, this->analysis_bivar_solver_eps)) );
+        jobs.reg.emplace_back(ns.iterator(), this->analysis_univar_solver_eps);
+        jobs.lsi.emplace_back(ns.iterator(), this->analysis_univar_solver_eps);
+        jobs.gsi.emplace_back(ns.iterator(), this->analysis_univar_solver_eps, this->analysis_bivar_solver_eps);
     }
 
     /* compute list of all neurite paths. check every neurite path P 
@@ -2674,176 +2657,548 @@ NLM_CellNetwork<R>::computeFullAnalysisIntersectionJobs(
      *
      * 2. check against all other paths Q for bb intersection. if positive, check all pairs of canal segments from P and
      * Q, taking care to catch special cases of incident neurite segments (intra-cell-intra-neurite but not intra-path)
-     * */
+     *
+     * instead of testing all pairs, the overlapping pairs of bounding boxes are obtained from a bounding volume
+     * hierarchy over all magnified canal segments and soma spheres. every job is tagged with a key that reproduces
+     * the order of the pairwise loops over paths, segments and somas, so that the job queue is the same as with
+     * exhaustive testing. */
 
     std::list<NLM::NeuritePath<R> const *>    np_list;
     this->getAllNeuritePaths(np_list);
 
-    for (auto pit = np_list.begin(); pit != np_list.end(); ++pit) {
-        NLM::NeuritePath<R> const &P    = **pit;
-        auto P_bb                       = P.getBoundingBox();
-
-        /* ----- analyze intersection between pairs of canal segments that are both from the SAME path P ---- */
-        /* check all pairs (Gamma_i, Gamma_j) of neurite canal segments from path P for bounding box
-         * intersection.  in the special case of consecutive segments (Gamma_i, Gamma_{i+1}), generate an
-         * NSNS_Adj_Job, which is processed  using a special check that tolerates intersections around common
-         * points. for j > (i+1), the canal segment (Gamma_i, Gamma_j) must not intersect at all =>
-         * NSNS_NonAdj_Jobs are generated. */
-        for (uint32_t i = 0; i < P.canal_segments_magnified.size() - 1; i++) {
-            /* get reference to canal segment C_i as well as its bounding box */
-            BLRCanalSurface<3u, R> const &P_Gamma_i = *(P.canal_segments_magnified[i]);
-            auto P_Gamma_i_bb                   = P_Gamma_i.getBoundingBox();
-
-            /* check for intersection of P_Gamma_i with all somas and generate SONS_Jobs if necessary. */
-            for (auto &s_m : this->soma_vertices) {
-                NLM::SomaInfo<R> const &s_m_info    = s_m.soma_data;
-                NLM::SomaSphere<R> const &S_m       = s_m_info.soma_sphere;
-                auto S_m_bb                         = S_m.getBoundingBox();
-
-                if (S_m_bb && P_Gamma_i_bb) {
-                    job_queue.push_back(std::shared_ptr<IsecJob>(
-                            new SONS_Job(
-                                s_m.iterator(),
-                                P.neurite_segments[i],
-                                this->analysis_univar_solver_eps
-                            )
-                        ));
+    std::vector<NLM::NeuritePath<R> const *>        paths(np_list.begin(), np_list.end());
+    std::vector<BoundingBox<R>>                     path_bbs;
+    std::vector<soma_const_iterator>                somas;
+
+    /* leaf i of the hierarchy is the canal segment (path, index) seg_refs[i] for i < seg_refs.size(), the soma sphere
+     * somas[i - seg_refs.size()] otherwise. */
+    std::vector<std::pair<uint32_t, uint32_t>>      seg_refs;
+    std::vector<BoundingBox<R>>                     boxes;
+
+    for (uint32_t p = 0; p < paths.size(); p++) {
+        path_bbs.push_back(paths[p]->getBoundingBox());
+        for (uint32_t i = 0; i < paths[p]->canal_segments_magnified.size(); i++) {
+            seg_refs.push_back(std::make_pair(p, i));
+            boxes.push_back(paths[p]->canal_segments_magnified[i]->getBoundingBox());
+        }
+    }
+    for (auto &s_m : this->soma_vertices) {
+        somas.push_back(s_m.iterator());
+        boxes.push_back(s_m.soma_data.soma_sphere.getBoundingBox());
+    }
+
+    /* job order key: (P, 0, i, 0, soma) for SONS jobs of segment i of P, (P, 0, i, 1, 0) for the adjacent job
+     * (i, i + 1), (P, 0, i, 2, j) for non-adjacent jobs within P and (P, 1, Q, c, d) for pairs of segments from two
+     * paths P < Q. keyed_jobs refers to the jobs by type and index into the respective array of the table. */
+    typedef std::array<uint32_t, 5>                 JobKey;
+    struct KeyedJob {
+        JobKey      key;
+        uint32_t    type;
+        uint32_t    index;
+    };
+    std::vector<KeyedJob>                           keyed_jobs;
+    std::vector<JobKey>                             inter_pairs;
+
+    /* vertex id => segments incident to the vertex. segments of different paths sharing a vertex are adjacent and
+     * always yield a job, independently of their bounding boxes. */
+    std::unordered_map<uint32_t, std::vector<std::pair<uint32_t, uint32_t>>> vertex_segments;
+
+    for (auto &ref : seg_refs) {
+        auto const &ns_it = paths[ref.first]->neurite_segments[ref.second];
+        vertex_segments[ns_it->getSourceVertex()->id()].push_back(ref);
+        vertex_segments[ns_it->getDestinationVertex()->id()].push_back(ref);
+    }
+    for (auto &vs : vertex_segments) {
+        for (uint32_t x = 0; x < vs.second.size(); x++) {
+            for (uint32_t y = x + 1; y < vs.second.size(); y++) {
+                auto P_ref = vs.second[x], Q_ref = vs.second[y];
+                if (P_ref.first != Q_ref.first) {
+                    if (P_ref.first > Q_ref.first) {
+                        std::swap(P_ref, Q_ref);
+                    }
+                    inter_pairs.push_back({ P_ref.first, 1, Q_ref.first, P_ref.second, Q_ref.second });
                 }
             }
+        }
+    }
 
-            /* generate special-case job for adjacent neurite canal segments (Gamma_i, Gamma_{i+1}), which have to be
-             * checked anyway, since their bounding boxes always intersect. */
-            job_queue.push_back(std::shared_ptr<IsecJob>(
-                    new NSNS_Adj_Job(
-                        P.neurite_segments[i],
-                        P.neurite_segments[i+1],
-                        /* fst_end_snd_start == true, since endpoint of Gamma_i is starting point of Gamma_{i+1} */
-                        true,
-                        this->analysis_univar_solver_eps,
-                        this->analysis_bivar_solver_eps
-                    )
-                ));
-            
-            /* check the rest: j = i + 2, .. */
-            for (uint32_t j = i + 2; j < P.canal_segments_magnified.size(); j++) {
-                BLRCanalSurface<3u, R> const &P_Gamma_j = *(P.canal_segments_magnified[j]);
-                auto P_Gamma_j_bb                   = P_Gamma_j.getBoundingBox();
-
-                /* check for bounding box intersection */
-                if (P_Gamma_i_bb && P_Gamma_j_bb) {
-                    debugl(1, "creating non-adj nsns job (from within one path P): (%d, %d) - (%d, %d)\n",
-                            P.neurite_segments[i]->getSourceVertex()->id(),
-                            P.neurite_segments[i]->getDestinationVertex()->id(),
-                            P.neurite_segments[j]->getSourceVertex()->id(),
-                            P.neurite_segments[j]->getDestinationVertex()->id());
-
-                    job_queue.push_back(std::shared_ptr<IsecJob>(
-                            new NSNS_NonAdj_Job(
+    /* collect the overlapping pairs */
+    {
+        BVH<R>      bvh(boxes, this->analysis_nthreads);
+        uint64_t    npairs = 0;
+
+        bvh.overlappingPairs(
+            [&] (uint32_t x, uint32_t y) -> void
+            {
+                npairs++;
+
+                /* soma / soma pairs are not checked */
+                if (x >= seg_refs.size()) {
+                    return;
+                }
+
+                auto P_ref = seg_refs[x];
+
+                /* canal segment / soma: all but the last segment of every path are checked against overlapping somas */
+                if (y >= seg_refs.size()) {
+                    if (P_ref.second + 1 < paths[P_ref.first]->canal_segments_magnified.size()) {
+                        jobs.sons.emplace_back(
+                                somas[y - seg_refs.size()],
+                                paths[P_ref.first]->neurite_segments[P_ref.second],
+                                this->analysis_univar_solver_eps
+                            );
+                        keyed_jobs.push_back({
+                                JobKey({ P_ref.first, 0, P_ref.second, 0, (uint32_t)(y - seg_refs.size()) }),
+                                JOB_SONS,
+                                (uint32_t)(jobs.sons.size() - 1)
+                            });
+                    }
+                    return;
+                }
+
+                auto Q_ref = seg_refs[y];
+
+                /* two canal segments of the same path: consecutive segments get an adjacent job below anyway */
+                if (P_ref.first == Q_ref.first) {
+                    uint32_t i = std::min(P_ref.second, Q_ref.second);
+                    uint32_t j = std::max(P_ref.second, Q_ref.second);
+
+                    if (j >= i + 2) {
+                        NLM::NeuritePath<R> const &P = *paths[P_ref.first];
+
+                        debugl(1, "creating non-adj nsns job (from within one path P): (%d, %d) - (%d, %d)\n",
+                                P.neurite_segments[i]->getSourceVertex()->id(),
+                                P.neurite_segments[i]->getDestinationVertex()->id(),
+                                P.neurite_segments[j]->getSourceVertex()->id(),
+                                P.neurite_segments[j]->getDestinationVertex()->id());
+
+                        jobs.nsns_nonadj.emplace_back(
                                 P.neurite_segments[i],
                                 P.neurite_segments[j],
                                 this->analysis_univar_solver_eps,
                                 this->analysis_bivar_solver_eps
-                            )
-                        ));
+                            );
+                        keyed_jobs.push_back({
+                                JobKey({ P_ref.first, 0, i, 2, j }),
+                                JOB_NS_NS_NONADJ,
+                                (uint32_t)(jobs.nsns_nonadj.size() - 1)
+                            });
+                    }
+                }
+                /* two canal segments from different paths, classified below together with the adjacent pairs */
+                else {
+                    if (P_ref.first > Q_ref.first) {
+                        std::swap(P_ref, Q_ref);
+                    }
+                    inter_pairs.push_back({ P_ref.first, 1, Q_ref.first, P_ref.second, Q_ref.second });
+                }
+            });
+
+        Profiler::count("bvh_pairs", npairs);
+    }
+
+    /* generate special-case job for adjacent neurite canal segments (Gamma_i, Gamma_{i+1}), which have to be
+     * checked anyway, since their bounding boxes always intersect. */
+    for (uint32_t p = 0; p < paths.size(); p++) {
+        NLM::NeuritePath<R> const &P = *paths[p];
+
+        for (uint32_t i = 0; i + 1 < P.canal_segments_magnified.size(); i++) {
+            jobs.nsns_adj.emplace_back(
+                    P.neurite_segments[i],
+                    P.neurite_segments[i+1],
+                    /* fst_end_snd_start == true, since endpoint of Gamma_i is starting point of Gamma_{i+1} */
+                    true,
+                    this->analysis_univar_solver_eps,
+                    this->analysis_bivar_solver_eps
+                );
+            keyed_jobs.push_back({ JobKey({ p, 0, i, 1, 0 }), JOB_NS_NS_ADJ, (uint32_t)(jobs.nsns_adj.size() - 1) });
+        }
+    }
+
+    /* pairs (P_c, Q_d) of neurite segments from two different paths P and Q, which are only checked if the bounding
+     * boxes of P and Q intersect. if (P_c, Q_d) are adjacent, i.e. are incident to a common neurite vertex, generate
+     * an NSNS_Adj_Job. the corresponding special cases are handled in detail below. otherwise, the canal segments of
+     * P_c and Q_d have intersecting bounding boxes (they stem from the hierarchy) => NSNS_NonAdj_Job. */
+    std::sort(inter_pairs.begin(), inter_pairs.end());
+    inter_pairs.erase(std::unique(inter_pairs.begin(), inter_pairs.end()), inter_pairs.end());
+
+    for (auto &key : inter_pairs) {
+        if (!(path_bbs[key[0]] && path_bbs[key[2]])) {
+            continue;
+        }
+
+        auto const &P_c = paths[key[0]]->neurite_segments[key[3]];
+        auto const &Q_d = paths[key[2]]->neurite_segments[key[4]];
+
+        /* P_c and Q_d share the same starting (source) vertex */
+        if (P_c->getSourceVertex() == Q_d->getSourceVertex()) {
+            jobs.nsns_adj.emplace_back(
+                    P_c,
+                    Q_d,
+                    /* endpoint of P_c is not start point of Q_d */
+                    false,
+                    this->analysis_univar_solver_eps,
+                    this->analysis_bivar_solver_eps
+                );
+            keyed_jobs.push_back({ key, JOB_NS_NS_ADJ, (uint32_t)(jobs.nsns_adj.size() - 1) });
+        }
+        /* end (destination) vertex of P_c is the start (source) vertex of Q_d */
+        else if (P_c->getDestinationVertex() == Q_d->getSourceVertex()) {
+            jobs.nsns_adj.emplace_back(
+                    P_c,
+                    Q_d,
+                    /* endpoint of P_c is start point of Q_d */
+                    true,
+                    this->analysis_univar_solver_eps,
+                    this->analysis_bivar_solver_eps
+                );
+            keyed_jobs.push_back({ key, JOB_NS_NS_ADJ, (uint32_t)(jobs.nsns_adj.size() - 1) });
+        }
+        /* other way around: start (source) vertex of P_c is the end (destination) vertex of Q_d */
+        else if (P_c->getSourceVertex() == Q_d->getDestinationVertex()) {
+            jobs.nsns_adj.emplace_back(
+                    /* reversed order! */
+                    Q_d,
+                    P_c,
+                    /* endpoint of Q_d is start point of P_c */
+                    true,
+                    this->analysis_univar_solver_eps,
+                    this->analysis_bivar_solver_eps
+                );
+            keyed_jobs.push_back({ key, JOB_NS_NS_ADJ, (uint32_t)(jobs.nsns_adj.size() - 1) });
+        }
+        /* this must never happen in a cell-tree that exhibits the proper tree topology */
+        else if (P_c->getDestinationVertex() == Q_d->getDestinationVertex()) {
+            throw("NLM_CellNetwork::computeFullAnalysisIntersectionJobs(): discovered two "\
+                "neurite segments P_c and Q_d from same cell C_n and same neurite N_n_i that"
+                "have the same destination vertex => invalid topology of cell tree.");
+        }
+        /* P_c and Q_d are non-adjacent */
+        else {
+            debugl(1, "creating non-adj nsns job (from two paths P !- Q): (%d, %d) - (%d, %d)\n",
+                    P_c->getSourceVertex()->id(),
+                    P_c->getDestinationVertex()->id(),
+                    Q_d->getSourceVertex()->id(),
+                    Q_d->getDestinationVertex()->id());
+
+            jobs.nsns_nonadj.emplace_back(
+                    P_c,
+                    Q_d,
+                    this->analysis_univar_solver_eps,
+                    this->analysis_bivar_solver_eps
+                );
+            keyed_jobs.push_back({ key, JOB_NS_NS_NONADJ, (uint32_t)(jobs.nsns_nonadj.size() - 1) });
+        }
+    }
+
+    /* restore the order of exhaustive testing */
+    std::sort(keyed_jobs.begin(), keyed_jobs.end(),
+        [] (KeyedJob const &x, KeyedJob const &y) -> bool
+        {
+            return (x.key < y.key);
+        });
+
+    /* all arrays are complete, pointers into them are stable from here on. the per-segment jobs come first. */
+    jobs.order.reserve(3 * jobs.reg.size() + keyed_jobs.size());
+    for (size_t k = 0; k < jobs.reg.size(); k++) {
+        jobs.order.push_back(&(jobs.reg[k]));
+        jobs.order.push_back(&(jobs.lsi[k]));
+        jobs.order.push_back(&(jobs.gsi[k]));
+    }
+
+    for (auto &kj : keyed_jobs) {
+        jobs.order.push_back(jobs.job(kj.type, kj.index));
+    }
+}
+
+/* cost model for job scheduling */
+template <typename R>
+R NLM_CellNetwork<R>::job_cost_scale[NLM_CellNetwork<R>::JOB_NTYPES] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+template <typename R>
+R
+NLM_CellNetwork<R>::estimateJobCost(IsecJob const &job)
+{
+    /* work per clipping step: O(d^2) for a univariate polynomial of degree d, O((m n)^2) for a bivariate one of
+     * bidegree (m, n), whose linear approximation involves all coefficients. GSI and NSNS systems are solved in the
+     * elevated bidegrees (7, 7) and (5, 5) plus two / four univariate edge systems of degree 5. */
+    auto univar     = [] (R d) -> R { return (d + 1) * (d + 1); };
+    auto bivar      = [] (R m, R n) -> R { return (m + 1) * (m + 1) * (n + 1) * (n + 1); };
+
+    /* length of the sampled spine curve relative to its chord, clamped to [1, 4]: curved segments need more
+     * subdivisions until the clipping converges. */
+    auto curvature  = [] (BLRCanalSurface<3u, R> const &Gamma) -> R
+        {
+            uint32_t const  nsamples    = 4;
+            Vec3<R> const   x_0         = Gamma.spineCurveEval(0.0);
+            Vec3<R>         x, x_prev   = x_0;
+            R               len         = 0;
+
+            for (uint32_t i = 1; i <= nsamples; i++) {
+                x       = Gamma.spineCurveEval((R)i / (R)nsamples);
+                len    += (x - x_prev).len2();
+                x_prev  = x;
+            }
+            R chord = (x_prev - x_0).len2();
+            return (4.0 * chord > len) ? std::max<R>(len / chord, 1.0) : 4.0;
+        };
+
+    /* volume of the intersection of two bounding boxes relative to the smaller one, mapped to [1, 4]: overlapping
+     * canal segments produce more candidate rectangles. */
+    auto overlap    = [] (BoundingBox<R> const &A, BoundingBox<R> const &B) -> R
+        {
+            R vol_isec = 1.0, vol_A = 1.0, vol_B = 1.0;
+            for (uint32_t i = 0; i < 3; i++) {
+                vol_isec   *= std::max<R>(std::min(A.max()[i], B.max()[i]) - std::max(A.min()[i], B.min()[i]), 0.0);
+                vol_A      *= A.max()[i] - A.min()[i];
+                vol_B      *= B.max()[i] - B.min()[i];
+            }
+            R vol_min = std::min(vol_A, vol_B);
+            return 1.0 + 3.0 * ( (vol_min > 0) ? std::min<R>(vol_isec / vol_min, 1.0) : 1.0);
+        };
+
+    switch (job.type()) {
+        case JOB_REG:
+            return univar(4) * curvature(static_cast<REG_Job const &>(job).ns_it->neurite_segment_data.canal_segment_magnified);
+
+        case JOB_LSI:
+            return univar(12) * curvature(static_cast<LSI_Job const &>(job).ns_it->neurite_segment_data.canal_segment_magnified);
+
+        case JOB_GSI:
+            {
+                R c = curvature(static_cast<GSI_Job const &>(job).ns_it->neurite_segment_data.canal_segment_magnified);
+                return (bivar(7, 7) + 2 * univar(5)) * c * c;
+            }
+
+        case JOB_SONS:
+            {
+                SONS_Job const &sons_job = static_cast<SONS_Job const &>(job);
+                return univar(5) * overlap(
+                        sons_job.s_it->soma_data.soma_sphere.getBoundingBox(),
+                        sons_job.ns_it->neurite_segment_data.canal_segment_magnified.getBoundingBox());
+            }
+
+        case JOB_NS_NS_ADJ:
+        case JOB_NS_NS_NONADJ:
+            {
+                NSNS_Job const &nsns_job = static_cast<NSNS_Job const &>(job);
+                BLRCanalSurface<3u, R> const &Gamma = nsns_job.ns_first_it->neurite_segment_data.canal_segment_magnified;
+                BLRCanalSurface<3u, R> const &Delta = nsns_job.ns_second_it->neurite_segment_data.canal_segment_magnified;
+
+                return (bivar(5, 5) + 4 * univar(5)) * curvature(Gamma) * curvature(Delta) *
+                    overlap(Gamma.getBoundingBox(), Delta.getBoundingBox());
+            }
+
+        case JOB_NS_NS_NONADJ_PART:
+            {
+                NSNS_NonAdj_Part_Job const &part_job = static_cast<NSNS_NonAdj_Part_Job const &>(job);
+                BLRCanalSurface<3u, R> const &Gamma = part_job.parent->ns_first_it->neurite_segment_data.canal_segment_magnified;
+                BLRCanalSurface<3u, R> const &Delta = part_job.parent->ns_second_it->neurite_segment_data.canal_segment_magnified;
+
+                /* share of the bivariate solve according to the area of the sub-domain */
+                return bivar(5, 5) * curvature(Gamma) * curvature(Delta) * overlap(Gamma.getBoundingBox(), Delta.getBoundingBox()) *
+                    (part_job.domain.x1 - part_job.domain.x0) * (part_job.domain.y1 - part_job.domain.y0);
+            }
+
+        default:
+            throw("(static) NLM_CellNetwork::estimateJobCost(): unknown job type encountered.");
+    }
+}
+
+template <typename R>
+char const *
+NLM_CellNetwork<R>::jobStageName(uint32_t type)
+{
+    switch (type) {
+        case JOB_REG:               return "solve_reg";
+        case JOB_LSI:               return "solve_lsi";
+        case JOB_GSI:               return "solve_gsi";
+        case JOB_SONS:              return "solve_sons";
+        case JOB_NS_NS_ADJ:         return "solve_nsns_adj";
+        case JOB_NS_NS_NONADJ:      return "solve_nsns_nonadj";
+        case JOB_NS_NS_NONADJ_PART: return "solve_nsns_nonadj_part";
+        default:                    return "solve_unknown";
+    }
+}
+
+template <typename R>
+void
+NLM_CellNetwork<R>::getSolverStageTimes(
+    Profiler::Node             *prof_parent,
+    std::vector<double>        &times)
+{
+    times.assign(JOB_NTYPES, 0.0);
+    if (prof_parent) {
+        for (auto &child : prof_parent->children) {
+            for (uint32_t t = 0; t < JOB_NTYPES; t++) {
+                if (child->name == jobStageName(t)) {
+                    times[t] = child->wall_time;
                 }
             }
         }
+    }
+}
 
-        /* ----------------------------------------- iterate over all other paths Q --------------------------------- */
-        auto qit = pit;
-        ++qit;
-        for ( ; qit != np_list.end(); ++qit) {
-            NLM::NeuritePath<R> const &Q    = **qit;
-            auto Q_bb                       = Q.getBoundingBox();
-
-            /* only if bounding boxes of paths P and Q (P != Q) intersect, perform check on the canal segment level. */
-            if (P_bb && Q_bb) {
-                /* iterate over all pairs (P_e, Q_d) of neurite segments from P and Q. if (P_e, Q_d) are adjacent, i.e.
-                 * are incident to a common neurite vertex, generate an NSNS_Adj_Job.  the corresponding special cases
-                 * are handled in detail below. 
-                 *
-                 * otherwise, check the neurite canal segments P_Gamma(for P_c) and Q_Delta(of Q_d) for bounding box
-                 * intersection and generate an NSNS_NonAdj_Job if necessary. */
-                for (auto &P_c : P.neurite_segments) {
-                    NLM::NeuriteSegmentInfo<R> const &P_c_info  = P_c->neurite_segment_data;
-                    BLRCanalSurface<3u, R> const &P_Gamma           = P_c_info.canal_segment_magnified;
-                    auto P_Gamma_bb                             = P_Gamma.getBoundingBox();
-
-                    for (auto &Q_d : Q.neurite_segments) {
-                        NLM::NeuriteSegmentInfo<R> const &Q_d_info  = Q_d->neurite_segment_data;
-
-                        /* P_c and Q_d share the same starting (source) vertex */
-                        if (P_c->getSourceVertex() == Q_d->getSourceVertex()) {
-                            job_queue.push_back(std::shared_ptr<IsecJob>(
-                                    new NSNS_Adj_Job(
-                                        P_c,
-                                        Q_d,
-                                        /* endpoint of P_c is not start point of Q_d */
-                                        false,
-                                        this->analysis_univar_solver_eps,
-                                        this->analysis_bivar_solver_eps
-                                    )
-                                ));
-                        }
-                        /* end (destination) vertex of P_c is the start (source) vertex of Q_d */
-                        else if (P_c->getDestinationVertex() == Q_d->getSourceVertex()) {
-                            job_queue.push_back(std::shared_ptr<IsecJob>(
-                                    new NSNS_Adj_Job(
-                                        P_c,
-                                        Q_d,
-                                        /* endpoint of P_c is start point of Q_d */
-                                        true,
-                                        this->analysis_univar_solver_eps,
-                                        this->analysis_bivar_solver_eps
-                                    )
-                                ));
-                        }
-                        /* other way around: start (source) vertex of P_c is the end (destination) vertex of Q_d */
-                        else if (P_c->getSourceVertex() == Q_d->getDestinationVertex()) {
-                            job_queue.push_back(std::shared_ptr<IsecJob>(
-                                    new NSNS_Adj_Job(
-                                        /* reversed order! */
-                                        Q_d,
-                                        P_c,
-                                        /* endpoint of Q_d is start point of P_c */
-                                        true,
-                                        this->analysis_univar_solver_eps,
-                                        this->analysis_bivar_solver_eps
-                                    )
-                                ));
-                        }
-                        /* this must never happen in a cell-tree that exhibits the proper tree topology */
-                        else if (P_c->getDestinationVertex() == Q_d->getDestinationVertex()) {
-                            throw("NLM_CellNetwork::computeFullAnalysisIntersectionJobs(): discovered two "\
-                                "neurite segments P_c and Q_d from same cell C_n and same neurite N_n_i that"
-                                "have the same destination vertex => invalid topology of cell tree.");
-                        }
-                        /* P_c and Q_d are non-adjacent => check for bounding box intersection */
-                        else {
-                            BLRCanalSurface<3u, R> const &Q_Delta   = Q_d_info.canal_segment_magnified;
-                            auto Q_Delta_bb                     = Q_Delta.getBoundingBox();
-
-                            if (P_Gamma_bb && Q_Delta_bb) {
-                                debugl(1, "creating non-adj nsns job (from two paths P !- Q): (%d, %d) - (%d, %d)\n",
-                                        P_c->getSourceVertex()->id(),
-                                        P_c->getDestinationVertex()->id(),
-                                        Q_d->getSourceVertex()->id(),
-                                        Q_d->getDestinationVertex()->id());
-
-                                job_queue.push_back(std::shared_ptr<IsecJob>(
-                                        new NSNS_NonAdj_Job(
-                                            P_c,
-                                            Q_d,
-                                            this->analysis_univar_solver_eps,
-                                            this->analysis_bivar_solver_eps
-                                        )
-                                    ));
-                            }
-                        }
+template <typename R>
+void
+NLM_CellNetwork<R>::calibrateJobCosts(
+    std::vector<IsecJob *> const   &jobs,
+    std::vector<R> const           &model_costs,
+    std::vector<double> const      &times_before,
+    std::vector<double> const      &times_after)
+{
+    std::vector<R>  type_costs(JOB_NTYPES, 0.0);
+    R               measured_sum    = 0.0;
+    R               model_sum       = 0.0;
+    uint32_t        t;
+
+    for (size_t i = 0; i < jobs.size(); i++) {
+        type_costs[jobs[i]->type()] += model_costs[i];
+    }
+
+    for (t = 0; t < JOB_NTYPES; t++) {
+        if (type_costs[t] > 0 && times_after[t] > times_before[t]) {
+            measured_sum   += times_after[t] - times_before[t];
+            model_sum      += type_costs[t];
+        }
+    }
+
+    /* seconds per cost unit of every measured type relative to the batch average */
+    if (measured_sum > 0) {
+        for (t = 0; t < JOB_NTYPES; t++) {
+            if (type_costs[t] > 0 && times_after[t] > times_before[t]) {
+                job_cost_scale[t] = ( (times_after[t] - times_before[t]) / type_costs[t] ) / (measured_sum / model_sum);
+                debugl(1, "NLM_CellNetwork::calibrateJobCosts(): %s: cost scale %5.4f\n", jobStageName(t), job_cost_scale[t]);
+            }
+        }
+    }
+}
+
+/* incremental analysis. jobs are keyed by a 64-bit FNV-1a hash over their type, solver tolerances and all input
+ * values of the respective solver. */
+template <typename R>
+uint64_t
+NLM_CellNetwork<R>::hashBytes(
+    uint64_t        h,
+    void const     *data,
+    size_t          n)
+{
+    unsigned char const *bytes = static_cast<unsigned char const *>(data);
+
+    for (size_t i = 0; i < n; i++) {
+        h ^= bytes[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+template <typename R>
+uint64_t
+NLM_CellNetwork<R>::hashCanalSegment(BLRCanalSurface<3u, R> const &Gamma)
+{
+    uint64_t        h = 14695981039346656037ull;
+    std::pair<R, R> radii = Gamma.getRadii();
+
+    for (auto &x : Gamma.getSpineCurve().getControlPoints()) {
+        for (uint32_t i = 0; i < 3; i++) {
+            R const c = x[i];
+            h = hashBytes(h, &c, sizeof(R));
+        }
+    }
+    h = hashBytes(h, &radii.first, sizeof(R));
+    h = hashBytes(h, &radii.second, sizeof(R));
+
+    return h;
+}
+
+template <typename R>
+void
+NLM_CellNetwork<R>::computeJobHashes(
+    std::vector<IsecJob *> const               &jobs,
+    std::vector<uint64_t>                      &hashes) const
+{
+    /* most segments take part in several jobs, hash each segment only once */
+    std::unordered_map<uint32_t, uint64_t> segment_hashes;
+
+    auto segmentHash = [&] (neurite_segment_const_iterator const &ns_it) -> uint64_t
+        {
+            auto it = segment_hashes.find(ns_it->id());
+            if (it == segment_hashes.end()) {
+                it = segment_hashes.insert(
+                        std::make_pair(ns_it->id(), hashCanalSegment(ns_it->neurite_segment_data.canal_segment_magnified))
+                    ).first;
+            }
+            return it->second;
+        };
+
+    hashes.clear();
+    hashes.reserve(jobs.size());
+    for (IsecJob const *job : jobs) {
+        uint32_t const  type    = job->type();
+        uint64_t        h       = 14695981039346656037ull;
+        uint64_t        seg[2];
+
+        h = hashBytes(h, &type, sizeof(type));
+        h = hashBytes(h, &job->univar_solver_eps, sizeof(R));
+        h = hashBytes(h, &job->bivar_solver_eps, sizeof(R));
+
+        switch (type) {
+            case JOB_REG:
+                seg[0] = segmentHash(static_cast<REG_Job const &>(*job).ns_it);
+                h = hashBytes(h, seg, sizeof(uint64_t));
+                break;
+
+            case JOB_LSI:
+                seg[0] = segmentHash(static_cast<LSI_Job const &>(*job).ns_it);
+                h = hashBytes(h, seg, sizeof(uint64_t));
+                break;
+
+            case JOB_GSI:
+                seg[0] = segmentHash(static_cast<GSI_Job const &>(*job).ns_it);
+                h = hashBytes(h, seg, sizeof(uint64_t));
+                break;
+
+            case JOB_SONS:
+                {
+                    SONS_Job const             &sons_job    = static_cast<SONS_Job const &>(*job);
+                    NLM::SomaSphere<R> const   &S           = sons_job.s_it->soma_data.soma_sphere;
+
+                    for (uint32_t i = 0; i < 3; i++) {
+                        R const c = S.centre()[i];
+                        h = hashBytes(h, &c, sizeof(R));
                     }
+                    h       = hashBytes(h, &S.radius(), sizeof(R));
+                    h       = hashBytes(h, &sons_job.neurite_root_segment, sizeof(bool));
+                    seg[0]  = segmentHash(sons_job.ns_it);
+                    h       = hashBytes(h, seg, sizeof(uint64_t));
                 }
-            }
+                break;
+
+            case JOB_NS_NS_ADJ:
+                {
+                    NSNS_Adj_Job const &nsns_job = static_cast<NSNS_Adj_Job const &>(*job);
+
+                    h       = hashBytes(h, &nsns_job.fst_end_snd_start, sizeof(bool));
+                    seg[0]  = segmentHash(nsns_job.ns_first_it);
+                    seg[1]  = segmentHash(nsns_job.ns_second_it);
+                    h       = hashBytes(h, seg, 2 * sizeof(uint64_t));
+                }
+                break;
+
+            case JOB_NS_NS_NONADJ:
+                {
+                    NSNS_NonAdj_Job const &nsns_job = static_cast<NSNS_NonAdj_Job const &>(*job);
+
+                    seg[0]  = segmentHash(nsns_job.ns_first_it);
+                    seg[1]  = segmentHash(nsns_job.ns_second_it);
+                    h       = hashBytes(h, seg, 2 * sizeof(uint64_t));
+                }
+                break;
+
+            default:
+                throw("NLM_CellNetwork::computeJobHashes(): unknown job type discovered. internal logic error.");
         }
+        hashes.push_back(h);
     }
 }
 
@@ -2852,168 +3207,224 @@ template <typename R>
 void
 NLM_CellNetwork<R>::processIntersectionJobsMultiThreaded(
     uint32_t const                             &nthreads,
-    std::list<std::shared_ptr<IsecJob>> const  &job_queue,
-    std::list<std::shared_ptr<IsecJob>>        &results)
+    std::vector<IsecJob *> const               &job_queue,
+    std::vector<IsecJob *>                     &results,
+    bool                                        stop_at_first_intersection)
 {
-    /* resize thread slot vector */
-    //this->thread_slots.assign(nthreads, { std::thread(), ThreadInfo() });
-    this->thread_slots.clear();
-    for (uint32_t i = 0; i < nthreads; i++) {
-        this->thread_slots.push_back(ThreadInfo(i));
-    }
+    using namespace Aux::Timing;
+
+    /* non-adjacent NSNS jobs with an estimated cost above 1 / split_fraction of the total are split into a grid of
+     * up to 4 x 4 parameter sub-domains */
+    R const         split_fraction  = 64;
+    uint32_t const  max_split       = 4;
 
     debugl(1, "NLM_CellNetwork::processIntersectionJobs(). number of jobs: %ld\n", job_queue.size());
-    //debugl(1, "NLM_CellNetwork::processIntersectionJobs(). number of jobs: %ld\n", job_queue.size());
 
-    /* if not single-threaded, set njobs_per_thread to 1/(5*nthreads) of the number of total jobs, but not less than 500. just a
-     * heuristic setting to avoid too low or too high work load */
-    uint32_t njobs_per_thread;
-    if (nthreads <= 1) {
-        njobs_per_thread = job_queue.size();
+    /* (re-)create the pool only if the thread count has changed, the workers sleep between analysis cycles. */
+    if (!this->analysis_pool || this->analysis_pool->numWorkers() != std::max(nthreads, 1u)) {
+        this->analysis_pool.reset();
+        this->analysis_pool.reset(new TaskPool(nthreads));
     }
-    else {
-        njobs_per_thread = std::max( 500u, (uint32_t)(job_queue.size() / (5 * nthreads) ) );
+
+    /* estimate the costs of all jobs and split the expensive NSNS jobs. the splitting only depends on the
+     * uncalibrated model, which keeps the results independent of timing and thread count. */
+    std::vector<R>                                      queue_costs;
+    R                                                   total_cost = 0;
+
+    queue_costs.reserve(job_queue.size());
+    for (IsecJob const *job : job_queue) {
+        queue_costs.push_back(estimateJobCost(*job));
+        total_cost += queue_costs.back();
+    }
+
+    std::vector<IsecJob *>                              jobs;
+    std::vector<R>                                      model_costs;
+    std::vector<NSNS_NonAdj_Part_Job>                   parts;
+    /* split jobs with the range of their parts in parts */
+    std::vector<std::tuple<NSNS_NonAdj_Job *, size_t, size_t>> split_jobs;
+    size_t                                              i = 0;
+
+    /* at most split_fraction jobs can exceed 1 / split_fraction of the total cost, so parts never reallocates and the
+     * pointers to its elements stay valid. */
+    jobs.reserve(job_queue.size());
+    model_costs.reserve(job_queue.size());
+    parts.reserve((size_t)split_fraction * max_split * max_split);
+    for (IsecJob *job : job_queue) {
+        R const cost = queue_costs[i++];
+
+        if (job->type() == JOB_NS_NS_NONADJ && cost * split_fraction > total_cost) {
+            uint32_t const  nsplit      = std::min(max_split, (uint32_t)std::ceil(std::sqrt(cost * split_fraction / total_cost)) + 1);
+            size_t const    parts_begin = parts.size();
+
+            for (uint32_t a = 0; a < nsplit; a++) {
+                for (uint32_t b = 0; b < nsplit; b++) {
+                    parts.emplace_back(
+                            static_cast<NSNS_NonAdj_Job *>(job),
+                            PolyAlg::RealRectangle<R>(
+                                (R)a / (R)nsplit, (R)(a + 1) / (R)nsplit,
+                                (R)b / (R)nsplit, (R)(b + 1) / (R)nsplit)
+                        );
+                    jobs.push_back(&(parts.back()));
+                    model_costs.push_back(estimateJobCost(parts.back()));
+                }
+            }
+            split_jobs.push_back(std::make_tuple(static_cast<NSNS_NonAdj_Job *>(job), parts_begin, parts.size()));
+        }
+        else {
+            jobs.push_back(job);
+            model_costs.push_back(cost);
+        }
+    }
+    Profiler::count("split_jobs", split_jobs.size());
+
+    /* longest job first: sort by calibrated cost and deal the jobs round-robin into the initial ranges of the
+     * workers, so that the expensive jobs start early on all workers and only cheap ones are left at the end. when
+     * stopping at the first intersection, the cheapest jobs go first instead, which finds typical failures early. */
+    std::vector<size_t> order(jobs.size()), layout;
+    std::vector<IsecJob *> batch(jobs.size());
+
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+        [&] (size_t x, size_t y) -> bool
+        {
+            R const cost_x = model_costs[x] * job_cost_scale[jobs[x]->type()];
+            R const cost_y = model_costs[y] * job_cost_scale[jobs[y]->type()];
+
+            return (stop_at_first_intersection ? cost_x < cost_y : cost_x > cost_y);
+        });
+
+    this->analysis_pool->priorityLayout(jobs.size(), layout);
+    for (i = 0; i < jobs.size(); i++) {
+        batch[layout[i]] = jobs[order[i]];
     }
 
     uint32_t dbgcmp = getDebugComponent();
     setDebugComponent(DBG_DMC);
 
-    debugTabInc();
-    uint32_t    njobs_remaining = job_queue.size();
-    auto        jit             = job_queue.begin();
-    while (jit != job_queue.end()) {
-        /* check for free thread capacity */
-        for (uint32_t i = 0; i < nthreads; i++) {
-            /* only proceed if end of queue hasn't been reached yet, otherwise break the loop. this can happen because
-             * for loop iterates over nthreads slots. if, e.g., only nthreads - 1 jobs are remaining, the queue will be
-             * empty on the last slot check.. */
-            if (jit != job_queue.end()) {
-                /* try to lock the mutex of thread slot i. if this succeeds and the slot is not processing, get another
-                 * job from the job queue and launch a thread for it */
-                if (thread_slots[i].mutex.try_lock()) {
-                    /* check if thread is IDLE or DONE. otherwise, if thread is in state PROCESSING, the main loop here was
-                     * too quick to relock the mutex .. */
-                    if (thread_slots[i].thread_state == THREAD_IDLE || thread_slots[i].thread_state == THREAD_DONE) {
-                        /* if thread has been running, join with it to ensure that it is fully done. */
-                        if (thread_slots[i].thread_state == THREAD_DONE) {
-                            thread_slots[i].thread.join();
-                        }
+    /* solver time is accounted to one stage per job type below the stage open on the calling thread. the workers
+     * record into thread-local slots, which are merged after each batch. */
+    Profiler::Node             *prof_parent = Profiler::current();
+    std::vector<char const *>   prof_names;
+    std::vector<double>         times_before, times_after;
 
-                        debugl(1, "Thread slot %2d: free. fetching results and preparing another thread..\n", i);
+    for (uint32_t t = 0; t < JOB_NTYPES; t++) {
+        prof_names.push_back(jobStageName(t));
+    }
+    Profiler::StageSet          prof_stages(prof_parent, prof_names);
 
-                        /* push results */
-                        for (auto job : thread_slots[i].job_list) {
-                            if (job->result) {
-                                results.push_back(job);
-                            }
-                        }
+    getSolverStageTimes(prof_parent, times_before);
 
-                        /* reset thread_slots for slot i. this clear()s the contained job list and causes the reference
-                         * count of all shared pointers contained in it to be decreased by one. */
-                        thread_slots[i].reset();
+    /* set by the first positive result if stop_at_first_intersection is set. the solvers of the running jobs check it
+     * as cancellation flag. the job that sets it keeps its result, all jobs that are interrupted or completed
+     * afterwards are reset. */
+    std::atomic<bool>   stop(false);
 
-                        /* get next max(job_queue.size(), njobs_per_thread) jobs from queue and load them into
-                         * thread_slots struct */
-                        for (uint32_t k = 0; k < njobs_per_thread && jit != job_queue.end(); k++, ++jit) {
-                            thread_slots[i].job_list.push_back(*jit);
-                        }
+    auto stopOnIntersection = [&] (IsecJob *job) -> void
+        {
+            if (job->result && !stop.exchange(true)) {
+                return;
+            }
+            if (stop.load()) {
+                job->reset();
+            }
+        };
 
-                        /* set state to processing. */
-                        thread_slots[i].thread_state = THREAD_PROCESSING;
+    tick(1);
+    try {
+        this->analysis_pool->run(batch.size(),
+            [&] (size_t i) -> void
+            {
+                if (!stop_at_first_intersection) {
+                    NLM_CellNetwork<R>::processIntersectionJob(batch[i], prof_stages);
+                }
+                else if (!stop.load()) {
+                    PolyAlg::CancellationScope cancel(&stop);
 
-                        /* decrease remaining jobs counter */
-                        njobs_remaining -= thread_slots[i].job_list.size();
+                    NLM_CellNetwork<R>::processIntersectionJob(batch[i], prof_stages);
+                    /* parts of split jobs have no result on their own */
+                    if (batch[i]->type() != JOB_NS_NS_NONADJ_PART) {
+                        stopOnIntersection(batch[i]);
+                    }
+                }
+            });
 
-                        /* create new thread */
-                        debugl(1, "Thread slot %2d: launching new thread for %5zu jobs. job queue contains another %u waiting jobs.\n",
-                                i, thread_slots[i].job_list.size(), njobs_remaining );
+        prof_stages.merge();
+        getSolverStageTimes(prof_parent, times_after);
 
-                        try {
-                            thread_slots[i].thread =
-                                std::move(
-                                    std::thread(NLM_CellNetwork<R>::startWorkerThread, &(thread_slots[i]))
-                                );
-                        }
-                        catch (std::system_error& err) {
-                            setDebugComponent(dbgcmp);
-                            throw("(static) NLM_CellNetwork::processIntersectionJobsMultiThreaded(): caught std::system-error from thread() constructor => system could not spawn thread.");
-                        }
-                    }
-                    else if (thread_slots[i].thread_state == THREAD_PROCESSING) {
-                        debugl(1, "main loop too quick to relock thread mutex %d. unlocking..\n", i);
-                    }
-                    else {
-                        setDebugComponent(dbgcmp);
-                        throw("NLM_CellNetwork::processIntersectionJobsMultiThreaded(): discovered thread with unknown value for ThreadInfo::thread_state. internal logic error.");
-                    }
+        /* evaluate the candidate points of the split jobs from the bivariate roots of their parts. if the analysis
+         * has been stopped, the parts may be incomplete and the split jobs are left unprocessed. */
+        this->analysis_pool->run(stop.load() ? 0 : split_jobs.size(),
+            [&] (size_t i) -> void
+            {
+                NSNS_NonAdj_Job                        *nsns_job = std::get<0>(split_jobs[i]);
+                std::vector<PolyAlg::RealRectangle<R>>  pq_roots;
+                bool                                    solver_failed = false;
 
-                    /* unlock the mutex */
-                    thread_slots[i].mutex.unlock();
+                if (stop.load()) {
+                    return;
                 }
-                /* thread is still active */
-                else if (thread_slots[i].thread_state == THREAD_PROCESSING) {
-                    debugl(5, "Thread slot %2d: still active..\n", i);
+
+                Profiler::StageSet::Scope   prof_job(prof_stages, JOB_NS_NS_NONADJ);
+                PolyAlg::CancellationScope  cancel(stop_at_first_intersection ? &stop : NULL);
+
+                for (size_t k = std::get<1>(split_jobs[i]); k < std::get<2>(split_jobs[i]); k++) {
+                    solver_failed = solver_failed || parts[k].solver_failed;
+                    pq_roots.insert(pq_roots.end(), parts[k].pq_roots.begin(), parts[k].pq_roots.end());
+                }
+
+                /* default to intersection if the solver failed on any part, as in the unsplit case */
+                if (solver_failed) {
+                    nsns_job->result = true;
                 }
                 else {
-                    setDebugComponent(dbgcmp);
-                    throw("NLM_CellNetwork::processIntersectionJobsMultiThreaded(): discovered thread with unknown value for ThreadInfo::thread_state. internal logic error.");
+                    nsns_job->result = checkNeuriteNeuriteIntersection(
+                            nsns_job->ns_first_it->neurite_segment_data.canal_segment_magnified,
+                            nsns_job->ns_second_it->neurite_segment_data.canal_segment_magnified,
+                            nsns_job->univar_solver_eps,
+                            nsns_job->bivar_solver_eps,
+                            nsns_job->isec_stat_points,
+                            &pq_roots);
                 }
-            }
-            /* end of queue reached in slot-check for loop. break the loop. */
-            else {
-                break; 
-            }
-        }
+                nsns_job->job_state = JOB_DONE;
 
-        /* sleep a few microseconds so as not to burn cpu time on the main thread with polling */
-        usleep(50000);
+                if (stop_at_first_intersection) {
+                    stopOnIntersection(nsns_job);
+                }
+            });
     }
+    catch (...) {
+        setDebugComponent(dbgcmp);
+        throw;
+    }
+    debugl(1, "NLM_CellNetwork::processIntersectionJobs(): %zu jobs (%zu split into %zu parts) processed by %u workers in %5.4f seconds.\n",
+        job_queue.size(), split_jobs.size(), parts.size(), this->analysis_pool->numWorkers(), tack(1));
 
-    debugTabDec();
-
-    debugl(1, "NLM_CellNetwork::processIntersectionJobs(): job queue empty. joining..\n");
+    /* the times of a stopped analysis do not cover all jobs */
+    if (prof_parent && !stop.load()) {
+        calibrateJobCosts(jobs, model_costs, times_before, times_after);
+    }
 
-    /* lock all slot mutices. if slot i has ever been in use, join with it and retrieve results.
-     * */
-    for (uint32_t i = 0; i < nthreads; i++) {
-        /* blocking lock of mutex for thread slot i */
-        thread_slots[i].mutex.lock();
-
-        /* if thread slot i has been used at all, then its state is now DONE, because the thread
-         * releases the mutex only after being done and setting the state to done. the mutex is
-         * locked in blocking fashion above. if thread slot i has never been used, it's state is
-         * idle. the state processing must not occur here. */
-        if (thread_slots[i].thread_state == THREAD_DONE) {
-            /* the thread returns directly after releasing the mutex, but it's all asynchronous here. perform blocking
-             * join() to prevent undefined behaviour.. */
-            thread_slots[i].thread.join();
-
-            /* push results */
-            for (auto job : thread_slots[i].job_list) {
-                if (job->result) {
-                    results.push_back(job);
-                }
+    if (stop_at_first_intersection) {
+        size_t nskipped = 0;
+        for (IsecJob const *job : job_queue) {
+            if (job->job_state != JOB_DONE) {
+                nskipped++;
             }
-
-            /* reset to IDLE and clear job list */
-            thread_slots[i].reset();
-        }
-        else if (thread_slots[i].thread_state == THREAD_IDLE) {
-            debugl(1, "Thread slot %2d: never been used..\n", i);
-        }
-        else if (thread_slots[i].thread_state == THREAD_PROCESSING) {
-            setDebugComponent(dbgcmp);
-            throw("NLM_CellNetwork::processIntersectionJobs(): discovered thread with state PROCESSING after locking mutex. internal logic error.");
         }
-        else {
-            setDebugComponent(dbgcmp);
-            throw("NLM_CellNetwork::processIntersectionJobsMultiThreaded(): discovered thread with unknown value for ThreadInfo::thread_state. internal logic error.");
+        Profiler::count("skipped_jobs", nskipped);
+    }
+
+    /* collect results in job queue order, which keeps the output independent of the number of threads */
+    for (IsecJob *job : job_queue) {
+        if (job->result) {
+            results.push_back(job);
         }
     }
+
     fflush(stdout);
     setDebugComponent(dbgcmp);
 
-    debugl(1, "NLM_CellNetwork::processIntersectionJobs(): joined. done.\n");
+    debugl(1, "NLM_CellNetwork::processIntersectionJobs(): done.\n");
 }
 
 template <typename R>
@@ -3049,6 +3460,23 @@ NLM_CellNetwork<R>::updateNetworkGeometry()
     }
 }
 
+template <typename R>
+void
+NLM_CellNetwork<R>::initAnalysisData()
+{
+    Aux::Numbers::BicofTables<R, 24u>::init();
+    PolyAlg::BiLinClip_getApproximationData<5u, 5u, R>();
+    PolyAlg::BiLinClip_getApproximationData<7u, 7u, R>();
+}
+
+template <typename R>
+void
+NLM_CellNetwork<R>::clearAnalysisCache()
+{
+    this->analysis_cache.clear();
+    this->analysis_cache_jobs.reset();
+}
+
 /* one full analysis iteration on the entire cell network */
 template <typename R>
 bool
@@ -3069,7 +3497,7 @@ NLM_CellNetwork<R>::performFullAnalysis()
     //BernsteinPolynomial<3u, R, R>::initBernsteinBasisInnerProducts(24);
 
     debugl(1, "various approximation data for univariate and bivariate numerical solvers..\n");
-    PolyAlg::BiLinClip_getApproximationData<7u, 7u, R>();
+    NLM_CellNetwork<R>::initAnalysisData();
 
     //debugl(1, "global self-intersection data for maximum radius pipe surface approximation..\n");
     //BLRCanalSurface<3u, R>::initGlobalSelfIntersectionData();
@@ -3079,33 +3507,96 @@ NLM_CellNetwork<R>::performFullAnalysis()
     this->updateAllMDVInformation();
 
     debugl(1, "computing all intersection jobs for one full analysis interation..\n");
-    /* compute all intersection jobs */
-    std::list<std::shared_ptr<IsecJob>> job_list, intersection_list;
-    this->computeFullAnalysisIntersectionJobs(job_list);
+    /* compute all intersection jobs. the table owns the jobs, the lists below only hold pointers into it. */
+    std::unique_ptr<IsecJobTable>   jobs(new IsecJobTable());
+    std::vector<IsecJob *> const   &job_list = jobs->order;
+    std::vector<IsecJob *>          intersection_list;
+    {
+        Profiler::Scope prof_jobs("job_generation");
+        this->computeFullAnalysisIntersectionJobs(*jobs);
+        Profiler::count("jobs", job_list.size());
+    }
+
+    debugl(1, "got %zu jobs.\n", job_list.size());
+
+    if (!this->analysis_incremental) {
+        this->clearAnalysisCache();
 
-    debugl(1, "got %zu jobs => shuffling..\n", job_list.size());
+        printf("processing %zu intersection jobs using %d worker threads.\n", job_list.size(), this->analysis_nthreads); 
 
-    /* move job list into vector, shuffle, move back to job list */
-    std::vector<std::shared_ptr<IsecJob>> job_vec(job_list.size());
+        /* process all jobs multi-threaded */
+        {
+            Profiler::Scope prof_solve("solve");
+            this->processIntersectionJobsMultiThreaded(this->analysis_nthreads, job_list, intersection_list,
+                this->analysis_stop_at_first_intersection);
+            Profiler::count("intersections", intersection_list.size());
+        }
+    }
+    else {
+        /* take over the results of all jobs whose input is unchanged since the last analysis and solve the rest */
+        std::vector<IsecJob *>              solve_list, solved_list;
+        std::vector<uint64_t>               job_hashes;
+        {
+            Profiler::Scope prof_cache("cache_lookup");
+            this->computeJobHashes(job_list, job_hashes);
+
+            size_t  i = 0;
+            bool    cached_intersection = false;
+            for (IsecJob *job : job_list) {
+                auto it = this->analysis_cache.find(job_hashes[i++]);
+                if (it != this->analysis_cache.end() && it->second->type() == job->type()) {
+                    job->copyResult(*(it->second));
+                    cached_intersection = cached_intersection || job->result;
+                }
+                else {
+                    solve_list.push_back(job);
+                }
+            }
+            Profiler::count("cached_jobs", job_list.size() - solve_list.size());
 
-    std::copy(job_list.begin(), job_list.end(), job_vec.begin());
-    job_list.clear();
+            /* the network is known to be unclean already */
+            if (this->analysis_stop_at_first_intersection && cached_intersection) {
+                solve_list.clear();
+            }
+        }
 
-    // shuffle jobs to generate more even load with high probability
-    //std::random_shuffle(job_vec.begin(), job_vec.end());
+        printf("processing %zu of %zu intersection jobs using %d worker threads, %zu results taken from last analysis.\n",
+            solve_list.size(), job_list.size(), this->analysis_nthreads, job_list.size() - solve_list.size());
 
-    std::copy(job_vec.begin(), job_vec.end(), std::back_inserter(job_list));
-    job_vec.clear();
+        {
+            Profiler::Scope prof_solve("solve");
+            this->processIntersectionJobsMultiThreaded(this->analysis_nthreads, solve_list, solved_list,
+                this->analysis_stop_at_first_intersection);
 
-    printf("processing %zu intersection jobs using %d worker threads.\n", job_list.size(), this->analysis_nthreads); 
+            /* collect results in job list order as in the full analysis */
+            for (IsecJob *job : job_list) {
+                if (job->result) {
+                    intersection_list.push_back(job);
+                }
+            }
+            Profiler::count("intersections", intersection_list.size());
+        }
 
-    /* process all jobs multi-threaded */
-    this->processIntersectionJobsMultiThreaded(this->analysis_nthreads, job_list, intersection_list);
+        /* the cache only holds the solved jobs of the current network, results of edited segments are dropped. the
+         * table of the last analysis is released only now, since the results above have been copied from it. */
+        size_t i = 0;
+        this->analysis_cache.clear();
+        for (IsecJob const *job : job_list) {
+            if (job->job_state == JOB_DONE) {
+                this->analysis_cache[job_hashes[i]] = job;
+            }
+            i++;
+        }
+        this->analysis_cache_jobs = std::move(jobs);
+    }
     bool clean = intersection_list.empty();
 
     if (!clean) {
-    printf("intersection jobs processed: number of positive intersection results returned by solvers: %5zu. results in detail:\n",
-        intersection_list.size());
+        if (this->analysis_stop_at_first_intersection) {
+            printf("intersection jobs processed: analysis stopped at first intersection, remaining jobs skipped.\n");
+        }
+        printf("intersection jobs processed: number of positive intersection results returned by solvers: %5zu. results in detail:\n",
+            intersection_list.size());
     }
     else {
         printf("\t intersection jobs processed: network CLEAN.\n");
@@ -3113,8 +3604,7 @@ NLM_CellNetwork<R>::performFullAnalysis()
 
     /* process intersections. get non-const iterators from down-cast job objects and attach intersection info in neurite
      * segments. */
-    for (auto &job_sptr : intersection_list) {
-        IsecJob *generic_job    = job_sptr.get();
+    for (IsecJob *generic_job : intersection_list) {
         uint32_t type           = generic_job->type();
         if (!generic_job->result) {
             debugTabDec();
@@ -3123,7 +3613,7 @@ NLM_CellNetwork<R>::performFullAnalysis()
         }
 
         if (type == JOB_REG) {
-            REG_Job        *reg_job             = dynamic_cast<REG_Job *>(generic_job);
+            REG_Job        *reg_job             = static_cast<REG_Job *>(generic_job);
             REG_IsecInfo   *reg_isec_info       = new REG_IsecInfo(*this, *reg_job); 
 
             /* invoke update method of neurite segment info, which stores the created REG_IsecInfo in smart pointer and
@@ -3144,7 +3634,7 @@ NLM_CellNetwork<R>::performFullAnalysis()
             printf("\t regularity violation:      (%5d) at [%f, %f, %f].\n", reg_job->ns_it->id(), srcCoord[0], srcCoord[1], srcCoord[2]);
         }
         else if (type == JOB_LSI) {
-            LSI_Job        *lsi_job                     = dynamic_cast<LSI_Job *>(generic_job);
+            LSI_Job        *lsi_job                     = static_cast<LSI_Job *>(generic_job);
             LSI_IsecInfo   *lsi_isec_info               = new LSI_IsecInfo(*this, *lsi_job); 
             NLM::NeuriteSegmentInfo<R> &ns_info         = lsi_isec_info->ns_it->neurite_segment_data;
 
@@ -3162,7 +3652,7 @@ NLM_CellNetwork<R>::performFullAnalysis()
             printf("\t local self-intersection:   (%5d) at [%f, %f, %f].\n", lsi_isec_info->ns_it->id(), srcCoord[0], srcCoord[1], srcCoord[2]);
         }
         else if (type == JOB_GSI) {
-            GSI_Job        *gsi_job                     = dynamic_cast<GSI_Job *>(generic_job);
+            GSI_Job        *gsi_job                     = static_cast<GSI_Job *>(generic_job);
             GSI_IsecInfo   *gsi_isec_info               = new GSI_IsecInfo(*this, *gsi_job); 
             NLM::NeuriteSegmentInfo<R> &ns_info         = gsi_isec_info->ns_it->neurite_segment_data;
             ns_info.updateGSIStatus(gsi_isec_info);
@@ -3179,7 +3669,7 @@ NLM_CellNetwork<R>::performFullAnalysis()
             printf("\t global self-intersection:  (%5d) at [%f, %f, %f]\n", gsi_isec_info->ns_it->id(), srcCoord[0], srcCoord[1], srcCoord[2]);
         }
         else if (type == JOB_SONS) {
-            SONS_Job            *sons_job               = dynamic_cast<SONS_Job *>(generic_job);
+            SONS_Job            *sons_job               = static_cast<SONS_Job *>(generic_job);
             IC_SONS_IsecInfo    *sons_isec_info         = new IC_SONS_IsecInfo(*this, *sons_job); 
 
             NLM::NeuriteSegmentInfo<R> &ns_info         = sons_isec_info->ns_it->neurite_segment_data;
@@ -3197,7 +3687,7 @@ NLM_CellNetwork<R>::performFullAnalysis()
             printf("\t soma/neurite:              (%5d, %5d) at [%f, %f, %f].\n", sons_isec_info->s_it->id(), sons_isec_info->ns_it->id(), srcCoord[0], srcCoord[1], srcCoord[2]);
         }
         else if (type == JOB_NS_NS_ADJ || type == JOB_NS_NS_NONADJ) {
-            NSNS_Job       *nsns_job                    = dynamic_cast<NSNS_Job *>(generic_job);
+            NSNS_Job       *nsns_job                    = static_cast<NSNS_Job *>(generic_job);
 
             std::shared_ptr<NSNS_IsecInfo>  sp          = this->generateNSNSIsecInfo(*nsns_job);  
             NSNS_IsecInfo  *nsns_isec_info              = sp.get();
@@ -3261,16 +3751,24 @@ NLM_CellNetwork<R>::performFullAnalysis()
 template <typename R>
 template <typename Tm, typename Tv, typename Tf>
 void
-NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
+NLM_CellNetwork<R>::renderCellNetwork(
+    std::string             filename,
+    Mesh<Tm, Tv, Tf, R>    *M_out,
+    bool                    write_obj,
+    MeshPageStore<R>       *page_store)
 {
     debugl(1, "NLM_CellNetwork<R>::renderCellNetwork(): \"%s\".\n", filename.c_str());
+
+    if (page_store && (M_out || page_store->numVertexIds() != 0)) {
+        throw("NLM_CellNetwork::renderCellNetwork(): page store must be empty and can't be combined with in-memory output.");
+    }
     debugTabInc();
 
     using namespace RedBlue_ExCodes;
 
     std::list<typename NeuritePathTree::vertex_iterator>    npt_vertices_bfs_ordered;
 
-    Mesh<Tm, Tv, Tf, R>                                     M_cell, M_cell_backup, M_S, M_P;
+    Mesh<Tm, Tv, Tf, R>                                     M_cell, M_S, M_P;
 
     bool                                                    end_circle_offset;
     std::vector<
@@ -3319,7 +3817,9 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
     }
 
     /* initialize flush info */
-    MeshAlg::MeshObjFlushInfo<Tm, Tv, Tf, R>    M_cell_flushinfo(filename);
+    MeshAlg::MeshObjFlushInfo<Tm, Tv, Tf, R>    M_cell_flushinfo = page_store ?
+                                                    MeshAlg::MeshObjFlushInfo<Tm, Tv, Tf, R>(page_store) :
+                                                    MeshAlg::MeshObjFlushInfo<Tm, Tv, Tf, R>(filename);
     std::list<uint32_t>                         M_cell_flush_last_boundary_vertices_ids_backup;                          
 
     /* in the computed bread-first ordering, inductively append neurite path meshes */
@@ -3330,6 +3830,8 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
         debugl(2, "processing neurite path %d\n", (*npt_vit)->id());
         printf("\t # meshing neurite path %5u of %5zu.\n", np_idx, npt_vertices_bfs_ordered.size() );
 
+        Profiler::Scope prof_path("merge_path");
+
         /* get reference to neurite path */
         NLM::NeuritePath<R> const &P    = (*npt_vit)->vertex_data;
 
@@ -3379,6 +3881,8 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
          * all faces in the obtained set (list) will never be affected during a merging operation and can safely be
          * flushed to disk. */
         if (this->meshing_flush && M_cell.numFaces() > this->meshing_flush_face_limit) {
+            Profiler::Scope prof_flush("flush");
+
             printf("\t Partial cell mesh has %5d > %5d (flush face limit)) faces. Flushing definitely no longer needed parts off to disk.. ",
                     M_cell.numFaces(), this->meshing_flush_face_limit);
             fflush(stdout);
@@ -3409,8 +3913,9 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
             printf("done.\n");
         }
 
-        /* backup (potentially just partially flushed) cell mesh */
-        M_cell_backup                   = M_cell;
+        /* set a savepoint on the (potentially just partially flushed) cell mesh, so that all changes made while
+         * trying to merge P can be undone. */
+        M_cell.checkpoint();
 
         /* backup ids of all boundary_vertices (referring to M_cell) from M_cell_flushinfo */
         M_cell_flush_last_boundary_vertices_ids_backup.clear();
@@ -3428,28 +3933,17 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
         debugl(1, "entering outer meshing loop for path %d.\n", (*npt_vit)->id());
         debugTabInc();
         while (!done) {
-            /* if necessary, use back M_cell_backup to restore original M_cell before the RedBlueUnion call if
-             * necessary. this is the case iff the exception that lead to the necessity of another run indicated
-             * R_intact == true (M_cell has been used as the red mesh). */
+            /* if necessary, roll back M_cell to the savepoint set before the first RedBlueUnion call for P. this is
+             * the case iff the exception that lead to the necessity of another run indicated R_intact == false (M_cell
+             * has been used as the red mesh). */
             if (restore_M_cell) {
-                /* NOTE: the mesh flush info struct contains _pointers_ to boundary vertices of the old M_cell. once the
-                 * backup is used to restore, the current M_cell is effectively clear()ed and overwritten with the
-                 * backup copy by Mesh::operator=(). this process frees all vertices and faces of the mesh to which the
-                 * backup copy is assigned, which in turn causes dangling invalid pointers inside M_cell_flushinfo. it
-                 * therefore becomes necessary to update all last_boundary_vertices pointer to point to the correct
-                 * vertices of M_cell after the restore. however, mesh assignment with Mesh::operator=() preserves
-                 * integer ids, and so the update can be achieved as follows:
-                 *
-                 * 1. restore M_cell from M_cell_backup with assignment.
-                 *
-                 * 2. locate all boundary vertex ids in the restored M_cell and update pointers in M_cell_flushinfo. the
-                 * reference to M_cell stays intact, since the object itself is never deleted but only overwritten by
-                 * assignment. the integer ids of all boundary vertices are stored in the list
-                 * M_cell_boundary_vertex_ids_backup.
-                 *
-                 * */
-                debugl(1, "restoring M_cell from backup via assignment.\n");
-                M_cell = M_cell_backup;
+                /* NOTE: the mesh flush info struct contains _pointers_ to boundary vertices of M_cell. rollback()
+                 * restores all vertices that have been erased since the savepoint at their old addresses and with
+                 * their old ids, so these pointers are valid again afterwards. they are nevertheless re-resolved from
+                 * the backed up ids below, which is cheap and catches any inconsistency between the flush info and
+                 * the restored mesh. */
+                debugl(1, "rolling back M_cell to savepoint.\n");
+                M_cell.rollback();
 
                 debugl(1, "updating pointers in M_flush_info.last_boundary_vertices via id lookup..\n");
                 auto fp_it = M_cell_flushinfo.last_boundary_vertices.begin();
@@ -3476,6 +3970,7 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
             new_outer_iteration         = false;
             restore_M_cell              = false;
             outer_loop_iter++;
+            Profiler::count("outer_iterations");
 
             if (outer_loop_iter % this->meshing_outer_loop_maxiter == 0) {
                 radius_factor = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
@@ -3570,6 +4065,7 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
                 debugl(2, "calling RedBlueUnion algorithm to merge initial mesh segment into partially completed cell mesh.\n");
 
                 Aux::Timing::tick(14);
+                Profiler::Scope prof_union("redblue_union");
 
                 try {
                     MeshAlg::RedBlueUnion<Tm, Tv, Tf, R>(
@@ -3597,6 +4093,7 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
                     debugTabInc();
 
                     uint32_t const nce = complex_ex.edge_isec_info.size();
+                    Profiler::count("retry_complex_edges");
 
                     /* if this is the first complex edge exception, set initial complex edge count */
                     if (complex_edge_growth_factor == 0.0) {
@@ -3695,11 +4192,13 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
                 }
                 catch (RedBlue_Ex_NumericalEdgeCase& numerical_ex) {
                     debugl(0, "NLM_CellNetwork::renderCellNetwork(): RedBlueAlgorithm returned exception: numerical edge case => retry..\n");
+                    Profiler::count("retry_numerical_edge_case");
                     new_outer_iteration = true;
                     restore_M_cell      = !numerical_ex.R_intact;
                 }
                 catch (RedBlue_Ex_Triangulation<R>& tri_ex) {
                     debugl(0, "NLM_CellNetwork::renderCellNetwork(): RedBlueAlgorithm returned exception: error during triangulation of outside / inside polygons. => retry..\n");
+                    Profiler::count("retry_triangulation");
 
                     /* decrease radius factor, but lower bound by radius_factor_safe_lb. */
                     radius_factor       = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
@@ -3708,12 +4207,14 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
                 }
                 catch (RedBlue_Ex_NumIsecPoly& isecpoly_ex) {
                     debugl(0, "NLM_CellNetwork::renderCellNetwork(): RedBlueAlgorithm returned exception: number of intersection polygons != 1.\n");
+                    Profiler::count("retry_isec_polygons");
                     radius_factor       = std::max(radius_factor_safe_lb, radius_factor - this->meshing_radius_factor_decrement);
                     new_outer_iteration = true;
                     restore_M_cell      = !isecpoly_ex.R_intact;
                 }
                 catch (RedBlue_Ex_AffectedCircleTrivial<R>& trivcircle_ex){
                     debugl(0, "NLM_CellNetwork::renderCellNetwork(): RedBlueAlgorithm returned exception: affected circle trivial.\n");
+                    Profiler::count("retry_affected_circle_trivial");
 
                     // split the single triangle with a center vertex at the pre-computed position
                     if (trivcircle_ex.red)
@@ -3859,6 +4360,9 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
 
             debugl(1, "path %d completely processed. M_cell.numVertices(): %d\n", (*npt_vit)->id(), M_cell.numVertices());
 
+            /* P has been merged for good: drop the savepoint and free everything it kept alive */
+            M_cell.releaseCheckpoint();
+
             /* done for path P */
             done = true;
         }
@@ -3868,13 +4372,40 @@ NLM_CellNetwork<R>::renderCellNetwork(std::string filename)
     debugTabDec();
     debugl(1, "all neurite paths processed. finalizing obj file..\n");
 
+    /* hand the union mesh over in memory: only the part flushed so far is read back from the obj file, the rest is
+     * taken from M_cell directly. */
+    if (M_out) {
+        try {MeshAlg::collectFlushedMesh(M_cell, M_cell_flushinfo, *M_out);}
+        catch (...) {debugTabDec(); debugTabDec(); throw;}
+    }
+
+    Profiler::Scope prof_flush("flush");
+
     /* select all faces from cell mesh and flush them .. if no flush has been performed before, this is semantically
      * equivalent to writeObjFile(), otherwise it completes partially flushed cell meshes that are yet incomplete in the
-     * flush obj file. */
-    std::list<typename Mesh<Tm, Tv, Tf, R>::Face *> remaining_faces = {};
-    M_cell.invertFaceSelection(remaining_faces);
-    try {MeshAlg::partialFlushToObjFile(M_cell, M_cell_flushinfo, remaining_faces);}
-    catch (...) {debugTabDec(); debugTabDec(); throw;}
+     * flush obj file. with a page store, the obj file is written from the store at the very end. */
+    if (page_store) {
+        std::list<typename Mesh<Tm, Tv, Tf, R>::Face *> remaining_faces = {};
+        M_cell.invertFaceSelection(remaining_faces);
+        try {
+            MeshAlg::partialFlushToObjFile(M_cell, M_cell_flushinfo, remaining_faces);
+            if (write_obj) {
+                page_store->writeObjFile(filename.c_str());
+            }
+        }
+        catch (...) {debugTabDec(); debugTabDec(); throw;}
+    }
+    else if (write_obj) {
+        std::list<typename Mesh<Tm, Tv, Tf, R>::Face *> remaining_faces = {};
+        M_cell.invertFaceSelection(remaining_faces);
+        try {MeshAlg::partialFlushToObjFile(M_cell, M_cell_flushinfo, remaining_faces);}
+        catch (...) {debugTabDec(); debugTabDec(); throw;}
+    }
+    /* otherwise the obj file has only served as swap space for partial flushes */
+    else {
+        M_cell_flushinfo.finalize();
+        remove((filename + ".obj").c_str());
+    }
 
     debugTabDec();
     debugl(1, "NLM_CellNetwork<R>::renderCellNetwork(): done.\n");
@@ -523,6 +523,15 @@ BezClip_roots(
     /* main loop, work off stack */
     while (!S.empty())
     {
+        /* cancelled: free the remaining polynomials and return the roots found so far */
+        if (cancelled()) {
+            while (!S.empty()) {
+                delete S.front().p;
+                S.pop();
+            }
+            break;
+        }
+
         /* get top element of S, set variables and pop() */
         T       = S.front();
         p       = T.p;
@@ -1726,6 +1735,16 @@ BiLinClip_roots(
     new_beta1       = 1.0;
 
     while( !S.empty() ) {
+        /* cancelled: free the remaining polynomials and return the roots found so far */
+        if (cancelled()) {
+            for (auto &t : S) {
+                delete t.p;
+                delete t.q;
+            }
+            S.clear();
+            break;
+        }
+
         /* get front element of Q, set variables and pop() */
         T               = S.back();
         p               = T.p;